@@ -0,0 +1,228 @@
+#ifndef NEBULITE_AUDIO_MIXER_HPP
+#define NEBULITE_AUDIO_MIXER_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Nebulite
+#include "Nebulite/Audio/Stream.hpp"
+
+//------------------------------------------
+namespace Nebulite::Audio {
+/**
+ * @struct Sound
+ * @brief A fully decoded sound, as interleaved float samples at the output sample rate of the mixer.
+ */
+struct Sound {
+    std::vector<float> samples;
+    std::size_t channels = 1; // Either mono or stereo
+
+    [[nodiscard]] std::size_t frames() const noexcept { return channels == 0 ? 0 : samples.size() / channels; }
+};
+
+/**
+ * @struct VoiceParams
+ * @brief Playback parameters of a single voice.
+ */
+struct VoiceParams {
+    float gain = 1.0f;  // Linear amplitude
+    float pan = 0.0f;   // -1 is left, 0 is center, 1 is right
+    float pitch = 1.0f; // Playback speed, 2 plays an octave higher. Streamed voices always play at their native speed
+    int priority = 0;   // Voices with a higher priority steal from lower ones if all voices are in use
+    bool loop = false;  // Restart the sound once it ends. Streamed voices loop on the producer side
+};
+
+/**
+ * @struct VoiceId
+ * @brief Handle of a playing voice, invalidated once the voice ends or its slot is reused.
+ */
+struct VoiceId {
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;
+
+    bool operator==(VoiceId const&) const = default;
+};
+
+/**
+ * @class Nebulite::Audio::Mixer
+ * @brief Software mixer of a fixed amount of voices into an interleaved stereo float output.
+ * @details Each voice resamples its source with linear interpolation for pitch,
+ *          and is panned with equal power for mono sources or as a balance for stereo sources.
+ *          Gain changes are ramped linearly over one block to avoid clicks.
+ *          The mix loops work on separate channel buffers in float, written so the compiler can vectorize them.
+ *          If all voices are in use, a new voice steals the one with the lowest priority, preferring the oldest,
+ *          as long as its own priority is not lower. Otherwise, it is dropped.
+ *          All methods may be called from any thread, mixing usually happens on the audio device thread.
+ */
+class Mixer {
+public:
+    /**
+     * @brief Channels of the output, interleaved as left and right.
+     */
+    static std::size_t constexpr outputChannels = 2;
+
+    /**
+     * @brief Frames mixed at once, gain ramps span one block.
+     */
+    static std::size_t constexpr blockFrames = 256;
+
+    /**
+     * @struct Stats
+     * @brief Counters of the mixer, for benchmarks.
+     */
+    struct Stats {
+        std::size_t played = 0;    // Voices started
+        std::size_t stolen = 0;    // Voices ended early to make room for a new one
+        std::size_t dropped = 0;   // Voices not started, as all voices had a higher priority
+        std::size_t underruns = 0; // Blocks in which a stream had not enough samples ready
+        std::size_t active = 0;    // Voices currently playing
+    };
+
+    /**
+     * @brief Creates a mixer.
+     * @param voiceCount The maximum amount of voices playing at once.
+     */
+    explicit Mixer(std::size_t voiceCount);
+
+    /**
+     * @brief Starts playing a decoded sound.
+     * @param sound The sound to play, kept alive while playing.
+     * @param params The playback parameters.
+     * @return The id of the voice, or std::nullopt if it was dropped.
+     */
+    std::optional<VoiceId> play(std::shared_ptr<Sound const> sound, VoiceParams const& params);
+
+    /**
+     * @brief Starts playing a stream that is filled while playing.
+     * @details The voice ends once the stream is finished and drained.
+     * @param stream The stream to play, its channels must be either mono or stereo.
+     * @param params The playback parameters, pitch is ignored.
+     * @return The id of the voice, or std::nullopt if it was dropped.
+     */
+    std::optional<VoiceId> play(std::shared_ptr<Stream> stream, VoiceParams const& params);
+
+    /**
+     * @brief Changes the parameters of a playing voice.
+     * @return True if the voice is still playing, false otherwise.
+     */
+    bool update(VoiceId id, VoiceParams const& params);
+
+    /**
+     * @brief Stops a voice, fading it out over one block.
+     */
+    void stop(VoiceId id);
+
+    /**
+     * @brief Stops all voices, fading them out over one block.
+     */
+    void stopAll();
+
+    /**
+     * @brief Checks if a voice is still playing.
+     */
+    [[nodiscard]] bool isPlaying(VoiceId id) const;
+
+    /**
+     * @brief Sets the gain applied to all voices.
+     */
+    void setMasterGain(float gain);
+
+    /**
+     * @brief Mixes all voices into the output, overwriting it.
+     * @param output Interleaved stereo samples, clamped to [-1, 1].
+     *               A trailing sample not forming a full frame is set to silence.
+     */
+    void mix(std::span<float> output);
+
+    /**
+     * @brief Gets the counters of the mixer.
+     * @return The current stats.
+     */
+    [[nodiscard]] Stats getStats() const;
+
+private:
+    /**
+     * @struct Voice
+     * @brief State of a voice slot.
+     */
+    struct Voice {
+        std::shared_ptr<Sound const> sound;
+        std::shared_ptr<Stream> stream;
+        VoiceParams params;
+        double position = 0.0;    // Frame of the sound played next
+        float gainLeft = 0.0f;    // Gains reached at the end of the previous block, ramps start here
+        float gainRight = 0.0f;
+        std::uint64_t started = 0; // Order in which voices were started, for stealing
+        std::uint32_t generation = 0;
+        bool active = false;
+        bool stopping = false;    // Fades out during the next block, then ends
+        bool drained = false;     // Source ended during the current block, ends after it
+    };
+
+    /**
+     * @brief Finds a slot for a new voice, stealing one if needed.
+     * @return The index of the slot, or std::nullopt if the voice is dropped.
+     */
+    std::optional<std::size_t> acquire(int priority);
+
+    /**
+     * @brief Starts a voice in an acquired slot.
+     */
+    VoiceId start(std::size_t index, VoiceParams const& params);
+
+    /**
+     * @brief Ends a voice, invalidating its id.
+     */
+    static void release(Voice& voice);
+
+    /**
+     * @brief Gets the voice of an id, if it is still playing.
+     */
+    Voice* find(VoiceId id);
+    [[nodiscard]] Voice const* find(VoiceId id) const;
+
+    /**
+     * @brief Target gains of both output channels for a voice.
+     */
+    [[nodiscard]] std::pair<float, float> targetGains(Voice const& voice) const;
+
+    /**
+     * @brief Mixes all voices into the channel buffers for one block.
+     */
+    void mixBlock(std::size_t frames);
+
+    /**
+     * @brief Renders the source of a voice into the source buffers, resampled to the output rate.
+     * @return True if the source is stereo, false if only the left source buffer was written.
+     */
+    bool renderSound(Voice& voice, std::size_t frames);
+    bool renderStream(Voice& voice, std::size_t frames);
+
+    mutable std::mutex mutex; // Guards all voices and stats
+
+    std::vector<Voice> voices;
+    std::uint64_t startCounter = 0;
+    float masterGain = 1.0f;
+    Stats stats;
+
+    //------------------------------------------
+    // Buffers of one block, reused between blocks
+
+    std::vector<float> mixLeft;
+    std::vector<float> mixRight;
+    std::vector<float> sourceLeft;
+    std::vector<float> sourceRight;
+    std::vector<float> streamSamples; // Interleaved samples read from a stream
+};
+} // namespace Nebulite::Audio
+#endif // NEBULITE_AUDIO_MIXER_HPP
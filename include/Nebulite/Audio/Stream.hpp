@@ -0,0 +1,75 @@
+#ifndef NEBULITE_AUDIO_STREAM_HPP
+#define NEBULITE_AUDIO_STREAM_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+//------------------------------------------
+namespace Nebulite::Audio {
+/**
+ * @class Nebulite::Audio::Stream
+ * @brief Single-producer single-consumer ring of interleaved float samples.
+ * @details A decoder writes samples ahead of time, the mixer reads them while playing.
+ *          Samples are only written and read in whole frames.
+ */
+class Stream {
+public:
+    /**
+     * @brief Creates a stream.
+     * @param channels Channels of each frame.
+     * @param capacityFrames Maximum amount of frames buffered at once.
+     */
+    Stream(std::size_t channels, std::size_t capacityFrames);
+
+    //------------------------------------------
+    // Producer
+
+    /**
+     * @brief Writes as many whole frames as fit.
+     * @param samples Interleaved samples to write.
+     * @return The amount of samples written.
+     */
+    std::size_t write(std::span<float const> samples);
+
+    /**
+     * @brief Gets the amount of samples that can be written right now.
+     */
+    [[nodiscard]] std::size_t writable() const noexcept;
+
+    /**
+     * @brief Marks the end of the stream, no more samples are written afterward.
+     */
+    void finish() noexcept { ended.store(true, std::memory_order_release); }
+
+    //------------------------------------------
+    // Consumer
+
+    /**
+     * @brief Reads as many whole frames as are available.
+     * @param samples Buffer for interleaved samples.
+     * @return The amount of samples read.
+     */
+    std::size_t read(std::span<float> samples);
+
+    /**
+     * @brief Checks if the stream ended and all samples were read.
+     */
+    [[nodiscard]] bool finished() const noexcept;
+
+    [[nodiscard]] std::size_t getChannels() const noexcept { return channels; }
+
+private:
+    std::size_t channels;
+    std::vector<float> buffer;
+    alignas(64) std::atomic<std::size_t> head = 0; // Written by the producer
+    alignas(64) std::atomic<std::size_t> tail = 0; // Written by the consumer
+    std::atomic<bool> ended = false;
+};
+} // namespace Nebulite::Audio
+#endif // NEBULITE_AUDIO_STREAM_HPP
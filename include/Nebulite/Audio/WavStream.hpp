@@ -0,0 +1,98 @@
+#ifndef NEBULITE_AUDIO_WAVSTREAM_HPP
+#define NEBULITE_AUDIO_WAVSTREAM_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// External
+#include <SDL3/SDL_audio.h>
+#include <SDL3/SDL_iostream.h>
+
+// Nebulite
+#include "Nebulite/Audio/Stream.hpp"
+
+//------------------------------------------
+namespace Nebulite::Audio {
+/**
+ * @class Nebulite::Audio::WavStream
+ * @brief Decodes a WAV file incrementally into a Stream, for music too long to decode at once.
+ * @details Only the RIFF header is read on opening. Each pump reads raw chunks of the data section,
+ *          converts them to float at the output rate through an SDL audio stream,
+ *          and tops up the ring until it is full. Looping seeks back to the start of the data section.
+ *          Only the thread pumping may use the decoder, the Stream is shared with the mixer.
+ */
+class WavStream {
+public:
+    /**
+     * @brief Raw bytes read from the file at once.
+     */
+    static std::size_t constexpr chunkBytes = 16384;
+
+    /**
+     * @brief Opens a WAV file for streaming.
+     * @details On failure, the reason is available through SDL_GetError.
+     * @param path The path of the WAV file.
+     * @param sampleRate The output sample rate to convert to.
+     * @param bufferFrames Frames buffered ahead in the stream.
+     * @param loop Whether to restart from the beginning once the end is reached.
+     * @return The decoder, or nullptr if the file could not be opened or is not a supported WAV file.
+     */
+    static std::unique_ptr<WavStream> open(std::string const& path, int sampleRate, std::size_t bufferFrames, bool loop);
+
+    ~WavStream();
+
+    WavStream(WavStream const&) = delete;
+    WavStream& operator=(WavStream const&) = delete;
+    WavStream(WavStream&&) = delete;
+    WavStream& operator=(WavStream&&) = delete;
+
+    /**
+     * @brief Decodes until the stream is full or the file ended.
+     * @details Finishes the stream once all samples were decoded, or on read errors.
+     */
+    void pump();
+
+    /**
+     * @brief Checks if all samples were decoded, the stream may still be playing.
+     */
+    [[nodiscard]] bool done() const noexcept { return ended; }
+
+    [[nodiscard]] std::shared_ptr<Stream> const& getStream() const noexcept { return stream; }
+
+private:
+    WavStream(SDL_IOStream* io, SDL_AudioStream* converter, std::size_t channels, std::size_t bufferFrames, std::size_t frameBytes, std::int64_t dataStart, std::uint64_t dataSize, bool loop);
+
+    /**
+     * @brief Feeds the next raw chunk of the data section into the converter.
+     * @return False if there is nothing left to feed.
+     */
+    bool feed();
+
+    /**
+     * @brief Finishes the stream, no more samples are decoded.
+     */
+    void end();
+
+    SDL_IOStream* io;
+    SDL_AudioStream* converter;
+    std::shared_ptr<Stream> stream;
+    std::size_t frameBytes;   // Bytes of one frame in the file
+    std::int64_t dataStart;   // Offset of the data section in the file
+    std::uint64_t dataSize;   // Bytes in the data section, in whole frames
+    std::uint64_t remaining;  // Bytes of the data section not yet read
+    bool loop;
+    bool flushed = false;     // Whether the converter was told no more data follows
+    bool ended = false;
+
+    std::vector<std::uint8_t> raw;  // Chunk read from the file
+    std::vector<float> converted;   // Samples taken from the converter
+};
+} // namespace Nebulite::Audio
+#endif // NEBULITE_AUDIO_WAVSTREAM_HPP
@@ -79,6 +79,7 @@ struct KeyNames {
         static auto constexpr parseOnGlobal = makeScoped("action.functioncall.global");
         static auto constexpr parseOnSelf   = makeScoped("action.functioncall.self");
         static auto constexpr parseOnOther  = makeScoped("action.functioncall.other");
+        static auto constexpr interactionRadius = makeScoped("broadphase.radius");
     };
 };
 } // namespace Nebulite::Constants
@@ -19,6 +19,7 @@
 
 // Nebulite
 #include "Nebulite/Constants/Event.hpp"
+#include "Nebulite/Data/ComponentPool.hpp"
 #include "Nebulite/Data/RenderObjectContainer.hpp"
 #include "Nebulite/Data/Tiling.hpp"
 #include "Nebulite/Interaction/Execution/Domain.hpp"
@@ -78,6 +79,9 @@ private:
 
     static_assert(allLayers.back() == finalLayer, "Layer ordering changed, please review code.");
 
+    // Hot values of all pooled RenderObjects, declared before the containers to outlive their objects
+    Data::ComponentPool componentPool;
+
     // Inner RenderObject container layers
     std::array<Data::RenderObjectContainer, allLayers.size()> roc;
 
@@ -105,6 +109,18 @@ public:
 
     static auto constexpr layerCount = allLayers.size();
 
+    //------------------------------------------
+    // Component pool
+
+    /**
+     * @brief Gets the pool of hot RenderObject values.
+     * @details Only used by RenderObjects if enabled in the settings, see Settings::Key::componentPool.
+     * @return Reference to the component pool.
+     */
+    Data::ComponentPool& getComponentPool() [[clang::lifetimebound]] {
+        return componentPool;
+    }
+
     //------------------------------------------
     // Special Members
 
@@ -163,8 +179,17 @@ public:
     void updateObjects(std::vector<Data::TileCoordinate> const& tiles, Data::TilingInformation const& tilingInformation, Data::RendererProcessor& rendererProcessor);
 
     /**
-     * @brief Rebuilds the Container structure.
-     * @details Responsible for reinserting all render objects into their respective containers.
+     * @brief Updates all existing tiles accepted by the selection in all layers except the background.
+     * @details Must be called after updateObjects, as it does not advance the deletion of objects.
+     * @param selection Function returning true for each tile to update. Called once per existing tile and layer.
+     * @param tilingInformation Width and height of each tile
+     * @param rendererProcessor the RendererProcessor instance to use for parallel processing of batches.
+     */
+    void updateSelectedObjects(Data::RenderObjectContainer::TileSelection const& selection, Data::TilingInformation const& tilingInformation, Data::RendererProcessor& rendererProcessor);
+
+    /**
+     * @brief Redistributes all objects after a tiling change.
+     * @details Only objects whose tile changed are moved, see RenderObjectContainer::reinsertAllObjects.
      * @param tilingInformation Width and height of each tile
      */
     void reinsertAllObjects(Data::TilingInformation const& tilingInformation);
@@ -118,11 +118,17 @@ public:
     void broadcast(std::shared_ptr<Interaction::Rules::Ruleset> entry);
 
     /**
-     * @brief Listens for rulesets on a specific topic.
+     * @brief Listens for rulesets on a specific topic, for the next update only.
      * @param listener The listener to add.
      */
     void listen(std::shared_ptr<Interaction::Rules::Listener> const& listener);
 
+    /**
+     * @brief Registers a listener persistently, see Interaction::Invoke::subscribe.
+     * @param listener The listener to register.
+     */
+    void subscribe(std::shared_ptr<Interaction::Rules::Listener> const& listener);
+
     //------------------------------------------
     // Getters
 
@@ -5,6 +5,7 @@
 // Includes
 
 // Standard library
+#include <cstddef>
 #include <cstdint> // NOLINT
 #include <memory>
 #include <ranges>
@@ -12,11 +13,9 @@
 #include <string_view>
 #include <vector>
 
-// External
-#include <absl/container/flat_hash_map.h>
-
 // Nebulite
 #include "Nebulite/Constants/Event.hpp"
+#include "Nebulite/Data/Document/DocumentMemoryUsage.hpp"
 #include "Nebulite/Graphics/Drawcall.hpp"
 #include "Nebulite/Interaction/Execution/Domain.hpp"
 #include "Nebulite/Math/Vec2.hpp"
@@ -24,6 +23,10 @@
 //------------------------------------------
 // Forward declarations
 
+namespace Nebulite::Data {
+class ComponentPool;
+} // namespace Nebulite::Data
+
 namespace Nebulite::Interaction::Rules {
 class Ruleset;
 } // namespace Nebulite::Interaction::Rules
@@ -60,6 +63,16 @@ public:
      */
     explicit RenderObject(Utility::Io::Capture& parentCapture);
 
+    /**
+     * @brief Constructs a new RenderObject from a serial or link with commands, see deserialize.
+     * @details Preferred over constructing and deserializing afterward when spawning:
+     *          the standard document, its drawcalls and the initial update are skipped, as they would be replaced anyway.
+     *          Linked files are copied from their parsed form in the document cache.
+     * @param parentCapture The capture to inherit from.
+     * @param serialOrLink The JSON string or link to deserialize, optionally followed by commands.
+     */
+    RenderObject(Utility::Io::Capture& parentCapture, std::string const& serialOrLink);
+
     /**
      * @brief Destroys the RenderObject.
      *        Cleans up any resources used by the RenderObject, including
@@ -75,6 +88,20 @@ public:
     RenderObject(RenderObject&&) = delete;
     RenderObject& operator=(RenderObject&&) = delete;
 
+    //------------------------------------------
+    // Pooled allocation
+
+    static auto constexpr slabPoolName = "renderObject";
+
+    /**
+     * @brief Allocates RenderObjects from a SlabPool.
+     * @details Objects are deleted in batches through the container purgatory,
+     *          freeing their slots for the next spawned objects.
+     */
+    static void* operator new(std::size_t size);
+
+    static void operator delete(void* ptr, std::size_t size) noexcept;
+
     //------------------------------------------
     // Serializing/Deserializing
 
@@ -102,6 +129,15 @@ public:
         return domainScope;
     }
 
+    /**
+     * @brief Estimates the heap memory used by the document of the RenderObject.
+     * @details Only call while no ordered cache lists are requested, e.g. outside the update.
+     * @return The estimated memory usage, broken down by component.
+     */
+    [[nodiscard]] Data::DocumentMemoryUsage getDocumentMemoryUsage() const {
+        return domainScope.getDocumentMemoryUsage();
+    }
+
     //------------------------------------------
     // Get position/layer
 
@@ -176,7 +212,7 @@ public:
      * @return A vector of strings containing the names of all active drawcalls
      */
     auto listDrawcalls() {
-        return drawcalls | std::views::keys;
+        return drawcalls | std::views::transform([](DrawcallEntry const& entry) -> std::string const& { return entry.name; });
     }
 
     /**
@@ -202,16 +238,30 @@ private:
     //------------------------------------------
     // Private draw call management
 
-    absl::flat_hash_map<std::string, std::shared_ptr<Graphics::Drawcall>> drawcalls;
+    /**
+     * @struct DrawcallEntry
+     * @brief A named drawcall, owned by pointer as drawcalls are bound to their own address.
+     */
+    struct DrawcallEntry {
+        std::string name;
+        std::unique_ptr<Graphics::Drawcall> drawcall;
+    };
 
-    // Reference to members in hashmap sorted by their draw order
-    std::vector<std::string> drawcallOrder;
+    // All drawcalls, sorted by their draw order so drawing and updating is a single pass
+    std::vector<DrawcallEntry> drawcalls;
 
     /**
      * @brief Sorts all drawcalls alphabetically
      */
     void sortDrawcalls();
 
+    /**
+     * @brief Finds a drawcall entry by name
+     * @param drawcallName The name of the drawcall
+     * @return Iterator to the entry, or the end of drawcalls if not found
+     */
+    std::vector<DrawcallEntry>::iterator findDrawcall(std::string_view drawcallName);
+
     /**
      * @brief Updates all drawcalls and their associated texture
      */
@@ -234,6 +284,24 @@ private:
      * @brief Links frequently used references from the JSON document for quick access.
      */
     void linkFrequentRefs();
+
+    //------------------------------------------
+    // Component pool
+
+    /**
+     * @struct ComponentSlot
+     * @brief The slot holding the hot values of this object, if pooled.
+     */
+    struct ComponentSlot {
+        Data::ComponentPool* pool = nullptr; // nullptr if values live in the document cache
+        std::size_t index = 0;
+    } componentSlot{};
+
+    /**
+     * @brief Binds the hot values of the document to a slot in the environments component pool, if enabled.
+     * @details Must be called before any stable double pointer is handed out.
+     */
+    void acquireComponentSlot();
 };
 } // namespace Nebulite::Core
 #endif // NEBULITE_CORE_RENDEROBJECT_HPP
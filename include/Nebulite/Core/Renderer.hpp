@@ -5,6 +5,7 @@
 // Includes
 
 // Standard library
+#include <array>
 #include <cstddef>
 #include <cstdint> // NOLINT
 #include <functional>
@@ -24,7 +25,9 @@
 // Nebulite
 #include "Nebulite/Constants/Event.hpp"
 #include "Nebulite/Core/Environment.hpp"
+#include "Nebulite/Data/ComponentPool.hpp"
 #include "Nebulite/Data/Tiling.hpp"
+#include "Nebulite/Graphics/TextCache.hpp"
 #include "Nebulite/Interaction/Execution/Domain.hpp"
 #include "Nebulite/Utility/TimeKeeper.hpp"
 
@@ -98,6 +101,14 @@ public:
      */
     std::optional<std::size_t> getIndexFromId(std::size_t searchId) const ;
 
+    /**
+     * @brief Gets the pool of hot RenderObject values of the environment.
+     * @return Reference to the component pool.
+     */
+    Data::ComponentPool& getComponentPool() [[clang::lifetimebound]] {
+        return env.getComponentPool();
+    }
+
     //------------------------------------------
     // Pipeline
 
@@ -303,6 +314,21 @@ public:
      */
     [[nodiscard]] std::int16_t getTilePositionY() const noexcept { return cameraTilePosition.y; }
 
+    /**
+     * @brief Tile counts of the last object update, summed over all updated layers.
+     */
+    struct SimulationInfo {
+        std::size_t nearTiles = 0;           // Tile positions around the camera, updated every frame
+        std::size_t distantTiles = 0;        // Existing tiles outside the near area and within the distant radius
+        std::size_t distantTilesUpdated = 0; // Distant tiles that were due for an update
+    };
+
+    /**
+     * @brief Gets information about the simulation level of detail of the last update.
+     * @return The tile counts of the last update.
+     */
+    [[nodiscard]] SimulationInfo const& getSimulationInfo() const noexcept { return simulationInfo; }
+
     /**
      * @brief Gets the SDL_Renderer instance.
      *        Allows for access to the underlying SDL renderer for custom rendering operations.
@@ -324,6 +350,12 @@ public:
      */
     [[nodiscard]] TTF_Font* getStandardFont() const { return font; }
 
+    /**
+     * @brief Gets the cache used to render text drawcalls.
+     * @return A reference to the TextCache instance.
+     */
+    [[nodiscard]] Graphics::TextCache& getTextCache() noexcept { return textCache; }
+
     /**
      * @brief Gets the current window scale factor.
      */
@@ -488,6 +520,44 @@ private:
      */
     Data::TileCoordinate cameraTilePosition;
 
+    //------------------------------------------
+    // Simulation level of detail
+
+    /**
+     * @brief Gets the number of tiles from the camera tile to the edge of the visible area.
+     * @return A pair of the tile count in x and y direction.
+     */
+    [[nodiscard]] std::pair<int, int> visibleTileExtent() const ;
+
+    /**
+     * @brief Gets all tiles within the given distance of the camera tile.
+     * @param wCount The number of tiles in x direction on each side of the camera tile.
+     * @param hCount The number of tiles in y direction on each side of the camera tile.
+     * @return A vector of TileCoordinates around the camera tile.
+     */
+    [[nodiscard]] std::vector<Data::TileCoordinate> tilesAroundCamera(int wCount, int hCount) const ;
+
+    /**
+     * @brief Updates all objects: tiles near the camera every frame, distant tiles at a reduced rate.
+     * @details Distant tiles are spread across the interval by their position,
+     *          so each frame only updates a fraction of them.
+     *          When updated, they are simulated with the delta time accumulated since their last update.
+     */
+    void updateObjects();
+
+    struct SimulationSchedule {
+        // Upper bound for the distant interval setting
+        static std::uint16_t constexpr maxDistantInterval = 64;
+
+        // Simulation delta time of the last frames, indexed by frame modulo maxDistantInterval
+        std::array<double, maxDistantInterval> deltaTimes{};
+
+        // Number of object updates so far
+        std::uint64_t frame = 0;
+    } simulationSchedule;
+
+    SimulationInfo simulationInfo;
+
     // Custom Subclasses
     Environment env;
 
@@ -567,6 +637,9 @@ private:
     // General font
     TTF_Font* font{};
 
+    // Glyph atlases and rendered strings of text drawcalls
+    Graphics::TextCache textCache;
+
     /**
      * @brief Loads fonts for the Renderer.
      */
@@ -69,6 +69,10 @@ public:
      * @param externalTexture Pointer to the external SDL_Texture.
      */
     void linkExternalTexture(SDL_Texture* externalTexture) {
+        // Destroy any old internal texture if it was modified
+        if (texture != nullptr && textureStoredLocally && texture != externalTexture) {
+            SDL_DestroyTexture(texture);
+        }
         texture = externalTexture;
         textureStoredLocally = false; // Reset modification flag
     }
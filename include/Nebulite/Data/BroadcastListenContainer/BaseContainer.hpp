@@ -5,32 +5,32 @@
 // Includes
 
 // Standard library
-#include <atomic>
 #include <cstddef>
 #include <memory>
 
-// Nebulite
-#include "Nebulite/Utility/Coordination/WorkDispatcher.hpp"
-
 //------------------------------------------
 // Forward declarations
 
 namespace Nebulite::Interaction::Rules {
 class Ruleset;
-struct Listener;
 } // namespace Nebulite::Interaction::Rules
 
+namespace Nebulite::Data::BroadcastListenContainer {
+class SubscriptionRegistry;
+} // namespace Nebulite::Data::BroadcastListenContainer
+
 //------------------------------------------
 namespace Nebulite::Data::BroadcastListenContainer {
 /**
  * @brief Interface Class to manage broadcast-listen pairs of rulesets.
  * @details If a hashmap is used in the implementation, using Data::MapType is recommended.
- * @tparam DerivedContainer The type of the derived container class, required as argument of the WorkDispatcher to use as workspace reference.
+ *          Containers own no threads, process() is called as a job of the shared TaskScheduler.
+ * @tparam DerivedContainer The type of the derived container class.
  */
 template<typename DerivedContainer>
 class BaseContainer {
 public:
-    explicit BaseContainer(std::atomic<bool>& stopFlag, std::size_t workerIndex, std::size_t workerCount, DerivedContainer container);
+    explicit BaseContainer(std::size_t workerIndex, std::size_t workerCount);
 
     virtual ~BaseContainer();
 
@@ -39,13 +39,6 @@ public:
     BaseContainer(BaseContainer&&) = delete;
     BaseContainer& operator=(BaseContainer&&) = delete;
 
-    //------------------------------------------
-    // Worker thread access
-
-    void startWork();
-
-    void waitForWorkFinished();
-
     //------------------------------------------
     // Container Methods to be implemented by derived classes
 
@@ -55,12 +48,6 @@ public:
      */
     virtual void broadcast(std::shared_ptr<Interaction::Rules::Ruleset>&& entry);
 
-    /**
-     * @brief Listens for rulesets on a specific topic.
-     * @param listener The listener to add.
-     */
-    virtual void listen(std::shared_ptr<Interaction::Rules::Listener>&& listener);
-
     /**
      * @brief Prepare container for next processing round.
      */
@@ -68,7 +55,14 @@ public:
 
     // non-static hooks for derived classes to implement
     virtual void init();
-    virtual void process();
+
+    /**
+     * @brief Processes all broadcast-listen pairs of this container.
+     * @details Called once per frame, concurrently for all containers.
+     *          Listeners are shared by all containers and registered persistently, see SubscriptionRegistry.
+     * @param subscriptions The prepared registry of all listeners, read-only during processing.
+     */
+    virtual void process(SubscriptionRegistry const& subscriptions);
 
 protected:
     struct WorkerInfo {
@@ -77,14 +71,7 @@ protected:
     } workerInfo;
 
 private:
-    // static wrappers for WorkDispatcher
-    static void initImpl(DerivedContainer container);
-    static void processImpl(DerivedContainer container);
-
     static void verifyCacheLookupIndex();
-
-    // store WorkDispatcher with container reference
-    Utility::Coordination::WorkDispatcher<DerivedContainer> dispatcher;
 };
 } // namespace Nebulite::Data::BroadcastListenContainer
 #include "Nebulite/Data/BroadcastListenContainer/BaseContainer.tpp" // NOLINT(misc-include-cleaner)
@@ -5,7 +5,6 @@
 // Includes
 
 // Standard library
-#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <stdexcept>
@@ -24,30 +23,15 @@
 namespace Nebulite::Data::BroadcastListenContainer {
 
 template<typename DerivedContainer>
-BaseContainer<DerivedContainer>::BaseContainer(std::atomic<bool>& stopFlag, std::size_t const workerIndex, std::size_t const workerCount, DerivedContainer container)
+BaseContainer<DerivedContainer>::BaseContainer(std::size_t const workerIndex, std::size_t const workerCount)
     : workerInfo{.index=workerIndex, .count=workerCount}
-    , dispatcher(stopFlag, processImpl, initImpl)
 {
-    dispatcher.workspace = container;
     verifyCacheLookupIndex();
 }
 
 template<typename DerivedContainer>
 BaseContainer<DerivedContainer>::~BaseContainer() = default;
 
-//------------------------------------------
-// Worker thread access
-
-template<typename DerivedContainer>
-void BaseContainer<DerivedContainer>::startWork() {
-    dispatcher.startWork();
-}
-
-template<typename DerivedContainer>
-void BaseContainer<DerivedContainer>::waitForWorkFinished() {
-    dispatcher.waitForWorkFinished();
-}
-
 //------------------------------------------
 // Container Methods to be implemented by derived classes
 
@@ -61,16 +45,6 @@ void BaseContainer<DerivedContainer>::broadcast(std::shared_ptr<Interaction::Rul
     auto local = std::move(entry); // NOLINT
 }
 
-/**
- * @brief Listens for rulesets on a specific topic.
- * @param listener The listener to add.
- */
-template<typename DerivedContainer>
-void BaseContainer<DerivedContainer>::listen(std::shared_ptr<Interaction::Rules::Listener>&& listener) {
-    // explicit consumption
-    auto local = std::move(listener); // NOLINT
-}
-
 /**
  * @brief Prepare container for next processing round.
  */
@@ -81,13 +55,7 @@ template<typename DerivedContainer>
 void BaseContainer<DerivedContainer>::init() {}
 
 template<typename DerivedContainer>
-void BaseContainer<DerivedContainer>::process() {}
-
-template<typename DerivedContainer>
-void BaseContainer<DerivedContainer>::initImpl(DerivedContainer container) { container->init(); }
-
-template<typename DerivedContainer>
-void BaseContainer<DerivedContainer>::processImpl(DerivedContainer container) { container->process(); }
+void BaseContainer<DerivedContainer>::process(SubscriptionRegistry const& /*subscriptions*/) {}
 
 template<typename DerivedContainer>
 void BaseContainer<DerivedContainer>::verifyCacheLookupIndex() {
@@ -6,17 +6,24 @@
 
 // Standard library
 #include <array>
-#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <span>
+#include <string>
 #include <utility>
+#include <vector>
+
+// External
+#include <absl/container/flat_hash_map.h>
 
 // Nebulite
 #include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Data/BroadcastListenContainer/BaseContainer.hpp"
 #include "Nebulite/Data/BroadcastListenContainer/MapType.hpp"
+#include "Nebulite/Data/BroadcastListenContainer/SpatialGrid.hpp"
+#include "Nebulite/Data/BroadcastListenContainer/SubscriptionRegistry.hpp"
 
 //------------------------------------------
 // Forward declarations
@@ -38,11 +45,57 @@ template <FlatContainerType Type>
 class FlatContainer;
 
 class FlatContainerBase {
-    // rendererWorkerCount should be enough, but if we decide that rulesets are able to directly broadcast/listen, we need one slot for each thread!
-    static auto constexpr activeWorkerCount = Constants::ThreadSettings::Maximum::rendererWorkerCount;
+    // One slot per thread that may broadcast during object updates:
+    // all TaskScheduler workers, plus the submitting main thread
+    static auto constexpr activeWorkerCount = Constants::ThreadSettings::Maximum::invokeWorkerCount + 1;
 
     std::array<MapType<Interaction::Rules::Ruleset>, activeWorkerCount> broadcasters = {};
-    std::array<MapType<Interaction::Rules::Listener>, activeWorkerCount> listeners = {};
+
+    /**
+     * @brief Spatial broad-phase of a single topic, holding all rulesets that opted into it.
+     * @details Built lazily once per processing round, only if the topic has any such rulesets.
+     */
+    struct BroadphaseTopic {
+        SpatialGrid grid;
+        std::vector<Interaction::Rules::Ruleset*> rulesets; // Indexed by grid entry index
+        bool prepared = false;
+    };
+
+    absl::flat_hash_map<std::string, BroadphaseTopic> broadphaseTopics;
+
+    /**
+     * @brief Builds the broad-phase grid of a topic, if not done yet in this processing round.
+     * @param topic The topic to prepare.
+     * @return Pointer to the broad-phase of the topic, or nullptr if no ruleset of this topic uses it.
+     */
+    BroadphaseTopic* prepareBroadphase(std::string const& topic);
+
+    /**
+     * @brief Resets all broad-phase grids for the next processing round.
+     */
+    void clearBroadphase();
+
+    /**
+     * @brief Evaluates a single broadcaster-listener pair, applying the ruleset if its condition holds.
+     * @param ruleset The broadcasted ruleset.
+     * @param listener The listener.
+     */
+    static void invokePair(Interaction::Rules::Ruleset& ruleset, std::shared_ptr<Interaction::Rules::Listener> const& listener);
+
+    /**
+     * @brief Evaluates a ruleset for multiple listeners at once, applying it to all listeners whose condition holds.
+     * @details See Interaction::Rules::Ruleset::evaluateConditionBatch.
+     * @param ruleset The broadcasted ruleset.
+     * @param listeners The listeners.
+     */
+    static void invokeBatch(Interaction::Rules::Ruleset& ruleset, std::span<std::shared_ptr<Interaction::Rules::Listener> const> listeners);
+
+    /**
+     * @brief Applies all rulesets of the broad-phase that are in range of the listener.
+     * @param broadphase The broad-phase of the listeners topic.
+     * @param listener The listener.
+     */
+    static void invokeBroadphase(BroadphaseTopic& broadphase, std::shared_ptr<Interaction::Rules::Listener> const& listener);
 
 public:
     struct Settings {
@@ -56,17 +109,20 @@ public:
     Settings const& settings;
 
     void broadcast(std::shared_ptr<Interaction::Rules::Ruleset>&& entry);
-    void listen(std::shared_ptr<Interaction::Rules::Listener>&& listener);
 
     /**
      * @brief Uses the provided offsets to process all broadcasted rulesets.
+     * @details Rulesets with an interaction radius are only evaluated for listeners in range, see SpatialGrid.
+     * @param subscriptions The prepared registry of all listeners.
      */
-    void processWithOffset();
+    void processWithOffset(SubscriptionRegistry const& subscriptions);
 
     /**
      * @brief Ignores settings and processes all broadcasted rulesets without any rotation or offset.
+     * @details Rulesets with an interaction radius are only evaluated for listeners in range, see SpatialGrid.
+     * @param subscriptions The prepared registry of all listeners.
      */
-    void processNoOffset();
+    void processNoOffset(SubscriptionRegistry const& subscriptions);
 
     explicit FlatContainerBase([[clang::lifetimebound]] Settings const& s) : settings(s) {}
 };
@@ -81,8 +137,8 @@ public:
 template <FlatContainerType Type>
 class FlatContainer final : public BaseContainer<FlatContainer<Type>*> {
 public:
-    explicit FlatContainer(std::atomic<bool>& stopFlag, std::size_t workerIndex, std::size_t workerCount)
-        : BaseContainer<FlatContainer*>(stopFlag, workerIndex, workerCount, this) {
+    explicit FlatContainer(std::size_t workerIndex, std::size_t workerCount)
+        : BaseContainer<FlatContainer*>(workerIndex, workerCount) {
         FlatContainerBase::Settings settings{};
 
         if constexpr (Type == FlatContainerType::applyOffset) { // Set offsets based on worker index
@@ -122,14 +178,6 @@ public:
         base->broadcast(std::move(entry)); // NOLINT
     }
 
-    /**
-     * @brief Listens for rulesets on a specific topic.
-     * @param listener The listener to add.
-     */
-    void listen(std::shared_ptr<Interaction::Rules::Listener>&& listener) override {
-        base->listen(std::move(listener)); // NOLINT
-    }
-
     /**
      * @brief Empty, no preparation needed for this container type
      */
@@ -142,14 +190,15 @@ public:
 
     /**
      * @brief Processes all broadcasted rulesets,
-     *        matching them with listeners and executing the appropriate actions.
+     *        matching them with the active listeners of their topic and executing the appropriate actions.
+     * @param subscriptions The prepared registry of all listeners.
      */
-    void process() override {
+    void process(SubscriptionRegistry const& subscriptions) override {
         if constexpr (Type == FlatContainerType::noOffset) {
-            base->processNoOffset(); // NOLINT
+            base->processNoOffset(subscriptions); // NOLINT
         }
         else {
-            base->processWithOffset(); // NOLINT
+            base->processWithOffset(subscriptions); // NOLINT
         }
     }
 
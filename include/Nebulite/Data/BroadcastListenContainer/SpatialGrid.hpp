@@ -0,0 +1,147 @@
+#ifndef NEBULITE_DATA_BROADCASTLISTENCONTAINER_SPATIALGRID_HPP
+#define NEBULITE_DATA_BROADCASTLISTENCONTAINER_SPATIALGRID_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <type_traits>
+#include <vector>
+
+// External
+#include <absl/container/flat_hash_map.h>
+
+//------------------------------------------
+namespace Nebulite::Data::BroadcastListenContainer {
+/**
+ * @class SpatialGrid
+ * @brief Uniform grid over axis-aligned bounding boxes, used as spatial broad-phase for broadcast-listen pairs.
+ * @details Entries are inserted with their bounding box and identified by their insertion index.
+ *          After building, queries report every entry whose box overlaps the queried box exactly once.
+ *          The cell size adapts to the average entry extent on each build.
+ */
+class SpatialGrid {
+public:
+    struct Aabb {
+        double minX;
+        double minY;
+        double maxX;
+        double maxY;
+    };
+
+    /**
+     * @brief Maximum number of cells a single entry or query may cover.
+     * @details Entries above this are stored as oversized entries and tested on every query,
+     *          queries above this test all entries directly.
+     */
+    static std::size_t constexpr maxCellsPerEntry = 1024;
+
+    /**
+     * @brief Removes all entries, keeping allocated memory for the next round.
+     */
+    void clear();
+
+    /**
+     * @brief Adds an entry to the grid. Its index is the number of entries inserted before it.
+     * @param box The bounding box of the entry.
+     */
+    void insert(Aabb const& box);
+
+    /**
+     * @brief Sorts all inserted entries into their cells. Must be called before querying.
+     */
+    void build();
+
+    /**
+     * @brief Calls the provided function once for every entry overlapping the given box.
+     * @tparam Func The function type, invocable with the entry index.
+     * @param box The box to query.
+     * @param func The function to call.
+     */
+    template<typename Func>
+    void query(Aabb const& box, Func&& func) {
+        static_assert(std::is_invocable_v<Func, std::size_t>, "Function must be invocable with (std::size_t)");
+
+        // Huge query boxes: testing all entries is cheaper than walking the cells
+        CellRange const range = cellRange(box);
+        if (range.count() > maxCellsPerEntry) {
+            for (std::size_t idx = 0; idx < boxes.size(); idx++) {
+                if (overlaps(boxes[idx], box)) {
+                    func(idx);
+                }
+            }
+            return;
+        }
+
+        nextStamp();
+        for (std::size_t const idx : oversized) {
+            if (overlaps(boxes[idx], box)) {
+                func(idx);
+            }
+        }
+        for (std::int32_t y = range.minY; y <= range.maxY; y++) {
+            for (std::int32_t x = range.minX; x <= range.maxX; x++) {
+                auto const it = cells.find(cellKey(x, y));
+                if (it == cells.end()) continue;
+                for (std::size_t const idx : it->second) {
+                    if (stamps[idx] == currentStamp) continue;
+                    stamps[idx] = currentStamp;
+                    if (overlaps(boxes[idx], box)) {
+                        func(idx);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of inserted entries.
+     * @return The entry count.
+     */
+    [[nodiscard]] std::size_t size() const { return boxes.size(); }
+
+private:
+    struct CellRange {
+        std::int32_t minX;
+        std::int32_t minY;
+        std::int32_t maxX;
+        std::int32_t maxY;
+
+        [[nodiscard]] std::size_t count() const {
+            return static_cast<std::size_t>(maxX - minX + 1) * static_cast<std::size_t>(maxY - minY + 1);
+        }
+    };
+
+    static bool overlaps(Aabb const& a, Aabb const& b) {
+        return a.minX <= b.maxX && b.minX <= a.maxX && a.minY <= b.maxY && b.minY <= a.maxY;
+    }
+
+    static std::uint64_t cellKey(std::int32_t const x, std::int32_t const y) {
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32U | static_cast<std::uint32_t>(y);
+    }
+
+    [[nodiscard]] std::int32_t cellCoordinate(double value) const ;
+
+    [[nodiscard]] CellRange cellRange(Aabb const& box) const ;
+
+    void nextStamp();
+
+    double inverseCellSize = 1.0;
+
+    // Bounding boxes of all entries, by insertion index
+    std::vector<Aabb> boxes;
+
+    // Entries covering too many cells
+    std::vector<std::size_t> oversized;
+
+    // Cell key -> entries overlapping that cell
+    absl::flat_hash_map<std::uint64_t, std::vector<std::size_t>> cells;
+
+    // Per-entry marker of the last query that reported it, avoiding duplicates for entries spanning multiple cells
+    std::vector<std::uint32_t> stamps;
+    std::uint32_t currentStamp = 0;
+};
+} // namespace Nebulite::Data::BroadcastListenContainer
+#endif // NEBULITE_DATA_BROADCASTLISTENCONTAINER_SPATIALGRID_HPP
@@ -0,0 +1,106 @@
+#ifndef NEBULITE_DATA_BROADCASTLISTENCONTAINER_SUBSCRIPTIONREGISTRY_HPP
+#define NEBULITE_DATA_BROADCASTLISTENCONTAINER_SUBSCRIPTIONREGISTRY_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// External
+#include <absl/container/flat_hash_map.h>
+
+//------------------------------------------
+// Forward declarations
+
+namespace Nebulite::Interaction::Rules {
+struct Listener;
+} // namespace Nebulite::Interaction::Rules
+
+//------------------------------------------
+namespace Nebulite::Data::BroadcastListenContainer {
+/**
+ * @class SubscriptionRegistry
+ * @brief Persistent registry of all listeners, grouped by interned topic id.
+ * @details Listeners are registered once and stay in the stable array of their topic until they unsubscribe.
+ *          Each frame, a listener only marks itself active, see Interaction::Rules::Listener::activate.
+ *          Before processing, prepare() moves all active listeners of a topic to the front of its array,
+ *          so containers iterate one contiguous span per topic without rebuilding any maps.
+ */
+class SubscriptionRegistry {
+public:
+    using TopicId = std::uint32_t;
+
+    /**
+     * @struct Topic
+     * @brief All listeners subscribed to a single topic.
+     */
+    struct Topic {
+        std::string name;
+        std::vector<std::shared_ptr<Interaction::Rules::Listener>> listeners;
+        std::size_t activeCount = 0;
+
+        /**
+         * @brief Gets all listeners that were active in the last frame.
+         * @details Only valid after prepare() and until the next subscription.
+         */
+        [[nodiscard]] std::span<std::shared_ptr<Interaction::Rules::Listener> const> activeListeners() const {
+            return std::span(listeners).first(activeCount);
+        }
+    };
+
+    /**
+     * @brief Registers a listener on its topic until it unsubscribes.
+     * @details Thread-safe. Must not be called while containers are processing.
+     * @param listener The listener to register.
+     */
+    void subscribe(std::shared_ptr<Interaction::Rules::Listener> const& listener);
+
+    /**
+     * @brief Registers a listener for the next processing round only.
+     * @details Thread-safe. Must not be called while containers are processing.
+     * @param listener The listener to register, active for the next round.
+     */
+    void listenOnce(std::shared_ptr<Interaction::Rules::Listener> const& listener);
+
+    /**
+     * @brief Prepares all topics for the next processing round.
+     * @details Moves active listeners to the front of each topic, resetting their active flag,
+     *          and drops listeners that are neither active nor subscribed anymore.
+     *          Must not be called concurrently with any other method.
+     */
+    void prepare();
+
+    /**
+     * @brief Gets all topics, indexable with their id.
+     */
+    [[nodiscard]] std::span<Topic const> getTopics() const { return topics; }
+
+private:
+    /**
+     * @brief Adds a listener to its topic, assigning the topic id.
+     * @details Requires the lock to be held.
+     */
+    void add(std::shared_ptr<Interaction::Rules::Listener> const& listener);
+
+    /**
+     * @brief Gets the id of a topic, creating it if needed.
+     * @details Requires the lock to be held.
+     * @param topic The topic name.
+     * @return The interned id of the topic, stable for the lifetime of the registry.
+     */
+    TopicId intern(std::string_view topic);
+
+    std::vector<Topic> topics;
+    absl::flat_hash_map<std::string, TopicId> topicIds;
+    std::mutex mtx;
+};
+} // namespace Nebulite::Data::BroadcastListenContainer
+#endif // NEBULITE_DATA_BROADCASTLISTENCONTAINER_SUBSCRIPTIONREGISTRY_HPP
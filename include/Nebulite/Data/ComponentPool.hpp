@@ -0,0 +1,140 @@
+#ifndef NEBULITE_DATA_COMPONENTPOOL_HPP
+#define NEBULITE_DATA_COMPONENTPOOL_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <array>
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+// Nebulite
+#include "Nebulite/Data/Document/ScopedKeyView.hpp"
+
+//------------------------------------------
+// Forward declarations
+
+namespace Nebulite::Data {
+class JsonScope;
+} // namespace Nebulite::Data
+
+//------------------------------------------
+namespace Nebulite::Data {
+/**
+ * @class ComponentPool
+ * @brief Dense struct-of-arrays storage for frequently accessed RenderObject values.
+ * @details Each object acquires a slot, and the stable double pointers of all well-known keys of its document
+ *          are bound to that slot, see Json::bindExternalDouble. The values of all objects then live in one contiguous
+ *          column per component, while access through the document and through ordered cache lists keeps working.
+ *          Columns are allocated in fixed-size blocks, so pointers into the pool stay valid when it grows.
+ *          Released slots are reset to 0 and reused, so loops may run over all handed out slots of a block.
+ */
+class ComponentPool {
+public:
+    /**
+     * @enum Component
+     * @brief The values stored in the pool, one column each.
+     */
+    enum class Component : std::uint8_t {
+        // Position and size
+        posX,
+        posY,
+        sizeX,
+        sizeY,
+        // Physics
+        physics_aX,
+        physics_aY,
+        physics_vX,
+        physics_vY,
+        physics_mass,
+        physics_FX,
+        physics_FY,
+    };
+
+    static std::size_t constexpr componentCount = static_cast<std::size_t>(Component::physics_FY) + 1;
+
+    /**
+     * @brief Number of slots per block.
+     */
+    static std::size_t constexpr blockSize = 1024;
+
+    /**
+     * @struct Block
+     * @brief A fixed number of slots, stored as one column per component.
+     */
+    struct Block {
+        alignas(64) std::array<std::array<double, blockSize>, componentCount> columns = {};
+
+        std::span<double, blockSize> column(Component const c) noexcept {
+            return columns[static_cast<std::size_t>(c)];
+        }
+    };
+
+    /**
+     * @brief Returns the document keys of all components, indexable with Component.
+     */
+    static std::array<ScopedKeyView, componentCount> const& keys();
+
+    /**
+     * @brief Acquires a slot, reusing released slots first.
+     * @details Thread-safe.
+     * @return The slot index, all values are 0.
+     */
+    std::size_t acquire();
+
+    /**
+     * @brief Releases a slot, resetting all its values to 0.
+     * @details Thread-safe. Values of the slot must not be accessed afterward.
+     * @param slot The slot to release.
+     */
+    void release(std::size_t slot);
+
+    /**
+     * @brief Binds all component keys of a document to a slot.
+     * @details Must be called before any stable double pointer of these keys is handed out.
+     * @param scope The document scope to bind, usually the domain scope of a RenderObject.
+     * @param slot The slot to bind to.
+     */
+    void bind(JsonScope& scope, std::size_t slot);
+
+    /**
+     * @brief Gets the storage of a single value.
+     * @param c The component.
+     * @param slot The slot.
+     * @return Pointer to the value, stable for the lifetime of the pool.
+     */
+    double* value(Component c, std::size_t slot);
+
+    /**
+     * @brief Calls a function for each block, together with the number of handed out slots in it.
+     * @details Not thread-safe, must not be called while slots are acquired or released.
+     *          Slots in the range may be unused, their values are 0.
+     * @param function The function to call, taking a Block& and the number of slots to process.
+     */
+    template <typename Function>
+    void forEachBlock(Function&& function) {
+        for (std::size_t i = 0; i < blocks.size(); i++) {
+            std::size_t const begin = i * blockSize;
+            std::size_t const count = nextSlot - begin < blockSize ? nextSlot - begin : blockSize;
+            function(*blocks[i], count);
+        }
+    }
+
+    /**
+     * @brief Gets the number of slots currently in use.
+     */
+    [[nodiscard]] std::size_t size() const ;
+
+private:
+    std::vector<std::unique_ptr<Block>> blocks;
+    std::vector<std::size_t> freeSlots;
+    std::size_t nextSlot = 0;
+    mutable std::mutex mtx;
+};
+} // namespace Nebulite::Data
+#endif // NEBULITE_DATA_COMPONENTPOOL_HPP
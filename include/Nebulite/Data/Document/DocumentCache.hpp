@@ -18,6 +18,13 @@
 #include "Nebulite/Data/Document/ReadOnlyDocs.hpp"
 #include "Nebulite/Data/Document/SimpleValueError.hpp"
 
+//------------------------------------------
+// Forward declarations
+
+namespace Nebulite::Data {
+class JsonScope;
+} // namespace Nebulite::Data
+
 //------------------------------------------
 namespace Nebulite::Data {
 /**
@@ -97,6 +104,16 @@ public:
      */
     std::string getDocString(std::string_view link) const ;
 
+    /**
+     * @brief Replaces the content of a scope with an entire cached document.
+     * @details Copies the already parsed document, so loading the same file repeatedly
+     *          skips reading, comment stripping and parsing, e.g. when spawning many objects of one file.
+     * @param link The link to the document.
+     * @param target The scope to replace the content of.
+     * @return True if the document was copied, false if it could not be loaded.
+     */
+    bool copyDocInto(std::string_view link, JsonScope& target) const ;
+
 private:
     /**
      * @brief Read-only document cache.
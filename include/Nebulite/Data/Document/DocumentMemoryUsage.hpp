@@ -0,0 +1,35 @@
+#ifndef NEBULITE_DATA_DOCUMENT_DOCUMENTMEMORYUSAGE_HPP
+#define NEBULITE_DATA_DOCUMENT_DOCUMENTMEMORYUSAGE_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+
+//------------------------------------------
+namespace Nebulite::Data {
+/**
+ * @struct DocumentMemoryUsage
+ * @brief Estimated heap memory of a Json document in bytes, broken down by component.
+ */
+struct DocumentMemoryUsage {
+    std::size_t document = 0;          // The Json object and its rapidjson values
+    std::size_t cache = 0;             // Cache entries, their map and the sorted key index
+    std::size_t cacheLine = 0;         // Pre-allocated double storage for stable pointers
+    std::size_t orderedCacheLists = 0; // Ordered cache lists, see MappedOrderedCacheList
+
+    [[nodiscard]] std::size_t total() const noexcept {
+        return document + cache + cacheLine + orderedCacheLists;
+    }
+
+    DocumentMemoryUsage& operator+=(DocumentMemoryUsage const& other) noexcept {
+        document += other.document;
+        cache += other.cache;
+        cacheLine += other.cacheLine;
+        orderedCacheLists += other.orderedCacheLists;
+        return *this;
+    }
+};
+} // namespace Nebulite::Data
+#endif // NEBULITE_DATA_DOCUMENT_DOCUMENTMEMORYUSAGE_HPP
@@ -6,14 +6,21 @@
 
 // Standard library
 #include <array>
+#include <atomic>
+#include <complex>
 #include <cstddef>
 #include <cstdint> // NOLINT
 #include <expected>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 // External
@@ -21,9 +28,11 @@
 #include <rapidjson/document.h>
 
 // Nebulite
+#include "Nebulite/Data/Document/DocumentMemoryUsage.hpp"
 #include "Nebulite/Data/Document/KeyType.hpp"
 #include "Nebulite/Data/Document/RjDirectAccess.hpp"
 #include "Nebulite/Data/Document/SimpleValueError.hpp"
+#include "Nebulite/Data/MappedOrderedCacheList.hpp"
 #include "Nebulite/Utility/CompileTimeEvaluate.hpp"
 
 //------------------------------------------
@@ -31,6 +40,7 @@
 
 namespace Nebulite::Data {
 class JsonScope;
+struct PipelineMemo;
 } // namespace Nebulite::Data
 
 //------------------------------------------
@@ -159,6 +169,14 @@ private:
             }
         }
 
+        /**
+         * @brief Creates an entry whose stable double pointer aliases storage owned by someone else.
+         * @param storage The external storage, must outlive the entry. See Json::bindExternalDouble.
+         */
+        explicit CacheEntry(double* storage) : stableDoublePointer(storage) {
+            *stableDoublePointer = standardNumericValue;
+        }
+
         ~CacheEntry() {
             if (managedInternalDouble) {
                 delete stableDoublePointer;
@@ -173,6 +191,57 @@ private:
      */
     mutable absl::flat_hash_map<std::string, std::unique_ptr<CacheEntry>> cache;
 
+    /**
+     * @brief Sorted index over all cached keys.
+     * @details Keys sharing a prefix are adjacent, so all children of a key are found
+     *          without scanning the entire cache. Kept in sync by insertCacheEntry, eraseCacheEntry and clearCache.
+     */
+    mutable std::map<std::string, CacheEntry*, std::less<>> cacheIndex;
+
+    /**
+     * @brief Inserts a cache entry, replacing any existing entry of the same key.
+     * @param key The key of the entry.
+     * @param entry The entry to insert.
+     * @return Reference to the inserted entry.
+     */
+    CacheEntry& insertCacheEntry(std::string_view key, std::unique_ptr<CacheEntry> entry) const ;
+
+    /**
+     * @brief Removes a cache entry, if present.
+     * @param key The key of the entry.
+     */
+    void eraseCacheEntry(std::string_view key) const ;
+
+    /**
+     * @brief Removes all cache entries.
+     */
+    void clearCache() const ;
+
+    /**
+     * @brief Gets all cached entries whose key starts with the given prefix, including the prefix itself.
+     * @details Logarithmic in the cache size plus the number of matches.
+     * @param prefix The prefix to search for. An empty prefix matches all entries.
+     * @return A range of key-entry pairs, sorted by key.
+     */
+    auto cachedWithPrefix(std::string_view prefix) const {
+        return std::ranges::subrange(cacheIndex.lower_bound(prefix), cacheIndex.end())
+            | std::views::take_while([prefix](auto const& pair) { return pair.first.starts_with(prefix); });
+    }
+
+    /**
+     * @brief Keys whose stable double pointer lives in external storage, see bindExternalDouble.
+     * @details Kept separately from the cache, so that entries recreated after removal alias the same storage.
+     */
+    absl::flat_hash_map<std::string, double*> externalDoubles;
+
+    /**
+     * @brief Creates a new cache entry for the given key.
+     * @details Uses the external storage bound to the key, if any, the cacheline otherwise.
+     * @param key The key of the entry to create.
+     * @return The new cache entry.
+     */
+    std::unique_ptr<CacheEntry> createCacheEntry(std::string_view key) const ;
+
     /**
      * @brief A helper variable that is modified to signal certain functions as non-const.
      */
@@ -221,6 +290,15 @@ private:
      */
     void flush(std::string_view key) const ;
 
+    /**
+     * @brief Replaces a member with an empty array, ready to be filled in a single pass.
+     * @details Does not lock, callers must call synchronizeChildren(key) once the array is filled.
+     * @param key The key of the array.
+     * @param capacity The amount of elements to reserve.
+     * @return The empty array.
+     */
+    rapidjson::Value& replaceWithArray(std::string_view key, std::size_t capacity);
+
     //------------------------------------------
     // Return Value Transformation system
 
@@ -242,6 +320,11 @@ private:
      */
     bool getSubDocWithTransformations(std::string_view key, Json& outDoc) const ;
 
+    /**
+     * @brief Last results of pure transformation steps applied to values of this document, allocated on first use.
+     */
+    mutable std::unique_ptr<PipelineMemo> pipelineMemo;
+
     //------------------------------------------
     // Scope sharing system
 
@@ -249,21 +332,30 @@ private:
     std::unique_ptr<JsonScope> fullScopeInstance;
     std::unique_ptr<JsonScope> dummyScopeInstance;
 
+    //------------------------------------------
+    // Ordered cache lists
+
+    /**
+     * @brief Ordered cache lists of all scopes of this document, allocated on first use.
+     * @details The atomic pointer allows lookups without locking, ownership stays with the unique_ptr.
+     */
+    mutable std::unique_ptr<MappedOrderedCacheList> orderedCacheListsOwned;
+    mutable std::atomic<MappedOrderedCacheList*> orderedCacheLists = nullptr;
+
     //------------------------------------------
     // Cache management
 
     void deleteCacheEntry(std::string_view const key) const {
         if (auto const it = cache.find(key); it != cache.end()) {
-            auto const& entry = it->second;
-            deleteCacheEntry(entry);
+            deleteCacheEntry(*it->second);
         }
     }
 
-    static void deleteCacheEntry(std::unique_ptr<CacheEntry> const& entry) {
-        entry->state = CacheEntry::EntryState::deleted; // Mark as deleted
-        entry->value = standardNumericValue;
-        *entry->stableDoublePointer = standardNumericValue;
-        entry->lastDoubleValue = standardNumericValue;
+    static void deleteCacheEntry(CacheEntry& entry) {
+        entry.state = CacheEntry::EntryState::deleted; // Mark as deleted
+        entry.value = standardNumericValue;
+        *entry.stableDoublePointer = standardNumericValue;
+        entry.lastDoubleValue = standardNumericValue;
     }
 
 public:
@@ -324,6 +416,14 @@ public:
      */
     void copyFrom(Json const& other);
 
+    /**
+     * @brief Checks if another JSON document holds the same content as this one.
+     * @details Compares the documents structurally, including unflushed cache values.
+     * @param other The other JSON document to compare with.
+     * @return true if both documents are equal, false otherwise.
+     */
+    [[nodiscard]] bool isEqual(Json const& other) const ;
+
     //------------------------------------------
     // Validity check
 
@@ -339,6 +439,13 @@ public:
 
     static std::vector<std::string_view> splitKeyWithTransformations(std::string_view key);
 
+    /**
+     * @brief Gets the memo of pure transformation steps applied to values of this document.
+     * @details See JsonTransformer::apply. Allocated on first use, as most documents never use pure transformations.
+     * @return The memo of this document.
+     */
+    PipelineMemo& getPipelineMemo() const ;
+
     //------------------------------------------
     // Set methods
 
@@ -441,11 +548,79 @@ public:
      */
     double* getStableDoublePointer(std::string_view key) const ;
 
+    /**
+     * @brief Binds the stable double pointer of a key to external storage.
+     * @details Used to place frequently accessed values in contiguous memory, see Data::ComponentPool.
+     *          If the key is already cached, its current double value is copied into the storage.
+     *          Stable double pointers handed out before binding keep pointing to the old location,
+     *          so this should be called before the key is accessed by anyone else.
+     * @param key The key to bind. Transformations are not supported.
+     * @param storage The external storage, must outlive this document or be unbound before it is released.
+     */
+    void bindExternalDouble(std::string_view key, double* storage);
+
     /**
      * @brief Provides access to the internal mutex for thread-safe operations.
      */
     std::unique_lock<std::recursive_mutex> lock() const ;
 
+    /**
+     * @brief Gets the ordered cache lists of all scopes of this document, creating them on first use.
+     * @details Thread-safe, only the first call locks.
+     */
+    MappedOrderedCacheList& getOrderedCacheLists() const ;
+
+    /**
+     * @brief Estimates the heap memory used by this document.
+     * @details Not synchronized with ordered cache list lookups, only call while no lists are requested.
+     */
+    [[nodiscard]] DocumentMemoryUsage getMemoryUsage() const ;
+
+    //------------------------------------------
+    // Bulk array access
+
+    /**
+     * @brief Gets all elements of an array as doubles in a single pass.
+     * @details Elements are converted like get<double>, but no cache entries are created for them.
+     *          Much faster than retrieving each element by its key for large arrays.
+     *          Transformations are not supported.
+     * @param key The key of the array.
+     * @return The values, or nullopt if the key is not an array or any element is not convertible to double.
+     */
+    std::optional<std::vector<double>> getNumericArray(std::string_view key) const ;
+
+    /**
+     * @brief Replaces a member with an array of numbers in a single pass.
+     * @details Integral values are stored as integers, floating-point values as doubles.
+     *          Cached children of the key are synchronized afterwards.
+     * @tparam T The arithmetic type of the values.
+     * @param key The key of the array to set.
+     * @param values The values of the array.
+     */
+    template <typename T> requires (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    void setNumericArray(std::string_view key, std::span<T const> values);
+
+    /**
+     * @brief Replaces a member with an array of complex numbers in a single pass.
+     * @details Each element is stored as an object with a real and an imaginary member.
+     *          Cached children of the key are synchronized afterwards.
+     * @param key The key of the array to set.
+     * @param values The values of the array.
+     * @param realMember The member name of the real part.
+     * @param imagMember The member name of the imaginary part.
+     */
+    void setComplexArray(std::string_view key, std::span<std::complex<double> const> values, std::string_view realMember, std::string_view imagMember);
+
+    /**
+     * @brief Reorders the elements of an array without copying them.
+     * @details Cached children of the key are synchronized afterwards.
+     * @param key The key of the array.
+     * @param order The permutation to apply: element i of the result is the element at index order[i].
+     *              Must contain every index of the array exactly once.
+     * @return True on success, false if the key is not an array of the same size as the permutation.
+     */
+    bool permuteArray(std::string_view key, std::span<std::size_t const> order);
+
     //------------------------------------------
     // Key Types, Sizes
 
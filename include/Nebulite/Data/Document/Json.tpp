@@ -5,7 +5,7 @@
 // Includes
 
 // Standard library
-#include <cassert>
+#include <cstdint> // NOLINT
 #include <expected>
 #include <memory>
 #include <mutex>
@@ -86,8 +86,8 @@ std::expected<T, SimpleValueRetrievalError> Json::get(std::string_view const key
 
 template<typename T>
 std::expected<T, SimpleValueRetrievalError> Json::getWithTransformations(std::string_view const key) const {
-    auto args = splitKeyWithTransformations(key);
-    assert(!args.empty());
+    auto const& transformer = JsonTransformer::instance();
+    auto const pipeline = transformer.compile(key);
 
     // In order to minimize the re-initialization overhead of an entire JSON document,
     // we use a thread-local temporary JSON document for applying transformations.
@@ -99,14 +99,13 @@ std::expected<T, SimpleValueRetrievalError> Json::getWithTransformations(std::st
     {
         // Simply overwriting with setSubDoc isn't enough, as this may leave behind stale entries for stable double pointers, which we don't need here.
         // So we manually clear the entire cache.
-        auto const& baseKey = args[0];
-        tempDoc.cache.clear();
+        tempDoc.clearCache();
         tempDoc.doc.SetObject();
-        tempDoc.setSubDoc("", *this, baseKey); // Make a copy of the required member to transform
+        tempDoc.setSubDoc("", *this, pipeline->baseKey); // Make a copy of the required member to transform
     }
 
     // Apply each transformation in sequence
-    if (auto const argsSpan = std::span<std::string_view const>(args.begin()+1, args.end()); !JsonTransformer::instance().parse(argsSpan, tempDoc)) {
+    if (!transformer.apply(*pipeline, tempDoc, pipeline->hasPureSteps ? &getPipelineMemo() : nullptr)) {
         return std::unexpected(SimpleValueRetrievalError::transformationFailure); // if any transformation fails, return default value
     }
     return tempDoc.get<T>(Module::Base::TransformationModule::rootKeyStr);
@@ -115,7 +114,7 @@ std::expected<T, SimpleValueRetrievalError> Json::getWithTransformations(std::st
 template<typename T>
 std::optional<T> Json::jsonValueToCache(std::string_view const key, rapidjson::Value const* val) const {
     // Create a new cache entry
-    auto newEntry = std::make_unique<CacheEntry>(*cacheLine, cachelineIndex);
+    auto newEntry = createCacheEntry(key);
 
     // Get supported types
     auto const& v = RjDirectAccess::getSimpleValue(val);
@@ -133,7 +132,7 @@ std::optional<T> Json::jsonValueToCache(std::string_view const key, rapidjson::V
 
     // Insert into cache
     auto const value = convertVariant<T>(newEntry->value);
-    cache[key] = std::move(newEntry);
+    insertCacheEntry(key, std::move(newEntry));
 
     // Return converted value
     return value;
@@ -195,5 +194,24 @@ std::optional<NewType> Json::convertVariant(RjDirectAccess::SimpleValue const& v
     },
     var);
 }
+
+template <typename T> requires (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+void Json::setNumericArray(std::string_view const key, std::span<T const> const values) {
+    std::scoped_lock const lockGuard(mtx);
+    auto& array = replaceWithArray(key, values.size());
+    auto& allocator = doc.GetAllocator();
+    for (auto const value : values) {
+        if constexpr (std::is_floating_point_v<T>) {
+            array.PushBack(rapidjson::Value(static_cast<double>(value)), allocator);
+        }
+        else if constexpr (std::is_signed_v<T>) {
+            array.PushBack(rapidjson::Value(static_cast<std::int64_t>(value)), allocator);
+        }
+        else {
+            array.PushBack(rapidjson::Value(static_cast<std::uint64_t>(value)), allocator);
+        }
+    }
+    synchronizeChildren(key);
+}
 } // namespace Nebulite::Data
 #endif // NEBULITE_DATA_DOCUMENT_JSON_TPP
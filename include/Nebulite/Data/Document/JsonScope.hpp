@@ -5,12 +5,13 @@
 // Includes
 
 // Standard library
-#include <array>
+#include <atomic>
 #include <complex>
 #include <concepts>
 #include <cstddef>
 #include <cstdint> // NOLINT
 #include <expected>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -22,8 +23,7 @@
 #include <vector>
 
 // Nebulite
-#include "Nebulite/Constants/Alignment.hpp"
-#include "Nebulite/Constants/ThreadSettings.hpp"
+#include "Nebulite/Data/Document/DocumentMemoryUsage.hpp"
 #include "Nebulite/Data/Document/KeyType.hpp"
 #include "Nebulite/Data/Document/RjDirectAccess.hpp"
 #include "Nebulite/Data/Document/ScopedKey.hpp"
@@ -50,7 +50,7 @@ namespace Nebulite::Data {
  */
 class JsonScope final {
 public:
-    static auto constexpr cacheLookupThreadCount = Constants::ThreadSettings::Maximum::totalThreadCount + 4; // A bit extra, just in case
+    static auto constexpr cacheLookupThreadCount = MappedOrderedCacheList::threadSlotCount;
 
 private:
     std::shared_ptr<Json> baseDocument;
@@ -71,9 +71,26 @@ private:
     // Ordered double pointers system
 
     /**
-     * @brief Mapped ordered double pointers intended for non-locking access
+     * @brief Value of orderedCacheScopeId before the first ordered cache list is requested.
      */
-    alignas(Constants::Alignment::simdAlign) std::array<MappedOrderedCacheList, cacheLookupThreadCount> odpCache;
+    static auto constexpr unassignedScopeId = std::numeric_limits<MappedOrderedCacheList::ScopeId>::max();
+
+    /**
+     * @brief Id of this scope's prefix in the ordered cache lists of the document.
+     * @details The lists themselves are stored once per document, see Json::getOrderedCacheLists.
+     */
+    mutable std::atomic<MappedOrderedCacheList::ScopeId> orderedCacheScopeId = unassignedScopeId;
+
+    /**
+     * @brief Gets the ordered cache lists of the document.
+     */
+    MappedOrderedCacheList& getOrderedCacheLists() const ;
+
+    /**
+     * @brief Gets the id of this scope in the ordered cache lists, assigning it on first use.
+     * @param lists The ordered cache lists of the document.
+     */
+    MappedOrderedCacheList::ScopeId getOrderedCacheScopeId(MappedOrderedCacheList& lists) const ;
 
     //------------------------------------------
     // Complex number prefixes
@@ -194,6 +211,10 @@ public:
     [[nodiscard]] std::optional<std::complex<double>> getComplex(ScopedKeyView const& key) const ;
     [[nodiscard]] std::optional<std::complex<double>> getComplex(ScopedKey const& key) const ;
 
+    // All elements of an array in a single pass, see Json::getNumericArray
+    [[nodiscard]] std::optional<std::vector<double>> getNumericArray(ScopedKeyView const& key) const ;
+    [[nodiscard]] std::optional<std::vector<double>> getNumericArray(ScopedKey const& key) const ;
+
     //------------------------------------------
     // Setter
 
@@ -219,6 +240,18 @@ public:
     void setComplex(ScopedKeyView const& key, std::complex<double> const& value);
     void setComplex(ScopedKey const& key, std::complex<double> const& value);
 
+    // Bulk array setters, see Json::setNumericArray and Json::setComplexArray
+    template <typename T> requires (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    void setNumericArray(ScopedKeyView const& key, std::span<T const> values);
+
+    void setComplexArray(ScopedKeyView const& key, std::span<std::complex<double> const> values);
+
+    // Reorder array elements without copying them, see Json::permuteArray
+    bool permuteArray(ScopedKeyView const& key, std::span<std::size_t const> order);
+
+    // Place the stable double pointer of a key in external storage, see Json::bindExternalDouble
+    void bindExternalDouble(ScopedKeyView const& key, double* storage);
+
     //------------------------------------------
     // Special sets for threadsafe maths operations
 
@@ -270,6 +303,12 @@ public:
     template <std::ranges::input_range R> requires std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>,ScopedKeyView>
     double** ensureOrderedCacheList(std::uint64_t uniqueId, R const& keys);
 
+    /**
+     * @brief Estimates the heap memory used by the underlying document.
+     * @details Not synchronized with ordered cache list lookups, only call while no lists are requested.
+     */
+    [[nodiscard]] DocumentMemoryUsage getDocumentMemoryUsage() const ;
+
     //------------------------------------------
     // Key Types, Sizes
 
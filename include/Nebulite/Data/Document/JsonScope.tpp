@@ -5,7 +5,12 @@
 // Includes
 
 // Standard library
+#include <complex>
+#include <cstddef>
 #include <expected>
+#include <ranges>
+#include <span>
+#include <type_traits>
 
 // Nebulite
 #include "Nebulite/Data/Document/Json.hpp"
@@ -59,6 +64,16 @@ void JsonScope::set(ScopedKeyView const& key, T const& value) {
 
 template <std::ranges::input_range R>
 void JsonScope::setArray(ScopedKeyView const& key, R const& range) {
+    // Contiguous numbers are written in a single pass
+    using ValueType = std::ranges::range_value_t<R>;
+    if constexpr (std::ranges::contiguous_range<R> && std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>) {
+        setNumericArray(key, std::span<ValueType const>(std::ranges::data(range), std::ranges::size(range)));
+        return;
+    }
+    else if constexpr (std::ranges::contiguous_range<R> && std::is_same_v<ValueType, std::complex<double>>) {
+        setComplexArray(key, std::span<ValueType const>(std::ranges::data(range), std::ranges::size(range)));
+        return;
+    }
     setEmptyArray(key);
     for (auto const [index, indexKey] : getArrayKeys(key, range.size()) | Utility::Ranges::enumerate) {
         if constexpr (std::is_same_v<typename R::value_type, std::complex<double>>) {
@@ -73,13 +88,19 @@ void JsonScope::setArray(ScopedKeyView const& key, R const& range) {
     }
 }
 
+template <typename T> requires (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+void JsonScope::setNumericArray(ScopedKeyView const& key, std::span<T const> const values) {
+    baseDocument->setNumericArray(key.full(*this), values);
+}
+
 template <std::ranges::input_range R> requires std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>,ScopedKeyView>
 double** JsonScope::ensureOrderedCacheList(std::uint64_t uniqueId, R const& keys) {
     thread_local std::size_t const threadIndex = assignCacheLookupIndex();
     if (threadIndex >= cacheLookupThreadCount) {
         throw std::runtime_error("Thread index exceeds non-locking array size! Too many threads accessing ordered cache lists, increase cacheLookupThreadCount or reduce thread count.");
     }
-    return odpCache[threadIndex].ensureOrderedCacheListNoLock(uniqueId, keys);
+    auto& lists = getOrderedCacheLists();
+    return lists.ensureOrderedCacheListNoLock(threadIndex, getOrderedCacheScopeId(lists), uniqueId, *this, keys);
 }
 
 } // namespace Nebulite::Data
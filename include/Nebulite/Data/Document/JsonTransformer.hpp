@@ -5,11 +5,19 @@
 // Includes
 
 // Standard library
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
+// External
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
 // Nebulite
 #include "Nebulite/Utility/Args/FuncTree.hpp"
 
@@ -27,6 +35,33 @@ class TransformationModule;
 
 //------------------------------------------
 namespace Nebulite::Data {
+/**
+ * @struct PipelineMemo
+ * @brief The last input and output of each pure step applied to values of a single document.
+ * @details Owned by the document the values are retrieved from, so documents transforming the same key
+ *          never evict each other's results. Entries are keyed by the key up to and including the step,
+ *          e.g. 'arr|sort numerically', and replaced once the input of their step changes.
+ */
+struct PipelineMemo {
+    /**
+     * @struct Entry
+     * @brief Input and output of a single step.
+     */
+    struct Entry;
+
+    /**
+     * @brief Maximum amount of entries kept per document, the memo is cleared once exceeded.
+     */
+    static std::size_t constexpr capacity = 16;
+
+    std::mutex mutex;
+    absl::flat_hash_map<std::string, std::shared_ptr<Entry>> entries;
+
+    // Statistics, guarded by the mutex
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+};
+
 /**
  * @brief The JsonTransformer class is responsible for applying transformations to JSON values during retrieval.
  * @details It uses a transformation function tree to apply modifications in sequence based on the provided arguments.
@@ -36,6 +71,39 @@ namespace Nebulite::Data {
  *          Instead, JsonScope DomainModules focus on simple set/move/copy operations, debug utilities and interfaces to better encapsulate destructive actions such as JSON transformations.
  */
 class JsonTransformer {
+public:
+    using TransformationTree = Utility::Args::FuncTree<bool, JsonScope&>;
+
+    /**
+     * @struct Pipeline
+     * @brief A key with transformations, compiled once into resolved steps.
+     * @details Example: 'MyKey.subKey|strLength|add 1' compiles into the base key 'MyKey.subKey'
+     *          and two steps, each with its function resolved and its arguments already tokenized.
+     */
+    struct Pipeline {
+        /**
+         * @struct Step
+         * @brief A single transformation of the pipeline.
+         */
+        struct Step {
+            std::string source; // The transformation as written, parsed if it could not be compiled
+            std::optional<TransformationTree::CompiledCommand> compiled;
+            std::string memoKey; // The key up to and including this step, only set for pure transformations
+        };
+
+        std::string baseKey;
+        std::vector<Step> steps;
+        bool hasPureSteps = false;
+    };
+
+    /**
+     * @brief Maximum amount of compiled pipelines kept, the cache is cleared once exceeded.
+     * @details Keys with transformations are usually written in rulesets and scripts, so their amount is limited.
+     *          Keys built from changing values would grow the cache indefinitely otherwise.
+     */
+    static std::size_t constexpr pipelineCacheCapacity = 4096;
+
+private:
     /**
      * @brief The transformation tree is used to apply modifications to JSON values during getting
      * @details if the key includes the pipe '|' character, we apply the transformations in sequence.
@@ -44,7 +112,7 @@ class JsonTransformer {
      *          Takes in a JsonScope pointer as argument to modify.
      *          Returns true on success, false on failure.
      */
-    std::shared_ptr<Utility::Args::FuncTree<bool, JsonScope&>> transformationFuncTree;
+    std::shared_ptr<TransformationTree> transformationFuncTree;
 
     /**
      * @brief List of all initialized transformation modules
@@ -58,6 +126,48 @@ class JsonTransformer {
     template<typename ModuleType>
     void initModule();
 
+    /**
+     * @brief Names of all transformations whose result only depends on their input, see TransformationModule::bindPureTransformation.
+     */
+    absl::flat_hash_set<std::string> pureTransformations;
+
+    /**
+     * @brief Compiled pipelines by their key, see compile.
+     */
+    mutable absl::flat_hash_map<std::string, std::shared_ptr<Pipeline const>> pipelineCache;
+    mutable std::mutex pipelineCacheMutex;
+
+    /**
+     * @brief Compiles a single transformation.
+     * @param source The transformation, e.g. 'add 1'.
+     * @return The step, parsed from its source on application if it could not be compiled.
+     */
+    Pipeline::Step compileStep(std::string_view source) const ;
+
+    /**
+     * @brief Checks if a transformation is bound as pure.
+     * @param source The transformation, e.g. 'sort numerically'.
+     * @return true if its function name is that of a pure transformation.
+     */
+    bool isPure(std::string_view source) const ;
+
+    /**
+     * @brief Applies a single step.
+     * @param step The step to apply.
+     * @param jsonDoc The JSON document to modify.
+     * @return true if the transformation was successfully applied, false otherwise.
+     */
+    bool applyStep(Pipeline::Step const& step, Json& jsonDoc) const ;
+
+    /**
+     * @brief Applies a single pure step, reusing its memoized output if its input did not change.
+     * @param step The step to apply, with its memo key set.
+     * @param jsonDoc The JSON document to modify.
+     * @param memo The memo of the document the value was retrieved from.
+     * @return true if the transformation was successfully applied, false otherwise.
+     */
+    bool applyStep(Pipeline::Step const& step, Json& jsonDoc, PipelineMemo& memo) const ;
+
     // Is singleton, no public construction is allowed.
     JsonTransformer();
 
@@ -91,6 +201,27 @@ public:
      * @return true if the transformations were successfully applied, false otherwise.
      */
     bool parseSingleTransformation(std::span<std::string_view const> const& args, JsonScope& jsonDoc) const ;
+
+    /**
+     * @brief Gets the compiled pipeline of a key with transformations, compiling it on first use.
+     * @details Compiled pipelines are cached by their key, so each key is split and tokenized only once.
+     *          Thread-safe, pipelines may be applied concurrently.
+     * @param key The key with transformations, e.g. 'MyKey.subKey|strLength|add 1'.
+     * @return The compiled pipeline.
+     */
+    std::shared_ptr<Pipeline const> compile(std::string_view key) const ;
+
+    /**
+     * @brief Applies the steps of a compiled pipeline.
+     * @details Each step modifies the document in place, so no intermediate documents are copied.
+     *          Pure steps reuse their last result from the given memo if their input did not change.
+     * @param pipeline The compiled pipeline, the base key is not used.
+     * @param jsonDoc The JSON document holding the value of the base key at its root.
+     * @param memo The memo of the document the value was retrieved from, nullptr to not memoize.
+     * @return true if the transformations were successfully applied, false otherwise.
+     *         If the value is false, the document should still be considered modified, but in an unknown state.
+     */
+    bool apply(Pipeline const& pipeline, Json& jsonDoc, PipelineMemo* memo = nullptr) const ;
 };
 } // namespace Nebulite::Data
 #include "Nebulite/Data/Document/JsonTransformer.tpp" // NOLINT(misc-include-cleaner)
@@ -5,19 +5,25 @@
 // Includes
 
 // Standard library
+#include <array>
 #include <cassert>
 #include <concepts>
 #include <cstddef>
+#include <cstdint> // NOLINT
+#include <memory>
+#include <mutex>
 #include <ranges>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 // External
 #include <absl/container/flat_hash_map.h>
 
 // Nebulite
-#include "Nebulite/Utility/Coordination/SharedMutex.hpp"
+#include "Nebulite/Constants/ThreadSettings.hpp"
 
 //------------------------------------------
 // Forward declarations
@@ -32,16 +38,26 @@ class JsonScope;
 namespace Nebulite::Data {
 /**
  * @class MappedOrderedCacheList
- * @brief A thread-safe map from strings to OrderedCacheList objects.
+ * @brief Document-level store of ordered cache lists, keyed by scope, unique id and thread slot.
+ * @details Owned by a Json document and only allocated once a scope of it requests its first list.
+ *          Each thread slot owns its own map, created on first use by the thread assigned to that slot,
+ *          so lookups need no locking. Scopes with the same prefix resolve to the same stable pointers,
+ *          and therefore share their lists.
  */
 class MappedOrderedCacheList {
 public:
-    explicit MappedOrderedCacheList([[clang::lifetimebound]] JsonScope& ownerReference)
-        : reference(ownerReference) {
-    }
-
     using OrderedCacheList = std::vector<double*>;
 
+    /**
+     * @brief Number of thread slots, each thread accessing lists is assigned one.
+     */
+    static std::size_t constexpr threadSlotCount = Constants::ThreadSettings::Maximum::totalThreadCount + 4; // A bit extra, just in case
+
+    /**
+     * @brief Id of a scope prefix within the document.
+     */
+    using ScopeId = std::uint32_t;
+
     /**
      * @brief Generates a unique ID for a list of keys based on a given string.
      * @param identifier The name of the ruleset, or any other string to generate a unique ID from.
@@ -49,66 +65,85 @@ public:
      */
     static std::size_t generateUniqueId(std::string_view identifier);
 
+    /**
+     * @brief Gets the id of a scope prefix, creating it if needed.
+     * @details Thread-safe. Scopes should cache the result, as this requires a lock.
+     * @param prefix The scope prefix.
+     * @return The id of the prefix, stable for the lifetime of the store.
+     */
+    ScopeId getScopeId(std::string_view prefix);
+
     /**
      * @brief Ensures the existence of an ordered cache list of double pointers for a set of keys.
+     * @details Not protected by any mutex, the slot must only be used by the thread it was assigned to.
      * @tparam R A range of ScopedKeyView objects
+     * @param threadSlot The slot of the calling thread, see JsonScope::assignCacheLookupIndex
+     * @param scopeId The id of the requesting scope, see getScopeId
      * @param uniqueId The unique id of the entry
+     * @param scope The scope to resolve the keys in
      * @param keys The keys to potentially create the entry with
      * @return An ordered vector of double pointers corresponding to the keys, either retrieved from the map or newly created if it did not exist.
      */
     template <std::ranges::input_range R> requires std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>,ScopedKeyView>
-    double** ensureOrderedCacheList(std::size_t uniqueId, R&& keys) {
-        Utility::Coordination::WriteLock const lock(mtxMap);
-        return fromMap(uniqueId, std::forward<R>(keys));
+    double** ensureOrderedCacheListNoLock(std::size_t const threadSlot, ScopeId const scopeId, std::uint64_t const uniqueId, JsonScope const& scope, R&& keys) {
+        assert(threadSlot < threadSlotCount);
+        auto& slot = threadSlots[threadSlot];
+        if (slot == nullptr) [[unlikely]] {
+            slot = std::make_unique<ThreadSlot>();
+        }
+        return fromMap(slot->map, std::pair(scopeId, uniqueId), scope, std::forward<R>(keys));
     }
 
     /**
-     * @brief Ensures the existence of an ordered cache list of double pointers for a set of keys. Non-locking version.
-     * @details Not protected by any mutex
-     * @tparam R A range of ScopedKeyView objects
-     * @param uniqueId The unique id of the entry
-     * @param keys The keys to potentially create the entry with
-     * @return An ordered vector of double pointers corresponding to the keys, either retrieved from the map or newly created if it did not exist.
+     * @brief Estimates the heap memory used by all lists.
+     * @details Not synchronized with lookups, only call while no lists are requested.
+     * @return The estimated size in bytes, including this store.
      */
-    template <std::ranges::input_range R> requires std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>,ScopedKeyView>
-    double** ensureOrderedCacheListNoLock(std::size_t uniqueId, R&& keys) {
-        return fromMap(uniqueId, std::forward<R>(keys));
-    }
+    [[nodiscard]] std::size_t memoryUsage() const ;
 
 private:
+    using MapKey = std::pair<ScopeId, std::uint64_t>;
+    using Map = absl::flat_hash_map<MapKey, OrderedCacheList>;
+
     /**
-     * @brief Reference to the JSON document that owns this cache.
+     * @struct ThreadSlot
+     * @brief All lists requested by a single thread.
      */
-    JsonScope& reference;
+    struct ThreadSlot {
+        Map map;
+    };
 
     /**
-     * @brief Map from unique IDs to OrderedCacheList objects.
+     * @brief Lazily created maps, indexed by thread slot.
      */
-    absl::flat_hash_map<std::size_t, OrderedCacheList> map;
+    std::array<std::unique_ptr<ThreadSlot>, threadSlotCount> threadSlots;
 
     /**
-     * @brief Mutex for thread-safe access to the map.
+     * @brief Interned scope prefixes.
      */
-    Utility::Coordination::SharedMutex mtxMap;
+    absl::flat_hash_map<std::string, ScopeId> scopeIds;
+    std::mutex mtxScopeIds;
 
     /**
      * @brief Retrieves or creates an ordered cache list of double pointers for a set of keys from the map.
      * @details Not protected by any mutex
      * @tparam R A range of ScopedKeyView objects
-     * @param uniqueId The unique id of the entry
+     * @param map The map of the calling thread
+     * @param key The scope and unique id of the entry
+     * @param scope The scope to resolve the keys in
      * @param keys The keys to potentially create the entry with
      * @return An ordered vector of double pointers corresponding to the keys, either retrieved from the map or newly created if it did not exist.
      */
     template <std::ranges::input_range R> requires std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>,ScopedKeyView>
-    double** fromMap(std::size_t const uniqueId, R&& keys){
-        if (auto const it = map.find(uniqueId); it != map.end()) [[likely]] {
+    static double** fromMap(Map& map, MapKey const& key, JsonScope const& scope, R&& keys){
+        if (auto const it = map.find(key); it != map.end()) [[likely]] {
             return it->second.data();
         }
-        auto [newIt, inserted] = map.try_emplace(uniqueId, OrderedCacheList());
+        auto [newIt, inserted] = map.try_emplace(key, OrderedCacheList());
         if (inserted) {
             newIt->second.reserve(keys.size());
-            for (auto const& key : std::forward<R>(keys)) {
-                addToVec(newIt->second, reference, key);
+            for (auto const& k : std::forward<R>(keys)) {
+                addToVec(newIt->second, scope, k);
             }
         }
         assert(newIt->second.size() == keys.size());
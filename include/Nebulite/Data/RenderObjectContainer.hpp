@@ -80,8 +80,9 @@ public:
     void append(Core::RenderObject* toAppend, TilingInformation const& tilingInformation);
 
     /**
-     * @brief Reinserts all objects into the container.
-     *        Placing them in the appropriate tile and batch.
+     * @brief Re-evaluates the tile of all objects in the container.
+     *        Only objects whose tile changed are moved into the appropriate tile and batch,
+     *        all others stay in place.
      *        Needed for re-evaluating their positions after a resize of the display.
      * @param tilingInformation Width and height of each tile
      */
@@ -105,6 +106,7 @@ public:
 
     /**
      * @brief Gets the total count of RenderObject instances in the container.
+     * @details Includes objects waiting for reinsertion, excludes objects in the deletion process.
      * @return The total number of RenderObject instances.
      */
     [[nodiscard]] std::size_t getObjectCount() const;
@@ -119,6 +121,22 @@ public:
      */
     void update(std::vector<TileCoordinate> const& viewport, TilingInformation const& tilingInformation, RendererProcessor& rendererProcessor);
 
+    /**
+     * @brief Function deciding whether an existing tile is part of an update.
+     */
+    using TileSelection = std::function<bool(TileCoordinate const&)>;
+
+    /**
+     * @brief Updates all existing tiles accepted by the selection, in addition to the regular update.
+     * @details Used to simulate tiles outside the viewport at a reduced rate.
+     *          Does not advance the deletion process, so it may be called any number of times after update.
+     *          The selection is called once for every existing tile, on the calling thread.
+     * @param selection Function returning true for each tile to update.
+     * @param tilingInformation Width and height of each tile
+     * @param rendererProcessor The RendererProcessor instance to use for parallel processing of batches.
+     */
+    void updateSelection(TileSelection const& selection, TilingInformation const& tilingInformation, RendererProcessor& rendererProcessor);
+
     /**
      * @brief Gets the vector of batches at the specified tile position.
      * @param position The tile position to query: (x, y).
@@ -133,6 +151,8 @@ public:
      *        Does not remove the object from the container.
      *        Do **not** delete the returned object,
      *        it's still owned and managed by the container!
+     * @details Constant time lookup through the object index.
+     *          Objects are found until they enter the deletion process.
      * @param domainId The unique ID of the RenderObject to retrieve.
      * @return Pointer to the RenderObject if found, nullptr otherwise.
      */
@@ -142,6 +162,11 @@ public:
         // Container stats
         std::size_t containerTotalTiles = 0;
         std::size_t containerTotalCost = 0;
+
+        // Stats of the last reinsertAllObjects call
+        double reinsertionDurationMs = 0.0;
+        std::size_t reinsertionCheckedObjects = 0;
+        std::size_t reinsertionMovedObjects = 0;
     };
 
     /**
@@ -185,6 +210,18 @@ public:
     }
 
 private:
+    /**
+     * @brief Processes all tiles added to the RendererProcessor, then reinserts moved objects.
+     * @param tilingInformation Width and height of each tile
+     * @param rendererProcessor The RendererProcessor instance holding the tiles to process.
+     */
+    void processTiles(TilingInformation const& tilingInformation, RendererProcessor& rendererProcessor);
+
+    /**
+     * @brief Removes all objects in trash from the object index.
+     */
+    void unindexTrash();
+
     /**
      * @brief Holds all objects in the container.
      *        `ObjectContainer[tileX,tileY] -> vector<batch>`
@@ -195,6 +232,22 @@ private:
      *       Perhaps this isn't worth it
      */
     absl::flat_hash_map<TileCoordinate, Tile> objectContainer;
+
+    /**
+     * @brief Index of all objects in the container: `domainId -> RenderObject`
+     * @details Objects are added on append and removed once they are moved to trash.
+     *          Objects waiting for reinsertion stay indexed, as they are still owned by the container.
+     */
+    absl::flat_hash_map<std::size_t, Core::RenderObject*> objectIndex;
+
+    /**
+     * @brief Stats of the last reinsertAllObjects call, see ContainerInfo.
+     */
+    struct ReinsertionStats {
+        double durationMs = 0.0;
+        std::size_t checkedObjects = 0;
+        std::size_t movedObjects = 0;
+    } lastReinsertion;
 };
 } // namespace Nebulite::Data
 #endif // NEBULITE_DATA_RENDEROBJECTCONTAINER_HPP
@@ -5,17 +5,12 @@
 // Includes
 
 // Standard library
-#include <array>
-#include <atomic>
-#include <cstddef>
+#include <cstdint> // NOLINT
 #include <mutex>
-#include <optional>
 #include <vector>
 
 // Nebulite
-#include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Data/Tiling.hpp"
-#include "Nebulite/Utility/Coordination/WorkDispatcher.hpp"
 
 //------------------------------------------
 // Forward declarations
@@ -68,14 +63,14 @@ struct DeletionProcess {
 /**
  * @class Nebulite::Data::RendererProcessor
  * @brief Manages the processing of RenderObjects for rendering.
- *        This class is responsible for preparing RenderObjects for rendering by organizing them into batches,
- *        managing worker threads for batch processing, and handling reinsertion and deletion processes.
+ *        This class is responsible for preparing RenderObjects for rendering by collecting the tiles to update,
+ *        processing them as jobs of the shared TaskScheduler, and handling reinsertion and deletion processes.
  */
 class RendererProcessor {
 public:
     static RendererProcessor& instance();
 
-    ~RendererProcessor();
+    ~RendererProcessor() = default;
 
     // Non-copyable, non-movable
     RendererProcessor(RendererProcessor const&) = delete;
@@ -85,51 +80,48 @@ public:
 
     /**
      * @brief Prepares the RendererProcessor for processing a new layer of RenderObjects
-     *        by setting all worker threads referencing the new layer.
+     *        by referencing the reinsertion and deletion processes of the new layer.
      * @param layer The RenderObjectContainer representing the new layer to process.
      */
     void prepareForNewLayer(RenderObjectContainer* layer);
 
     /**
-     * @brief Flag to signal threads to stop.
+     * @brief Workspace of a single tile job.
      */
-    std::atomic<bool> stopFlag;
-
-    /**
-     * @brief Workspace struct for batch worker threads.
-     */
-    struct DispatcherWorkspace {
-        Tile* work = nullptr; // TODO: multiple tiles per worker might be better
+    struct TileJob {
+        Tile* work = nullptr;
         TilingInformation tilingInformation;
         TileCoordinate pos;
-        ReinsertionProcess* reinsertionProcess = nullptr;
-        DeletionProcess* deletionProcess = nullptr;
+        std::uint64_t estimatedCost = 0;
     };
 
     /**
-     * @brief Worker function for processing batches in parallel.
-     * @param workspace The workspace containing the batches to process and necessary context information.
+     * @brief Adds a tile to be processed on the next call to processPool.
+     * @param tile The tile to process.
+     * @param pos The coordinate of the tile.
+     * @param tilingInformation Width and height of each tile.
      */
-    static void batchWorkerFunc(DispatcherWorkspace const& workspace);
+    void addTile(Tile& tile, TileCoordinate const& pos, TilingInformation const& tilingInformation);
 
     /**
-     * @brief Holds all batch worker threads.
-     * @details Pool of pre-initialized workers for reuse
+     * @brief Processes all added tiles in parallel and clears them.
+     * @details Tiles are processed as separate jobs, the most expensive ones first,
+     *          so that idle threads can balance uneven tiles by stealing the cheaper ones.
      */
-    std::array<
-        std::optional<Utility::Coordination::WorkDispatcher<DispatcherWorkspace>>,
-        Constants::ThreadSettings::Maximum::rendererWorkerCount
-    > batchWorkerPool;
+    void processPool();
+
+private:
+    RendererProcessor() = default;
 
     /**
-     * @brief Starts all batch worker threads to process the assigned batches in parallel.
+     * @brief Worker function for processing a single tile.
+     * @param job The tile to process and necessary context information.
      */
-    void processPool();
+    void batchWorkerFunc(TileJob const& job) const ;
 
-    void processPool(std::size_t count);
-
-private:
-    RendererProcessor();
+    std::vector<TileJob> jobs;
+    ReinsertionProcess* reinsertionProcess = nullptr;
+    DeletionProcess* deletionProcess = nullptr;
 };
 
 } // namespace Nebulite::Data
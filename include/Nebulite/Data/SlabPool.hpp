@@ -0,0 +1,149 @@
+#ifndef NEBULITE_DATA_SLABPOOL_HPP
+#define NEBULITE_DATA_SLABPOOL_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <vector>
+
+//------------------------------------------
+namespace Nebulite::Data {
+/**
+ * @class SlabPool
+ * @brief Thread-safe fixed-size object allocator, handing out slots from large slabs.
+ * @details Meant for large objects with high churn, currently only RenderObjects.
+ *          All calls lock the pool, so types allocated on many threads at high rates,
+ *          e.g. document internals, should not opt in without thread-local free lists.
+ *          Freed slots are kept in a LIFO free list and reused before any new slab is allocated,
+ *          so spawning after deleting objects usually touches memory that is still cached.
+ *          Slabs are only returned to the system when the pool is destroyed.
+ *
+ *          Classes opt in by declaring a `slabPoolName` and class-specific operator new/delete
+ *          that forward to allocate<T> and deallocate<T>.
+ */
+class SlabPool {
+public:
+    /**
+     * @struct Stats
+     * @brief Counters of a pool, allocations and frees are totals since construction.
+     */
+    struct Stats {
+        std::size_t allocations = 0;
+        std::size_t frees = 0;
+        std::size_t live = 0;
+        std::size_t capacity = 0;
+    };
+
+    /**
+     * @brief Number of slots allocated at once.
+     */
+    static std::size_t constexpr slotsPerSlab = 256;
+
+    /**
+     * @brief Constructs a pool and registers it for forEach.
+     * @param name The name of the pool, used for stats.
+     * @param slotSize The size of each slot in bytes.
+     * @param slotAlignment The alignment of each slot in bytes.
+     */
+    SlabPool(std::string_view name, std::size_t slotSize, std::size_t slotAlignment);
+
+    ~SlabPool();
+
+    //------------------------------------------
+    // Disable Copying and Moving
+
+    SlabPool(SlabPool const&) = delete;
+    SlabPool& operator=(SlabPool const&) = delete;
+    SlabPool(SlabPool&&) = delete;
+    SlabPool& operator=(SlabPool&&) = delete;
+
+    //------------------------------------------
+    // Slots
+
+    /**
+     * @brief Allocates a single slot, reusing freed slots first.
+     * @return Pointer to uninitialized memory of the slot size.
+     */
+    void* allocate();
+
+    /**
+     * @brief Returns a slot to the pool.
+     * @param ptr The slot to free, must have been allocated by this pool.
+     */
+    void deallocate(void* ptr) noexcept;
+
+    //------------------------------------------
+    // Typed access
+
+    /**
+     * @brief Gets the pool of a type.
+     * @details The pool is never destroyed, as pooled objects may be deleted during static destruction.
+     * @tparam T The pooled type, providing a `slabPoolName`.
+     */
+    template <typename T>
+    static SlabPool& of() {
+        static auto* const pool = new SlabPool(T::slabPoolName, sizeof(T), alignof(T));
+        return *pool;
+    }
+
+    /**
+     * @brief Allocation helper for class-specific operator new.
+     * @details Sizes other than sizeof(T), e.g. from derived classes, use the global allocator.
+     * @tparam T The pooled type.
+     * @param size The requested size.
+     * @return Pointer to uninitialized memory.
+     */
+    template <typename T>
+    static void* allocate(std::size_t const size) {
+        if (size != sizeof(T)) [[unlikely]] {
+            return ::operator new(size, std::align_val_t(alignof(T)));
+        }
+        return of<T>().allocate();
+    }
+
+    /**
+     * @brief Deallocation helper for class-specific sized operator delete.
+     * @tparam T The pooled type.
+     * @param ptr The memory to free.
+     * @param size The size passed to allocate.
+     */
+    template <typename T>
+    static void deallocate(void* ptr, std::size_t const size) noexcept {
+        if (size != sizeof(T)) [[unlikely]] {
+            ::operator delete(ptr, std::align_val_t(alignof(T)));
+            return;
+        }
+        of<T>().deallocate(ptr);
+    }
+
+    //------------------------------------------
+    // Stats
+
+    [[nodiscard]] std::string_view getName() const noexcept { return name; }
+
+    [[nodiscard]] Stats getStats() const ;
+
+    /**
+     * @brief Calls a function for each pool that currently exists.
+     * @param function The function to call, taking a SlabPool const&.
+     */
+    static void forEach(std::function<void(SlabPool const&)> const& function);
+
+private:
+    std::string_view name;
+    std::size_t slotSize;
+    std::size_t slotAlignment;
+
+    std::vector<std::byte*> slabs;
+    std::vector<void*> freeSlots;
+    Stats stats;
+    mutable std::mutex mtx;
+};
+} // namespace Nebulite::Data
+#endif // NEBULITE_DATA_SLABPOOL_HPP
@@ -7,12 +7,14 @@
 // Standard library
 #include <cstdint> // NOLINT
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
 
 // Nebulite
 #include "Nebulite/Data/TaskQueueResult.hpp"
+#include "Nebulite/Interaction/Execution/DomainTree.hpp"
 
 //------------------------------------------
 // Forward declarations
@@ -22,6 +24,10 @@ class Context;
 class ContextScope;
 } // namespace Nebulite::Interaction
 
+namespace Nebulite::Interaction::Execution {
+class Domain;
+} // namespace Nebulite::Interaction::Execution
+
 namespace Nebulite::Utility::Io {
 class Capture;
 } // namespace Nebulite::Utility::Io
@@ -34,6 +40,8 @@ namespace Nebulite::Data {
  */
 class TaskQueue {
 public:
+    using CompiledTask = Interaction::Execution::DomainTree::CompiledCommand;
+
     /**
      * @brief Constructs a TaskQueue with specified settings.
      * @param callbackName The name used as arg[0] when parsing tasks from this queue.
@@ -45,6 +53,8 @@ public:
     /**
      * @brief Resolves the task queue by parsing and executing each task in the context of the provided domain.
      * @details skips tasks if the internal wait counter is greater than zero.
+     *          Tasks of a queue that is not cleared after resolving are compiled on their first resolve,
+     *          so they are not parsed again on subsequent resolves.
      * @param ctx The context of the interaction. Commands are parsed into 'self'
      * @param ctxScope The context scope of the interaction.
      * @param recover If true, continues processing tasks even after encountering a critical error.
@@ -65,6 +75,14 @@ public:
      */
     void pushBack(std::string_view task);
 
+    /**
+     * @brief Appends a precompiled task to the task queue.
+     * @details The compiled form is executed if it belongs to the resolving domain, otherwise the task string is parsed.
+     * @param task The task string to append.
+     * @param compiled The compiled task, see compile.
+     */
+    void pushBack(std::string_view task, std::shared_ptr<CompiledTask const> compiled);
+
     /**
      * @brief Pushes a task to the front of the task queue.
      * @param task The task string to push.
@@ -100,9 +118,27 @@ public:
      */
     [[nodiscard]] bool isWaiting() const ;
 
+    /**
+     * @brief Compiles a task as it would be parsed when resolving this queue.
+     * @param task The task string to compile.
+     * @param domain The domain the task is resolved in.
+     * @return The compiled task, or nullptr if it cannot be compiled and has to be parsed.
+     */
+    [[nodiscard]] std::shared_ptr<CompiledTask const> compile(std::string_view task, Interaction::Execution::Domain const& domain) const ;
+
 private:
+    /**
+     * @struct Task
+     * @brief A single task, optionally with its compiled form.
+     */
+    struct Task {
+        std::string command; // Task string, prefixed with the callback name once resolved
+        std::shared_ptr<CompiledTask const> compiled = nullptr; // Compiled form, parsed from command if nullptr
+        bool compileAttempted = false; // Compilation of kept tasks is only attempted once
+    };
+
     struct ThreadsafeTasks {
-        std::deque<std::string> list; // List of tasks.
+        std::deque<Task> list; // List of tasks.
         std::mutex mutex;  // Mutex for thread-safe access to the task queue
     } tasks; // Task queue with thread-safe access
 
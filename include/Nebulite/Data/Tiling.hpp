@@ -5,6 +5,7 @@
 // Includes
 
 // Standard library
+#include <cstddef>
 #include <cstdint> // NOLINT
 #include <ranges>
 #include <vector>
@@ -88,6 +89,17 @@ public:
      */
     bool insertIfCostGoalMatches(Core::RenderObject* toAppend);
 
+    /**
+     * @brief Moves all objects that no longer belong to this tile into the provided vector, without updating them.
+     * @details Used to redistribute objects after the tiling changed. Batch costs are updated accordingly,
+     *          emptied batches are removed and the texture is always invalidated, as it was rendered for the previous tiling.
+     * @param toMove Objects whose tile coordinate differs from this tile
+     * @param tilingInfo The pixel height/width of each tile
+     * @param coordinate The coordinate of this tile
+     * @return The number of objects checked.
+     */
+    std::size_t extractMisplaced(std::vector<Core::RenderObject*>& toMove, TilingInformation const& tilingInfo, TileCoordinate const& coordinate);
+
     /**
      * @brief Updates all objects of this tile
      * @param toMove Objects moved out of the tile during the update
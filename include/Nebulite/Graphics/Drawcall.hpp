@@ -7,6 +7,7 @@
 // Standard library
 #include <cstddef>
 #include <cstdint> // NOLINT
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -153,6 +154,7 @@ private:
         struct Text {
             std::string text;
             SDL_Color textColor{.r=0,.g=0,.b=0,.a=0};
+            std::shared_ptr<SDL_Texture> texture; // Shared with the text cache, linked into the texture domain
         } text;
 
         struct Circle {
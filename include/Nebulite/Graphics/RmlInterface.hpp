@@ -90,7 +90,19 @@ public:
      * @param mousePositionX The current X position of the mouse cursor, used for cursor management in the system interface
      * @param mousePositionY The current Y position of the mouse cursor, used for cursor management in the system interface
      */
-    void update(int mousePositionX, int mousePositionY) const ;
+    void update(int mousePositionX, int mousePositionY) ;
+
+    /**
+     * @brief Cost of the last update, shown in the debug overlay.
+     */
+    struct UpdateStats {
+        double milliseconds = 0.0;  // Time spent updating documents, modules and layout
+        std::size_t bindings = 0;   // Elements bound to an expression
+        std::size_t evaluated = 0;  // Bindings evaluated, as a value they read changed
+        std::size_t changed = 0;    // Bindings whose inner rml was replaced
+    };
+
+    [[nodiscard]] UpdateStats const& getUpdateStats() const noexcept { return updateStats; }
 
     /**
      * @brief Call the provided postRenderUpdate function of each registered module.
@@ -307,6 +319,7 @@ private:
     Rml::Context* context = nullptr;
     std::vector<std::unique_ptr<Module::Base::RmlUiModule>> modules;
     SDL_Window* window = nullptr;
+    UpdateStats updateStats;
 
     // Owner -> name -> document
     absl::flat_hash_map<
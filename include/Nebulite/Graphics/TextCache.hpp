@@ -0,0 +1,178 @@
+#ifndef NEBULITE_GRAPHICS_TEXTCACHE_HPP
+#define NEBULITE_GRAPHICS_TEXTCACHE_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// External
+#include <SDL3/SDL_pixels.h>
+#include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_render.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+//------------------------------------------
+namespace Nebulite::Graphics {
+/**
+ * @class Nebulite::Graphics::TextCache
+ * @brief Renders the textures of text drawcalls from glyph atlases, and shares textures of repeated strings.
+ * @details Each font and size owns an atlas of pages that glyphs are rasterized into once.
+ *          A string is composed by drawing its glyphs as textured quads into a target texture,
+ *          so changing labels never rasterize through SDL_ttf again.
+ *          Strings requested more than once are kept in an LRU of whole-string textures,
+ *          shared by all drawcalls showing the same label.
+ *          Only use from the render thread, textures are created with the renderer passed in.
+ */
+class TextCache {
+public:
+    /**
+     * @brief Shared texture of a rendered string, destroyed once neither the cache nor any drawcall uses it.
+     */
+    using TexturePtr = std::shared_ptr<SDL_Texture>;
+
+    /**
+     * @brief Maximum amount of whole-string textures kept in the LRU.
+     */
+    static std::size_t constexpr lruCapacity = 512;
+
+    /**
+     * @brief Width and height of each atlas page in pixels.
+     */
+    static int constexpr atlasPageSize = 1024;
+
+    /**
+     * @struct Stats
+     * @brief Counters of the cache, published under debug.text by the GlobalSpace Debug module.
+     */
+    struct Stats {
+        std::size_t hits = 0;        // Strings served from the LRU
+        std::size_t composed = 0;    // Strings composed from atlas glyphs
+        std::size_t reused = 0;      // Composed strings that were drawn into the caller's previous texture
+        std::size_t rasterized = 0;  // Strings rendered through SDL_ttf directly, as a fallback
+        std::size_t glyphs = 0;      // Glyphs rasterized into atlases
+        std::size_t atlasPages = 0;  // Atlas pages allocated
+    };
+
+    TextCache();
+    ~TextCache();
+
+    TextCache(TextCache const&) = delete;
+    TextCache& operator=(TextCache const&) = delete;
+    TextCache(TextCache&&) = delete;
+    TextCache& operator=(TextCache&&) = delete;
+
+    /**
+     * @brief Gets a texture showing the given text.
+     * @details Strings containing glyphs that do not fit into an atlas page are rendered through SDL_ttf instead.
+     * @param renderer The renderer to create textures with.
+     * @param font The font to render with, at its current size.
+     * @param text The UTF-8 text, lines are separated by '\n'.
+     * @param color The color of the text.
+     * @param previous The texture previously returned to the caller, drawn into again if no one else uses it and the size matches.
+     * @return The texture, or nullptr on failure.
+     */
+    [[nodiscard]] TexturePtr render(SDL_Renderer* renderer, TTF_Font* font, std::string_view text, SDL_Color color, TexturePtr const& previous);
+
+    /**
+     * @brief Releases all cached strings and atlases.
+     * @details Must be called before the renderer they were created with is destroyed.
+     *          Textures still held by drawcalls stay alive until released.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the counters of the cache.
+     * @return The current stats.
+     */
+    [[nodiscard]] Stats getStats() const noexcept { return stats; }
+
+private:
+    class GlyphAtlas;
+
+    /**
+     * @struct Key
+     * @brief Identifies a rendered string.
+     */
+    struct Key {
+        TTF_Font* font = nullptr;
+        float size = 0.0f;
+        std::uint32_t color = 0;
+        std::string text;
+
+        bool operator==(Key const&) const = default;
+
+        template <typename H>
+        friend H AbslHashValue(H h, Key const& key) {
+            return H::combine(std::move(h), key.font, key.size, key.color, key.text);
+        }
+    };
+
+    /**
+     * @brief Composes a string from atlas glyphs.
+     * @return The texture, or nullptr if the string could not be composed.
+     */
+    TexturePtr compose(SDL_Renderer* renderer, GlyphAtlas& atlas, TTF_Font* font, std::string_view text, SDL_Color color, TexturePtr const& previous);
+
+    /**
+     * @brief Renders a string through SDL_ttf directly.
+     * @return The texture, or nullptr on failure.
+     */
+    TexturePtr rasterize(SDL_Renderer* renderer, TTF_Font* font, std::string_view text, SDL_Color color);
+
+    /**
+     * @brief Gets the atlas of a font at its current size, creating it if needed.
+     */
+    GlyphAtlas& atlasFor(SDL_Renderer* renderer, TTF_Font* font, float size);
+
+    /**
+     * @brief Decides if a string is worth keeping in the LRU.
+     * @details Strings are only admitted on their second request,
+     *          so labels changing every update do not evict static ones.
+     */
+    bool admit(Key const& key);
+
+    /**
+     * @brief Adds a string to the LRU, evicting the least recently used one if full.
+     */
+    void insert(Key&& key, TexturePtr const& texture);
+
+    //------------------------------------------
+    // Strings
+
+    using LruList = std::list<std::pair<Key, TexturePtr>>;
+    LruList lru; // Most recently used first
+    absl::flat_hash_map<Key, LruList::iterator> lruIndex;
+
+    absl::flat_hash_set<std::size_t> requestedOnce; // Hashes of strings not yet admitted
+
+    //------------------------------------------
+    // Glyphs
+
+    absl::flat_hash_map<std::pair<TTF_Font*, float>, std::unique_ptr<GlyphAtlas>> atlases;
+
+    /**
+     * @struct PlacedGlyph
+     * @brief A glyph positioned within a composed string.
+     */
+    struct PlacedGlyph {
+        SDL_Texture* page;
+        SDL_FRect src;
+        SDL_FRect dst;
+    };
+    std::vector<PlacedGlyph> layout; // Reused between compositions
+
+    Stats stats;
+};
+} // namespace Nebulite::Graphics
+#endif // NEBULITE_GRAPHICS_TEXTCACHE_HPP
@@ -452,6 +452,32 @@ public:
     [[nodiscard]] Constants::Event parse(std::vector<std::string_view> const& args, Context& ctx, ContextScope& ctxScope) const ;
     [[nodiscard]] Constants::Event parse(std::vector<std::string> const& args, Context& ctx, ContextScope& ctxScope) const ;
 
+    /**
+     * @brief Resolves a command once, so it can be executed repeatedly without parsing.
+     * @details See DomainTree::compile. Fall back to parseStr if nullopt is returned.
+     * @param cmd Command string to compile, same syntax as parseStr.
+     * @return The compiled command, or nullopt if it cannot be resolved.
+     */
+    [[nodiscard]] std::optional<DomainTree::CompiledCommand> compile(std::string_view cmd) const ;
+
+    /**
+     * @brief Executes a command compiled with this domain.
+     * @param compiled The compiled command
+     * @param ctx The context of the caller
+     * @param ctxScope The context scope of the caller
+     * @return Potential errors that occurred on command execution
+     */
+    [[nodiscard]] Constants::Event execute(DomainTree::CompiledCommand const& compiled, Context& ctx, ContextScope& ctxScope) const ;
+
+    /**
+     * @brief Checks if a compiled command was compiled with this domain.
+     * @param compiled The compiled command
+     * @return true if the command can be executed on this domain.
+     */
+    [[nodiscard]] bool owns(DomainTree::CompiledCommand const& compiled) const noexcept {
+        return compiled.root == funcTree.get();
+    }
+
     /**
      * @brief Finds possible completions of registered functions, categories and variables for a given pattern
      * @param pattern The pattern to match for completions, full command
@@ -539,6 +565,22 @@ protected:
      * @param serialOrLinkWithCommands The serialization string or link with commands to deserialize.
      */
     void baseDeserialization(std::string const& serialOrLinkWithCommands);
+
+    /**
+     * @brief First step of baseDeserialization, turning the serial or link into the document.
+     * @details Linked documents are copied from their parsed form in the document cache.
+     *          Does not require any DomainModules, so derived classes may initialize them afterward.
+     * @param serialOrLinkWithCommands The serialization string or link with commands to deserialize.
+     * @return The remaining command tokens, to be passed to applyDeserializeCommands.
+     */
+    [[nodiscard]] std::vector<std::string> deserializeDocument(std::string const& serialOrLinkWithCommands);
+
+    /**
+     * @brief Second step of baseDeserialization, parsing all commands.
+     * @details Legacy key=value tokens with plain values are set directly, without parsing a set command.
+     * @param tokens The command tokens returned by deserializeDocument.
+     */
+    void applyDeserializeCommands(std::vector<std::string> const& tokens);
 };
 } // namespace Nebulite::Interaction::Execution
 #endif // NEBULITE_INTERACTION_EXECUTION_DOMAIN_HPP
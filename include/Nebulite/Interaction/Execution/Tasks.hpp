@@ -75,6 +75,23 @@ public:
      */
     void addTask(std::string_view name, std::string_view queueName = StandardTasks::internal);
 
+    /**
+     * @brief Adds a precompiled task to the specified task queue.
+     * @param name The name of the task to add, parsed if the compiled task cannot be used.
+     * @param compiled The compiled task, see compileTask.
+     * @param queueName The name of the task queue to add the task to.
+     */
+    void addTask(std::string_view name, std::shared_ptr<Data::TaskQueue::CompiledTask const> compiled, std::string_view queueName = StandardTasks::internal);
+
+    /**
+     * @brief Compiles a task for the specified task queue, so it is not parsed when resolving.
+     * @param name The task to compile.
+     * @param domain The domain owning these tasks.
+     * @param queueName The name of the task queue the task is added to.
+     * @return The compiled task, or nullptr if it cannot be compiled.
+     */
+    std::shared_ptr<Data::TaskQueue::CompiledTask const> compileTask(std::string_view name, Domain const& domain, std::string_view queueName = StandardTasks::internal);
+
     /**
      * @brief Loads a script into the script task queue.
      * @param filename The name of the script file to add.
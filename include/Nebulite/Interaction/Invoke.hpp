@@ -6,7 +6,6 @@
 
 // Standard library
 #include <array>
-#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <ranges>
@@ -14,6 +13,7 @@
 // Nebulite
 #include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Data/BroadcastListenContainer/FlatContainer.hpp"
+#include "Nebulite/Data/BroadcastListenContainer/SubscriptionRegistry.hpp"
 
 //------------------------------------------
 // Forward declarations
@@ -48,10 +48,7 @@ public:
 
     Invoke();
 
-    /**
-     * @brief Destructor - stops worker threads.
-     */
-    ~Invoke();
+    ~Invoke() = default;
 
     // No copy or move
 
@@ -72,13 +69,21 @@ public:
     void broadcast(std::shared_ptr<Rules::Ruleset>&& entry);
 
     /**
-     * @brief Listens for rulesets on a specific topic.
+     * @brief Listens for rulesets on a specific topic, for the next update only.
      * @details Checks the specified render object against all available
      *          rulesets for the given topic. If an entry's logical condition is
      *          satisfied, it is added to the list of pairs for later evaluation.
      */
     void listen(std::shared_ptr<Rules::Listener> const& listener);
 
+    /**
+     * @brief Registers a listener persistently on its topic.
+     * @details The listener is only checked against broadcasted rulesets in updates it was activated for,
+     *          see Rules::Listener::activate. It stays registered until Rules::Listener::unsubscribe is called.
+     * @param listener The listener to register.
+     */
+    void subscribe(std::shared_ptr<Rules::Listener> const& listener);
+
     //------------------------------------------
     // Updating
 
@@ -106,13 +111,8 @@ private:
 
     decltype(worker | std::views::take(activeWorkerCount)) activeWorkers;
 
-    //------------------------------------------
-    // Threading variables
-
-    /**
-     * @brief Flag to signal threads to stop.
-     */
-    std::atomic<bool> stopFlag;
+    // All listeners, shared by all workers
+    Data::BroadcastListenContainer::SubscriptionRegistry subscriptions;
 };
 } // namespace Nebulite::Interaction
 #endif // NEBULITE_INTERACTION_INVOKE_HPP
@@ -67,6 +67,13 @@ public:
      */
     void optimize(ContextScope const& contextScope);
 
+    /**
+     * @brief Copies a parsed assignment, without parsing its expressions again.
+     * @details The copy is not optimized, as optimizations bind to the values of a specific context.
+     * @return The copy.
+     */
+    [[nodiscard]] Assignment clone() const ;
+
     //------------------------------------------
     // Since assignments are unique to a RenderObject
 
@@ -90,6 +97,12 @@ public:
      */
     [[nodiscard]] std::string const& getFullExpression() const ;
 
+    /**
+     * @brief Checks if the assignment only modifies the context other.
+     * @return True if the target document is other, false otherwise.
+     */
+    [[nodiscard]] bool targetsOther() const noexcept { return onType == ContextDeriver::TargetType::other; }
+
     /**
      * @brief Type of operation used
      */
@@ -0,0 +1,165 @@
+#ifndef NEBULITE_INTERACTION_LOGIC_BYTECODE_HPP
+#define NEBULITE_INTERACTION_LOGIC_BYTECODE_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <optional>
+#include <span>
+#include <vector>
+
+// External
+#include <tinyexpr.h>
+
+//------------------------------------------
+namespace Nebulite::Interaction::Logic {
+/**
+ * @class Nebulite::Interaction::Logic::Bytecode
+ * @brief Linear register program lowered from a compiled tinyexpr tree.
+ * @details Evaluating a te_expr tree recursively follows a pointer and dispatches on the node type for every node.
+ *          Bytecode flattens the tree once into a contiguous list of instructions,
+ *          each reading its operands from and writing its result to a small register file.
+ *          Arithmetic and the common comparison and logic functions are executed inline,
+ *          other functions are called through their pointer.
+ *          While lowering, constant subexpressions are folded and pure operands that cannot affect the result are dropped,
+ *          e.g. the right-hand side of and(0, x).
+ *          Variables are read either from their bound address in the tree,
+ *          or from a slot table provided on evaluation, allowing values to be read directly from their source document.
+ */
+class Bytecode {
+public:
+    /**
+     * @brief Maximum number of registers, limiting the nesting depth of lowered expressions.
+     */
+    static std::size_t constexpr maxRegisters = 32;
+
+    /**
+     * @brief Number of instances evaluated at once by evaluateLanes, matching four doubles of an AVX2 register.
+     */
+    static std::size_t constexpr laneCount = 4;
+
+    /**
+     * @brief Lowers a compiled tinyexpr tree to bytecode.
+     * @param expression The compiled expression. Must stay valid as long as its functions are called.
+     * @param slots The values the variables of the expression are bound to.
+     *              Variables bound to an element of slots are read through the slot table on evaluation with slots.
+     * @return The bytecode, or std::nullopt if the expression is not supported (closures or too deeply nested).
+     */
+    [[nodiscard]] static std::optional<Bytecode> compile(te_expr const* expression, std::span<double const> slots);
+
+    /**
+     * @brief Copies the bytecode, binding its slot variables to other values.
+     * @details Variables outside the slots keep their address.
+     * @param slots The values to bind to, in the same order as the slots given on compilation.
+     * @return The rebound bytecode.
+     */
+    [[nodiscard]] Bytecode rebind(std::span<double const> slots) const ;
+
+    /**
+     * @brief Evaluates the bytecode, reading variables from the addresses they were bound to.
+     * @return The result.
+     */
+    [[nodiscard]] double evaluate() const noexcept ;
+
+    /**
+     * @brief Evaluates the bytecode, reading slot variables through the given table.
+     * @param slots Pointer to the current value of each slot, must match the size of the slots given on compilation.
+     * @return The result.
+     */
+    [[nodiscard]] double evaluate(std::span<double const* const> slots) const noexcept ;
+
+    /**
+     * @brief Evaluates the bytecode for laneCount slot tables at once.
+     * @details Every instruction is applied to all lanes before moving on to the next one,
+     *          allowing the compiler to vectorize the inline operations across lanes.
+     * @param slots laneCount consecutive slot tables of slotCount entries each.
+     * @param slotCount The number of slots per table, must match the size of the slots given on compilation.
+     * @param results The result of each lane.
+     */
+    void evaluateLanes(std::span<double const* const> slots, std::size_t slotCount, std::span<double, laneCount> results) const noexcept ;
+
+    /**
+     * @brief Checks if the bytecode was folded into a single constant.
+     * @return True if the result does not depend on any variables.
+     */
+    [[nodiscard]] bool isConstant() const noexcept ;
+
+    /**
+     * @brief Gets the number of instructions.
+     * @return The instruction count.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return instructions.size(); }
+
+private:
+    Bytecode() = default;
+
+    enum class OpCode : std::uint8_t {
+        // Loads
+        constant,
+        variable, // From the bound address, or from the slot table
+        address,  // Always from the bound address
+
+        // Arithmetic
+        add,
+        subtract,
+        multiply,
+        divide,
+        modulo,
+        power,
+        negate,
+        comma,
+
+        // Comparison and logic, matching Math::ExpressionPrimitives
+        greater,
+        less,
+        greaterEqual,
+        lessEqual,
+        equal,
+        notEqual,
+        logicalNot,
+        logicalAnd,
+        logicalOr,
+        minimum,
+        maximum,
+
+        // Any other function, by arity
+        call0,
+        call1,
+        call2,
+        call3,
+        call4,
+        call5,
+        call6,
+        call7,
+    };
+
+    /**
+     * @brief A single instruction.
+     * @details Operands are registers. Calls take their arguments from consecutive registers, starting at lhs.
+     */
+    struct Instruction {
+        OpCode op;
+        std::uint8_t dst;
+        std::uint8_t lhs;
+        std::uint8_t rhs;
+        std::uint32_t slot;
+        union {
+            double constant;
+            double const* address;
+            void const* function;
+        };
+    };
+
+    template<bool useSlots>
+    [[nodiscard]] double run(double const* const* slots) const noexcept ;
+
+    std::vector<Instruction> instructions;
+
+    // Forward declaration of the compiler, which has access to the instruction layout
+    class Compiler;
+};
+} // namespace Nebulite::Interaction::Logic
+#endif // NEBULITE_INTERACTION_LOGIC_BYTECODE_HPP
@@ -10,6 +10,8 @@
 #include <cstdint> // NOLINT
 #include <cstring>
 #include <memory>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -20,6 +22,7 @@
 
 // Nebulite
 #include "Nebulite/Data/Document/Json.hpp"
+#include "Nebulite/Data/Document/ScopedKeyView.hpp"
 #include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Interaction/Logic/ExpressionComponent.hpp"
 #include "Nebulite/Interaction/Logic/LinkedNumericValue.hpp"
@@ -71,6 +74,14 @@ public:
     Expression(Expression&&) noexcept = default;
     Expression& operator=(Expression&&) noexcept = default;
 
+    /**
+     * @brief Copies the compiled expression, without parsing and compiling it again.
+     * @details The copy has its own cached values, with all variables bound to them.
+     *          Used to share compiled expressions between objects, see RulesetCompiler.
+     * @return The copy.
+     */
+    [[nodiscard]] Expression clone() const ;
+
     /**
      * @brief Standard maximum recursion depth for nested expression evaluations.
      */
@@ -115,6 +126,20 @@ public:
      */
     bool isAlwaysTrue() const noexcept { return evaluationInfo.alwaysTrue; }
 
+    /**
+     * @brief Checks if the expression can be evaluated for many contexts other at once, see evalAsBoolBatch.
+     * @details True for simple expressions lowered to bytecode that only reference stable values of self, other and global.
+     * @return True if the expression is batchable, false otherwise.
+     */
+    bool isBatchable() const noexcept { return evaluationInfo.batchable; }
+
+    /**
+     * @brief Checks if the expression is plain text, without any variables or evaluations.
+     * @details Plain text expressions evaluate to the same string in any context.
+     * @return True if the expression is plain text, false otherwise.
+     */
+    bool isPlainText() const noexcept { return evaluationInfo.plainText; }
+
     //------------------------------------------
     // Actual evaluation functions
 
@@ -165,6 +190,27 @@ public:
      */
     [[nodiscard]] bool evalAsBool(ContextScope const& context, Utility::Promise<&Expression::isReturnableAsBool> promise) const ;
 
+    /**
+     * @brief Evaluates the expression as a boolean for a shared self and global, and many contexts other.
+     * @details The values of each other are read through their ordered cache lists and evaluated in lanes,
+     *          see Bytecode::evaluateLanes.
+     * @param self The self scope, shared by all evaluations.
+     * @param others The other scope of each evaluation.
+     * @param global The global scope, shared by all evaluations.
+     * @param results Bitmask of the results, resized to the number of others.
+     * @param promise A promise that the expression is batchable.
+     */
+    void evalAsBoolBatch(Data::JsonScope& self, std::span<Data::JsonScope* const> others, Data::JsonScope& global, std::vector<bool>& results, Utility::Promise<&Expression::isBatchable> promise) const ;
+
+    /**
+     * @brief Evaluates the expression as a double by walking the TinyExpr tree, bypassing the bytecode.
+     * @details Reference path for benchmarking and verifying the bytecode evaluation in evalAsDouble.
+     * @param context The context to evaluate the expression against.
+     * @param promise A promise that the expression is returnable as a double, see evalAsDouble.
+     * @return The result of the evaluation as a double.
+     */
+    [[nodiscard]] double evalAsDoubleWithTinyExpr(ContextScope const& context, Utility::Promise<&Expression::isReturnableAsDouble> promise) const ;
+
     //------------------------------------------
     // Static functions for one-time evaluation
 
@@ -181,7 +227,33 @@ public:
      */
     [[nodiscard]] std::string const& getFullExpression() const noexcept ;
 
+    //------------------------------------------
+    // Dependencies
+
+    /**
+     * @struct Nebulite::Interaction::Logic::Expression::Dependency
+     * @brief A document value the expression reads.
+     */
+    struct Dependency {
+        ContextDeriver::TargetType context;
+        Data::ScopedKeyView key; // Points into the expression, valid for its lifetime
+        bool numeric; // Read as a double inside an evaluation, otherwise as a variable
+    };
+
+    /**
+     * @brief Lists the document values the expression reads, so callers can skip evaluations while none of them changed.
+     * @details Only known before evaluation if all keys are static and read from self, other or global.
+     *          Nested keys, transformations and other contexts are resolved during evaluation.
+     * @return The dependencies, or std::nullopt if they are not known before evaluation.
+     */
+    [[nodiscard]] std::optional<std::vector<Dependency>> getDependencies() const ;
+
 private:
+    /**
+     * @brief Empty expression, only used by clone.
+     */
+    Expression() = default;
+
     /**
      * @brief The maximum recursion depth without temporary string allocation
      * @details Used for Utility::Coordination::RecursionAllocator
@@ -223,6 +295,18 @@ private:
          * @details E.g.: $(1)
          */
         bool alwaysTrue = false;
+
+        /**
+         * @brief True if the expression is a simple expression with bytecode, referencing only stable values
+         * @details E.g.: $(gt({self:posX}, {other:posX}))
+         */
+        bool batchable = false;
+
+        /**
+         * @brief True if the expression only consists of text components, evaluating to the same string in any context
+         * @details E.g.: "echo Hello World"
+         */
+        bool plainText = false;
     };
 
     void recalculateEvaluationInfo() noexcept ;
@@ -317,6 +401,12 @@ private:
          * @param v The double reference to register
          */
         void registerLnv(ContextDeriver::TargetType contextType, std::string_view key, double& v);
+
+        /**
+         * @brief Checks if all registered values are stable.
+         * @return True if no unstable values are registered, false otherwise.
+         */
+        [[nodiscard]] bool hasOnlyStableValues() const noexcept ;
     } linkedNumericValues;
 
     /**
@@ -349,6 +439,32 @@ private:
     */
     void updateUnstableValues(ContextScope const& context) const ;
 
+    /**
+     * @brief Resolves the current value address of each cached variable for bytecode evaluation.
+     * @details Stable values point directly into the ordered cache lists of the context documents, skipping the copy into the cache.
+     *          Unstable values point to the cache and must be updated beforehand.
+     *          The returned table is thread-local and only valid until the next call on this thread.
+     * @param context The context to resolve the values for
+     * @return The slot table, matching the order of the cached values
+     */
+    [[nodiscard]] std::span<double const* const> resolveSlots(ContextScope const& context) const ;
+
+    /**
+     * @brief Points the slots of stable values into the ordered cache list of a document.
+     * @param scope The document to resolve the values from
+     * @param lnvList The stable values of the document
+     * @param id The unique id of the ordered cache list
+     * @param slots The slot table to modify
+     */
+    void resolveStableSlots(Data::JsonScope& scope, LinkedNumericValueLists::LnvList const& lnvList, std::uint64_t id, std::span<double const*> slots) const ;
+
+    /**
+     * @brief Evaluates the single eval component as a double, preferring its bytecode.
+     * @param context The context to evaluate against
+     * @return The evaluation result
+     */
+    [[nodiscard]] double evalSimpleExpression(ContextScope const& context) const ;
+
     //------------------------------------------
     // Data
 
@@ -10,6 +10,7 @@
 #include <expected>
 #include <functional>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -21,6 +22,7 @@
 // Nebulite
 #include "Nebulite/Data/Document/Json.hpp"
 #include "Nebulite/Interaction/Context.hpp"
+#include "Nebulite/Interaction/Logic/Bytecode.hpp"
 #include "Nebulite/Interaction/Logic/Formatter.hpp"
 
 //------------------------------------------
@@ -52,11 +54,34 @@ public:
     ExpressionComponent(ExpressionComponent const&) = delete;
     ExpressionComponent& operator=(ExpressionComponent const&) = delete;
 
-    // enable moving
-    ExpressionComponent(ExpressionComponent&& other) = default ;
-    ExpressionComponent& operator=(ExpressionComponent&& other) = default ;
+    // enable moving, taking ownership of the tinyexpr representation
+    ExpressionComponent(ExpressionComponent&& other) noexcept
+        : type(other.type),
+          contextType(other.contextType),
+          formatter(other.formatter),
+          stringRepresentation(std::move(other.stringRepresentation)),
+          key(std::move(other.key)),
+          evaluationWait(other.evaluationWait),
+          expression(std::exchange(other.expression, nullptr)),
+          bytecode(std::move(other.bytecode)) {}
+
+    ExpressionComponent& operator=(ExpressionComponent&& other) noexcept {
+        if (this != &other) {
+            reset();
+            type = other.type;
+            contextType = other.contextType;
+            formatter = other.formatter;
+            stringRepresentation = std::move(other.stringRepresentation);
+            key = std::move(other.key);
+            evaluationWait = other.evaluationWait;
+            expression = std::exchange(other.expression, nullptr);
+            bytecode = std::move(other.bytecode);
+        }
+        return *this;
+    }
 
     void reset() {
+        bytecode.reset();
         if (expression != nullptr) {
             te_free(expression);
             expression = nullptr;
@@ -107,15 +132,42 @@ public:
 
     /**
      * @brief Compiles a component, if its of type Expression
+     * @details After compiling with TinyExpr, the expression is lowered to bytecode if possible.
      * @param teVariables The vector of TinyExpr variables
+     * @param slots The cached values the variables are bound to, see Bytecode::compile
+     */
+    int compile(std::vector<te_variable> const& teVariables, std::span<double const> slots);
+
+    /**
+     * @brief Copies a compiled component, binding its variables to other values.
+     * @details Copies the tinyexpr representation and bytecode instead of compiling the component again.
+     * @param from The cached values the variables of this component are bound to.
+     * @param to The cached values to bind the copy to, in the same order.
+     * @return The rebound copy.
      */
-    int compile(std::vector<te_variable> const& teVariables);
+    [[nodiscard]] ExpressionComponent rebind(std::span<double const> from, std::span<double const> to) const ;
 
     //------------------------------------------
     // Getter
 
     [[nodiscard]]  std::string const& getStringRepresentation() const ;
 
+    //------------------------------------------
+    // Dependencies
+
+    /**
+     * @brief Checks if the component is a variable whose key is only resolved during evaluation.
+     * @details True for nested keys and transformations, e.g. {global:{self:key}} or {self:list|length}.
+     */
+    [[nodiscard]] bool hasDynamicKey() const noexcept ;
+
+    /**
+     * @brief Gets the document value a variable component reads.
+     * @details Delayed variables read nothing, as they evaluate to their own text.
+     * @return The context and context-stripped key, or std::nullopt for other components, delayed variables and dynamic keys.
+     */
+    [[nodiscard]] std::optional<std::pair<ContextDeriver::TargetType, std::string_view>> getStaticVariable() const noexcept ;
+
     //------------------------------------------
     // Returnability
 
@@ -125,6 +177,14 @@ public:
 
     [[nodiscard]] bool isReturnableAsString() const noexcept;
 
+    [[nodiscard]] bool isText() const noexcept { return type == Type::text; }
+
+    /**
+     * @brief Checks if the component was lowered to bytecode.
+     * @return True if evaluation with a slot table is available.
+     */
+    [[nodiscard]] bool hasBytecode() const noexcept { return bytecode.has_value(); }
+
     //------------------------------------------
     // Evaluation
 
@@ -149,6 +209,34 @@ public:
         return evalAsDoubleImpl();
     }
 
+    /**
+     * @brief Evaluates the component as a double, reading variables through a slot table.
+     * @details Only valid if the component is returnable as double or int and has bytecode!
+     * @param slots Pointer to the current value of each cached variable.
+     * @return The evaluation result as a double.
+     */
+    [[nodiscard]] double evalAsDouble(std::span<double const* const> slots) const noexcept {
+        return bytecode->evaluate(slots);
+    }
+
+    /**
+     * @brief Evaluates the component for multiple slot tables at once.
+     * @details Only valid if the component is returnable as double or int and has bytecode!
+     * @param slots Bytecode::laneCount consecutive slot tables, see Bytecode::evaluateLanes.
+     * @param slotCount The number of slots per table.
+     * @param results The evaluation result of each table.
+     */
+    void evalAsDoubleLanes(std::span<double const* const> const slots, std::size_t const slotCount, std::span<double, Bytecode::laneCount> const results) const noexcept {
+        bytecode->evaluateLanes(slots, slotCount, results);
+    }
+
+    /**
+     * @brief Evaluates the component as a double by walking the TinyExpr tree, bypassing the bytecode.
+     * @details Used for comparing both evaluation paths. Caches must be up-to-date.
+     * @return The evaluation result as a double.
+     */
+    [[nodiscard]] double evalAsDoubleWithTinyExpr() const ;
+
     /**
      * @brief Evaluates the component as a JSON object.
      * @tparam F The type of the function object to update caches.
@@ -196,6 +284,11 @@ private:
      */
     te_expr* expression = nullptr;
 
+    /**
+     * @brief Bytecode lowered from the tinyexpr representation, used for evaluation if available.
+     */
+    std::optional<Bytecode> bytecode;
+
     /**
      * @brief Default constructor for Component.
      */
@@ -68,6 +68,14 @@ public:
         return scopedKey;
     }
 
+    /**
+     * @brief Get the linked value this LinkedNumericValue writes to.
+     * @return Pointer to the linked value.
+     */
+    [[nodiscard]] double const* getReference() const noexcept {
+        return reference;
+    }
+
     /**
      * @brief Copies the value from another JSON document.
      * @param json The JSON document to copy from.
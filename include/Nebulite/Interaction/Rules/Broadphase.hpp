@@ -0,0 +1,62 @@
+#ifndef NEBULITE_INTERACTION_RULES_BROADPHASE_HPP
+#define NEBULITE_INTERACTION_RULES_BROADPHASE_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <array>
+#include <cstdint> // NOLINT
+
+// Nebulite
+#include "Nebulite/Constants/KeyNames.hpp"
+
+//------------------------------------------
+// Forward declarations
+
+namespace Nebulite::Interaction::Execution {
+class Domain;
+} // namespace Nebulite::Interaction::Execution
+
+//------------------------------------------
+namespace Nebulite::Interaction::Rules {
+/**
+ * @struct Broadphase
+ * @brief Keys and helpers for the spatial broad-phase of global rulesets.
+ * @details Global rulesets may opt into the broad-phase by declaring an interaction radius.
+ *          Their broadcaster is then only paired with listeners whose bounding box overlaps
+ *          the bounding box of the broadcaster, expanded by that radius.
+ *          Bounding boxes span from (posX, posY) to (posX + size.x, posY + size.y).
+ */
+struct Broadphase {
+    /**
+     * @brief List of keys making up the bounding box of a domain.
+     */
+    static std::array constexpr boundsKeys = {
+        Constants::KeyNames::RenderObject::positionX,
+        Constants::KeyNames::RenderObject::positionY,
+        Constants::KeyNames::RenderObject::sizeX,
+        Constants::KeyNames::RenderObject::sizeY,
+    };
+
+    /**
+     * @enum Key
+     * @brief Enumeration of keys corresponding to the bounding box values.
+     *        Used for indexing into the ordered cache list.
+     */
+    enum class Key : std::uint8_t {
+        posX,
+        posY,
+        sizeX,
+        sizeY,
+    };
+
+    /**
+     * @brief Ensures the ordered cache list of the bounding box values of a domain.
+     * @param domain The domain to retrieve the bounding box of.
+     * @return The ordered cache list, indexable with Broadphase::Key. nullptr if the list could not be created.
+     */
+    static double** ensureBounds(Execution::Domain const& domain);
+};
+} // namespace Nebulite::Interaction::Rules
+#endif // NEBULITE_INTERACTION_RULES_BROADPHASE_HPP
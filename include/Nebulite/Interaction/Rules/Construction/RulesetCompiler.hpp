@@ -65,21 +65,70 @@ public:
      */
     static std::optional<std::shared_ptr<Ruleset>> parseSingle(std::string_view identifier, Execution::Domain& self);
 
+    /**
+     * @brief Drops all compiled rulesets, so each source is compiled again on its next use.
+     * @details Rulesets already created keep their own expressions. Used to benchmark spawning without the cache.
+     */
+    static void clearCompiledRulesets();
+
 private:
     /**
-     * @brief Extracts function calls from a JSON entry document.
-     * @param entryDoc The JSON document containing the entry.
+     * @struct CompiledRuleset
+     * @brief The immutable, domain-independent form of a JSON-defined ruleset, with all expressions compiled.
+     * @details Shared by all domains referencing the same ruleset source, see getCompiledRuleset.
+     *          Its expressions are never evaluated. Each domain clones them, so only the cached values and the
+     *          bindings to the stable values of the domain are created per domain.
+     */
+    struct CompiledRuleset;
+
+    /**
+     * @struct CompiledRulesetCache
+     * @brief Compiled rulesets, keyed by their serialized source.
+     */
+    struct CompiledRulesetCache;
+
+    /**
+     * @brief Gets the shared cache of compiled rulesets.
+     */
+    static CompiledRulesetCache& compiledRulesetCache();
+
+    /**
+     * @brief Gets the compiled form of a serialized JSON ruleset, compiling it only on first use.
+     * @details Thread-safe. Keyed by content instead of by link, so entries stay valid if a linked document changes.
+     * @param serial The serialized ruleset.
+     * @return The shared compiled ruleset.
+     */
+    static std::shared_ptr<CompiledRuleset const> getCompiledRuleset(std::string const& serial);
+
+    /**
+     * @brief Compiles a ruleset from a JSON entry document.
+     * @param entry The JSON entry document.
+     * @return The compiled ruleset.
+     */
+    static std::shared_ptr<CompiledRuleset const> compileEntry(Data::JsonScope const& entry);
+
+    /**
+     * @brief Extracts the strings of an array member of a JSON entry document.
+     * @param entry The JSON entry document.
+     * @param key The key of the array.
+     * @return All strings of the array, empty if the member is not an array.
+     */
+    static std::vector<std::string> getStrings(Data::JsonScope const& entry, Data::ScopedKeyView const& key);
+
+    /**
+     * @brief Creates the function calls of a ruleset from its compiled form.
+     * @details Plain text calls on self and global are compiled once, see Data::TaskQueue::compile.
+     * @param compiled The compiled ruleset.
      * @param ruleset The Ruleset object to populate with function calls.
      */
-    static void getFunctionCalls(Data::JsonScope const& entryDoc, JsonRuleset& ruleset);
+    static void getFunctionCalls(CompiledRuleset const& compiled, JsonRuleset& ruleset);
 
     /**
-     * @brief Extracts all expressions from a JSON entry document.
-     * @param ruleset The Ruleset object to populate with expressions.
-     * @param entry The JSON entry document to extract expressions from.
-     * @return True if the expressions were successfully extracted, false otherwise.
+     * @brief Creates all assignments of a ruleset from its compiled form.
+     * @param compiled The compiled ruleset.
+     * @param ruleset The Ruleset object to populate with assignments.
      */
-    static bool getAssignments(std::shared_ptr<JsonRuleset> const& ruleset, Data::JsonScope const& entry);
+    static void getAssignments(CompiledRuleset const& compiled, JsonRuleset& ruleset);
 
     /**
      * @brief Extracts a logical argument from a JSON entry document.
@@ -89,13 +138,12 @@ private:
     static std::string getCondition(Data::JsonScope const& entry);
 
     /**
-     * @brief Extracts a Ruleset object from a JSON entry document.
+     * @brief Gets the serialized source of a JSON-defined ruleset.
      * @param doc The JSON document containing the entry.
-     * @param entry The JSON document to populate with the entry.
-     * @param key The key of the entry in the document.
-     * @return True if the Ruleset was successfully extracted, false otherwise.
+     * @param key The key of the entry in the document, holding an object or a link to a document.
+     * @return The serialized ruleset, or std::nullopt if the entry is no JSON-defined ruleset.
      */
-    static bool getJsonRuleset(Data::JsonScope const& doc, Data::JsonScope& entry, Data::ScopedKeyView const& key);
+    static std::optional<std::string> getSerializedRuleset(Data::JsonScope const& doc, Data::ScopedKeyView const& key);
 
     /**
      * @brief Extracts a Ruleset from a JSON document or static ruleset identifier.
@@ -114,6 +162,15 @@ private:
      */
     static void optimize(std::shared_ptr<JsonRuleset> const& entry, Data::JsonScope& self);
 
+    /**
+     * @brief Opts a global ruleset into the spatial broad-phase, if an interaction radius is given.
+     * @details Local rulesets are never broadcasted, so they ignore the radius.
+     * @param ruleset The Ruleset object to modify.
+     * @param interactionRadius The interaction radius, negative values are clamped to 0.
+     * @param self The Domain instance associated with the entry, providing the bounding box.
+     */
+    static void setInteractionRadius(Ruleset& ruleset, std::optional<double> const& interactionRadius, Execution::Domain const& self);
+
     /**
      * @brief Sets metadata in the object.
      * @param rulesets The vector of Ruleset objects to set metadata for.
@@ -5,12 +5,19 @@
 // Includes
 
 // Standard library
+#include <atomic>
+#include <cstdint> // NOLINT
+#include <mutex>
 #include <string>
 #include <string_view>
 
 //------------------------------------------
 // Forward declarations
 
+namespace Nebulite::Data::BroadcastListenContainer {
+class SubscriptionRegistry;
+} // namespace Nebulite::Data::BroadcastListenContainer
+
 namespace Nebulite::Interaction::Execution {
 class Domain;
 } // namespace Nebulite::Interaction::Execution
@@ -28,6 +35,7 @@ struct Listener {
     Execution::Domain& domain;
     std::string topic;
     double** otr; // Pointer to the ordered cache list of the listener, for performance when evaluating rulesets
+    std::uint32_t topicId = 0; // Interned topic, assigned on registration, see Data::BroadcastListenContainer::SubscriptionRegistry
 
     // Listener is owned by a single Domain, no copy or move semantics
 
@@ -35,6 +43,41 @@ struct Listener {
     Listener& operator=(Listener const&) = delete;
     Listener(Listener&&) = delete;
     Listener& operator=(Listener&&) = delete;
+
+    /**
+     * @brief Retrieves the ordered cache list of the listeners bounding box, used by the spatial broad-phase.
+     * @details Initialized on first use, as most topics never use the broad-phase.
+     * @return The ordered cache list, indexable with Broadphase::Key. nullptr if the list could not be created.
+     */
+    double** getBounds();
+
+    /**
+     * @brief Marks the listener as active for the next processing round.
+     * @details Only active listeners are paired with broadcasted rulesets.
+     *          Thread-safe, the flag is reset once the round is prepared.
+     */
+    void activate() {
+        active.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Removes the listener from the registry on the next processing round.
+     * @details Thread-safe. Does not access the registry, so it is safe to call during shutdown.
+     *          The domain of the listener is not accessed afterward.
+     */
+    void unsubscribe() {
+        subscribed.store(false, std::memory_order_relaxed);
+        active.store(false, std::memory_order_relaxed);
+    }
+
+private:
+    friend class Data::BroadcastListenContainer::SubscriptionRegistry;
+
+    std::once_flag boundsInitialized;
+    double** bounds = nullptr;
+
+    std::atomic<bool> active{false};
+    std::atomic<bool> subscribed{false};
 };
 } // namespace Nebulite::Interaction::Rules
 #endif // NEBULITE_INTERACTION_RULES_LISTENER_HPP
@@ -10,10 +10,13 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 // Nebulite
+#include "Nebulite/Data/TaskQueue.hpp"
 #include "Nebulite/Interaction/Logic/Assignment.hpp"
 #include "Nebulite/Interaction/Logic/Expression.hpp"
 
@@ -99,6 +102,24 @@ public:
      */
     [[nodiscard]] bool isGlobal() const { return !topic.empty(); }
 
+    /**
+     * @brief Checks whether the ruleset opted into the spatial broad-phase.
+     * @return True if the ruleset is only paired with listeners inside its interaction radius, false otherwise.
+     */
+    [[nodiscard]] bool usesBroadphase() const { return interactionRadius.has_value(); }
+
+    /**
+     * @brief Returns the interaction radius of the ruleset, used by the spatial broad-phase.
+     * @return The interaction radius, or 0 if the ruleset does not use the broad-phase.
+     */
+    [[nodiscard]] double getInteractionRadius() const { return interactionRadius.value_or(0.0); }
+
+    /**
+     * @brief Returns the ordered cache list of the bounding box of the ruleset owner.
+     * @return The ordered cache list, indexable with Broadphase::Key. nullptr if the ruleset does not use the broad-phase.
+     */
+    [[nodiscard]] double** getBounds() const { return bounds; }
+
     //------------------------------------------
     // Methods: Workflow
 
@@ -110,6 +131,18 @@ public:
      */
     virtual bool evaluateConditionGlobally(Execution::Domain& other, Execution::Domain& global);
 
+    /**
+     * @brief Checks if the ruleset is true in the context of each listener.
+     * @details All conditions are evaluated before the ruleset is applied to any of the listeners.
+     *          Rulesets for which this is not equivalent to evaluating and applying each listener in turn must return false.
+     *          The default implementation does not support batches.
+     * @param listeners The listeners to evaluate the condition for.
+     * @param global The global context.
+     * @param matches Bitmask set to one entry per listener, true if the condition holds for that listener.
+     * @return True if the batch was evaluated, false if each listener has to be evaluated separately.
+     */
+    virtual bool evaluateConditionBatch(std::span<std::shared_ptr<Listener> const> listeners, Execution::Domain& global, std::vector<bool>& matches);
+
     /**
      * @brief Checks if the ruleset is true with its own Domain as context other.
      * @param global The global context
@@ -158,17 +191,25 @@ protected:
      * @todo Use topicId instead? + modulo-based rulesetMap?
      */
     std::string topic = "all";
+
+    /**
+     * @brief The radius around the bounding box of the owner in which listeners are considered.
+     * @details If set, the ruleset opts into the spatial broad-phase of the broadcast-listen container:
+     *          only listeners with overlapping bounding boxes are evaluated. A radius of 0 means direct overlap.
+     */
+    std::optional<double> interactionRadius = std::nullopt;
+
+    /**
+     * @brief Ordered cache list of the bounding box of the owner, only set if the broad-phase is used.
+     */
+    double** bounds = nullptr;
 };
 
 /**
  * @class Nebulite::Interaction::Rules::StaticRuleset
  * @brief Represents a single ruleset entry for static rulesets.
- * @todo Add proximity-based specialisation, storing the broadcaster/listener tile position
- *       Only do additional checks if max([abs(x1-x2), abs(y1-y2)]) <= 1
- *       Make tilePos optional, if either 1 or 2 is not set, do the additional checks anyways
- *       We need a proper way to store current tile pos of broadcaster and listener,
- *       making sure the data is always up to date!
- *       Examples for proximity-based rulesets: Collision, Attack damage
+ * @details Proximity-based rulesets such as collisions should declare an interaction radius on binding,
+ *          so that the spatial broad-phase filters out pairs that are too far apart.
  */
 class StaticRuleset final : public Ruleset {
 public:
@@ -286,6 +327,17 @@ public:
      */
     bool evaluateConditionLocally(Execution::Domain& global) override { return evaluateConditionGlobally(self, global); }
 
+    /**
+     * @brief Checks if the ruleset is true in the context of each listener.
+     * @details Supported if the condition is always true, or if it is batchable and the ruleset only modifies other.
+     *          The condition is then evaluated for multiple listeners at once, see Logic::Expression::evalAsBoolBatch.
+     * @param listeners The listeners to evaluate the condition for.
+     * @param global The global context.
+     * @param matches Bitmask set to one entry per listener, true if the condition holds for that listener.
+     * @return True if the batch was evaluated, false if each listener has to be evaluated separately.
+     */
+    bool evaluateConditionBatch(std::span<std::shared_ptr<Listener> const> listeners, Execution::Domain& global, std::vector<bool>& matches) override ;
+
     /**
      * @brief Applies the ruleset with a full context given
      */
@@ -315,23 +367,42 @@ private:
      */
     std::unique_ptr<Logic::Expression> logicalArg;
 
+    /**
+     * @struct FunctionCall
+     * @brief A function call of the ruleset, with its compiled task if it is plain text.
+     */
+    struct FunctionCall {
+        Logic::Expression expression;
+        std::string command; // The evaluated command, only set if compiled
+        std::shared_ptr<Data::TaskQueue::CompiledTask const> compiled = nullptr; // Only set for plain text calls on self and global
+    };
+
     /**
      * @brief The function calls that to be executed on global domain.
      * @details Vector of function calls, e.g. "echo example"
      */
-    std::vector<Logic::Expression> functioncallsGlobal;
+    std::vector<FunctionCall> functioncallsGlobal;
 
     /**
      * @brief The function calls that to be executed on self domain.
      * @details Vector of function calls, e.g. "mirror on"
      */
-    std::vector<Logic::Expression> functioncallsSelf;
+    std::vector<FunctionCall> functioncallsSelf;
 
     /**
      * @brief The function calls that to be executed on other domain.
      * @details Vector of function calls, e.g. "mirror on"
+     *          Never compiled, as the other domain differs per application.
+     */
+    std::vector<FunctionCall> functioncallsOther;
+
+    /**
+     * @brief Sends a function call as task to a domain, without parsing if it was compiled for that domain.
+     * @param domain The domain to send the task to.
+     * @param call The function call.
+     * @param contextScope The context scope to evaluate the call in.
      */
-    std::vector<Logic::Expression> functioncallsOther;
+    static void sendFunctionCall(Execution::Domain& domain, FunctionCall const& call, ContextScope const& contextScope);
 
     /**
      * @brief The expressions that are evaluated and applied to the corresponding domains.
@@ -5,6 +5,7 @@
 // Includes
 
 // Standard library
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -46,6 +47,7 @@ public:
         std::string_view description;
         StaticRuleset::Function function = nullptr;
         StaticRuleset::BaseListFunction baseListFunc = nullptr;
+        std::optional<double> interactionRadius = std::nullopt; // Opts into the spatial broad-phase if set
     };
 
     StaticRulesetMap();
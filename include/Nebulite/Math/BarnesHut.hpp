@@ -0,0 +1,120 @@
+#ifndef NEBULITE_MATH_BARNESHUT_HPP
+#define NEBULITE_MATH_BARNESHUT_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <limits>
+#include <span>
+#include <vector>
+
+//------------------------------------------
+namespace Nebulite::Math {
+/**
+ * @class BarnesHut
+ * @brief Quadtree approximation of pairwise inverse-square fields, such as gravity.
+ * @details All bodies are sorted into a quadtree, where each node stores the total mass and center of mass of its region.
+ *          Evaluating the field at a point then treats any node as a single body if it appears small enough from that point,
+ *          reducing the cost of evaluating all N bodies from O(N^2) to O(N log N).
+ *          Nodes are stored contiguously and reused between builds.
+ */
+class BarnesHut {
+public:
+    struct Body {
+        double x;
+        double y;
+        double mass;
+    };
+
+    struct Vector {
+        double x;
+        double y;
+    };
+
+    /**
+     * @brief Maximum depth of the tree. Bodies at the same position beyond this depth share a node.
+     */
+    static std::uint32_t constexpr maxDepth = 48;
+
+    /**
+     * @brief Builds the tree from the given bodies, discarding the previous tree.
+     * @details Bodies with a mass of zero or non-finite values do not contribute to the field.
+     * @param bodies The bodies to insert.
+     */
+    void build(std::span<Body const> bodies);
+
+    /**
+     * @brief Evaluates the field sum(m * d / (|d|^2 + softening)^(3/2)) at the given position.
+     * @details d is the vector from the position to each body, so the result points towards the masses.
+     *          Multiply by G and the mass at the position to get the gravitational force.
+     * @param x The x position to evaluate.
+     * @param y The y position to evaluate.
+     * @param theta The opening angle. A node is approximated as a single body if its size divided by its distance is below theta.
+     *              0 evaluates all bodies exactly, 0.5 is a common tradeoff between speed and accuracy.
+     * @param softening Added to the squared distance, avoiding singularities for close bodies.
+     * @return The field at the given position.
+     */
+    [[nodiscard]] Vector field(double x, double y, double theta, double softening) const ;
+
+    /**
+     * @brief Returns the number of nodes in the current tree.
+     * @return The node count.
+     */
+    [[nodiscard]] std::size_t nodeCount() const { return nodes.size(); }
+
+private:
+    static std::uint32_t constexpr none = std::numeric_limits<std::uint32_t>::max();
+
+    struct Node {
+        // Geometric center and half the side length of the square region
+        double centerX;
+        double centerY;
+        double halfSize;
+
+        // Total mass and center of mass.
+        // While building, the center holds the mass-weighted position sum instead.
+        double mass = 0.0;
+        double massX = 0.0;
+        double massY = 0.0;
+
+        // Index of the first of four consecutive children, none for leaves
+        std::uint32_t firstChild = none;
+
+        // Index of the body stored in a leaf, none for empty leaves
+        std::uint32_t body = none;
+    };
+
+    /**
+     * @brief Inserts a body into the tree, subdividing leaves as needed.
+     * @param index The index of the body in bodies.
+     */
+    void insert(std::uint32_t index);
+
+    /**
+     * @brief Creates the four children of a leaf.
+     * @param node The index of the node to subdivide.
+     */
+    void subdivide(std::uint32_t node);
+
+    /**
+     * @brief Returns the child of a subdivided node containing the given position.
+     * @param node The index of the parent node.
+     * @param x The x position.
+     * @param y The y position.
+     * @return The index of the child node.
+     */
+    [[nodiscard]] std::uint32_t childOf(std::uint32_t node, double x, double y) const ;
+
+    /**
+     * @brief Adds the mass of a body to a node.
+     */
+    static void accumulate(Node& node, Body const& body);
+
+    std::vector<Node> nodes;
+    std::vector<Body> bodies;
+};
+} // namespace Nebulite::Math
+#endif // NEBULITE_MATH_BARNESHUT_HPP
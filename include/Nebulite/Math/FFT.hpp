@@ -6,12 +6,17 @@
 
 // Standard Library
 #include <complex>
+#include <span>
 #include <vector>
 
 //------------------------------------------
 namespace Nebulite::Math {
 /**
  * @brief A class that provides static methods for performing Fast Fourier Transform (FFT) and related operations on audio data.
+ * @details Transforms of each length are planned once and the plan is cached: twiddle factors and the bit-reversal permutation
+ *          for powers of two, the radix factorization for lengths with small prime factors only,
+ *          and the chirp and its spectrum for all other lengths, which are transformed with Bluestein's algorithm.
+ *          Plans are shared between threads, transforms may run concurrently.
  */
 class Fft {
 public:
@@ -29,6 +34,29 @@ public:
      */
     static std::vector<std::complex<double>> fftInverse(std::vector<std::complex<double>> const& xValues);
 
+    /**
+     * @brief Computes the discrete Fourier transform in place, without padding.
+     * @details Any length is supported. Unlike fft, the length is not rounded up to the next power of two.
+     * @param data The data to transform, replaced by its spectrum.
+     */
+    static void transform(std::span<std::complex<double>> data);
+
+    /**
+     * @brief Computes the inverse discrete Fourier transform in place, without padding.
+     * @details Any length is supported. The result is normalized, so that transformInverse undoes transform.
+     * @param data The spectrum to transform, replaced by its time-domain data.
+     */
+    static void transformInverse(std::span<std::complex<double>> data);
+
+    /**
+     * @brief Computes the discrete Fourier transform of real data, without padding.
+     * @details Even lengths are packed into a complex transform of half the length.
+     *          The spectrum of real data is conjugate-symmetric, so only the non-redundant half is returned.
+     * @param data The real data to transform.
+     * @return The first data.size()/2 + 1 frequency bins.
+     */
+    static std::vector<std::complex<double>> transformReal(std::span<double const> data);
+
     /**
      * @brief Applies a transfer function defined by the given numerator and denominator coefficients to the input sound data in the frequency domain.
      * @param data The input sound data to which the transfer function will be applied.
@@ -0,0 +1,98 @@
+#ifndef NEBULITE_MATH_REDUCTION_HPP
+#define NEBULITE_MATH_REDUCTION_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <span>
+
+//------------------------------------------
+namespace Nebulite::Math {
+/**
+ * @class Nebulite::Math::Reduction
+ * @brief Reductions over contiguous arrays of doubles.
+ * @details Each reduction keeps independent partial results in several lanes,
+ *          combined only at the end. Without reassociation flags like -ffast-math,
+ *          compilers may only vectorize floating-point reductions written this way.
+ *          Results may differ from a sequential reduction in the last bits.
+ */
+class Reduction {
+public:
+    /**
+     * @brief Number of independent partial results, enough to fill a 256-bit vector of doubles.
+     */
+    static std::size_t constexpr lanes = 4;
+    static_assert(lanes == 4, "Partial results are combined pairwise for exactly four lanes.");
+
+    static double sum(std::span<double const> const values) {
+        return reduce(values, 0.0, std::plus<>{});
+    }
+
+    static double product(std::span<double const> const values) {
+        return reduce(values, 1.0, std::multiplies<>{});
+    }
+
+    static double min(std::span<double const> const values) {
+        return reduce(values, std::numeric_limits<double>::infinity(), [](double const a, double const b) { return b < a ? b : a; });
+    }
+
+    static double max(std::span<double const> const values) {
+        return reduce(values, -std::numeric_limits<double>::infinity(), [](double const a, double const b) { return a < b ? b : a; });
+    }
+
+    /**
+     * @brief Sum of squared deviations from a mean, the numerator of the variance.
+     */
+    static double squaredDeviations(std::span<double const> const values, double const mean) {
+        std::array<double, lanes> partial{};
+        std::size_t i = 0;
+        for (; i + lanes <= values.size(); i += lanes) {
+            for (std::size_t lane = 0; lane < lanes; lane++) {
+                double const deviation = values[i + lane] - mean;
+                partial[lane] += deviation * deviation;
+            }
+        }
+        for (; i < values.size(); i++) {
+            double const deviation = values[i] - mean;
+            partial[0] += deviation * deviation;
+        }
+        return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+    }
+
+    /**
+     * @brief Checks if any value is NaN.
+     */
+    static bool containsNan(std::span<double const> const values) {
+        // Branchless, so the check vectorizes as well
+        bool nan = false;
+        for (double const value : values) {
+            nan |= std::isnan(value);
+        }
+        return nan;
+    }
+
+private:
+    template <typename F>
+    static double reduce(std::span<double const> const values, double const identity, F const& f) {
+        std::array<double, lanes> partial;
+        partial.fill(identity);
+        std::size_t i = 0;
+        for (; i + lanes <= values.size(); i += lanes) {
+            for (std::size_t lane = 0; lane < lanes; lane++) {
+                partial[lane] = f(partial[lane], values[i + lane]);
+            }
+        }
+        for (; i < values.size(); i++) {
+            partial[0] = f(partial[0], values[i]);
+        }
+        return f(f(partial[0], partial[1]), f(partial[2], partial[3]));
+    }
+};
+} // namespace Nebulite::Math
+#endif // NEBULITE_MATH_REDUCTION_HPP
@@ -32,6 +32,8 @@ public:
 
     virtual void postRenderUpdate();
 
+    virtual void addUpdateStats(Graphics::RmlInterface::UpdateStats& stats) const;
+
     virtual void processRmlUiEvent(SDL_Event const& event, int keyModifiers, Rml::Element* focusElement);
 
     void OnDocumentOpen(Rml::Context* /*context*/, Rml::String const& /*document_path*/) override {}
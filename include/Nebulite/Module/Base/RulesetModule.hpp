@@ -8,6 +8,7 @@
 #include <cassert>
 #include <concepts>
 #include <cstdint> // NOLINT
+#include <optional>
 #include <ranges>
 #include <string_view>
 #include <type_traits>
@@ -84,6 +85,8 @@ protected:
      * @param func The function implementing the ruleset
      * @param description A brief description of the ruleset's purpose and its used variables
      * @param baseListFunc A function that returns the ordered cache list of base values required by this ruleset, given a context.
+     * @param interactionRadius Optional radius for proximity-based global rulesets.
+     *                          If set, the ruleset is only paired with listeners whose bounding box lies within this radius.
      * @todo Add an argument param std::span<std::string> const& args, so that we can have rulesets with arguments such as
      *       ::Controls::PT1 path.to.pt1.object
      *       topic must reduce to the first arg, and we must add the args to the static ruleset object
@@ -93,7 +96,8 @@ protected:
         void (DerivedRulesetModule::*func)(Interaction::Context const&, double**, double**) const,
         Interaction::Rules::StaticRuleset::BaseListFunction const& baseListFunc,
         Interaction::Rules::StaticRuleset::Type const& type,
-        std::string_view const description
+        std::string_view const description,
+        std::optional<double> const& interactionRadius = std::nullopt
     ){
         assert(func != nullptr);
         static_assert(isValidTopic(Topic), "RulesetModule::bind(): The topic name is not valid. It must start with '::' and contain no spaces.");
@@ -108,6 +112,7 @@ protected:
                 (static_cast<DerivedRulesetModule const*>(this)->*func)(ctx, slf, otr);
             },
             baseListFunc,
+            interactionRadius,
         });
     }
 
@@ -12,6 +12,7 @@
 // Standard library
 #include <memory>
 #include <string_view>
+#include <vector>
 
 // Nebulite
 #include "Nebulite/Data/Document/ScopedKeyView.hpp"
@@ -51,6 +52,30 @@ public:
         DomainModuleBase::bindFunctionStatic(transformationFuncTree.get(), functionPtr, name, helpDescription);
     }
 
+    /**
+     * @brief Binds a static function to the transformation funcTree, marking it as pure
+     * @details A pure transformation only depends on the value it modifies and its arguments,
+     *          so its result may be reused as long as its input does not change.
+     *          Only worth it for transformations that are expensive compared to comparing their input, e.g. sorting.
+     * @tparam Func The function type to bind
+     * @param functionPtr The function to bind
+     * @param name The name of the function
+     * @param helpDescription The help description of the function
+     */
+    template <typename Func>
+    void bindPureTransformation(Func functionPtr, std::string_view name, std::string_view helpDescription) {
+        bindTransformation(functionPtr, name, helpDescription);
+        pureTransformations.push_back(name);
+    }
+
+    /**
+     * @brief Gets the names of all transformations bound as pure.
+     * @return The names, valid as long as the bound names are.
+     */
+    [[nodiscard]] std::vector<std::string_view> const& getPureTransformations() const noexcept {
+        return pureTransformations;
+    }
+
     /**
      * @brief Binds a category to the transformation funcTree
      * @param name The name of the category
@@ -81,6 +106,8 @@ private:
     static_assert(rootKeyStr.empty(), "The rootKeyStr must be an empty string for correct operation of the transformation module.");
 
     std::shared_ptr<Utility::Args::FuncTree<bool, Data::JsonScope&>> transformationFuncTree;
+
+    std::vector<std::string_view> pureTransformations;
 };
 } // namespace Nebulite::Module::Base
 #endif // NEBULITE_MODULE_BASE_TRANSFORMATIONMODULE_HPP
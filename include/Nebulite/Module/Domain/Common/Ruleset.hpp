@@ -96,6 +96,16 @@ public:
         bindFunction(&Ruleset::reload, reloadName, reloadDesc);
     }
 
+    /**
+     * @brief Unsubscribes all listeners, as they reference the domain.
+     */
+    ~Ruleset() override ;
+
+    Ruleset(Ruleset const&) = delete;
+    Ruleset& operator=(Ruleset const&) = delete;
+    Ruleset(Ruleset&&) = delete;
+    Ruleset& operator=(Ruleset&&) = delete;
+
     struct Key : Data::KeyGroup<Data::ScopePattern::domainRootScope> {
         explicit Key(Data::JsonScope const& scope) {
             broadcast = scope.getRootScope().addMember("ruleset").addMember("list");
@@ -133,8 +143,13 @@ private:
     // Internal rulesets, intended for self-global interaction
     std::vector<std::shared_ptr<Interaction::Rules::Ruleset>> rulesetsLocal;
 
-    // Topic subscriptions
+    // Topic subscriptions, registered in the Invoke until unsubscribed
     std::vector<std::shared_ptr<Interaction::Rules::Listener>> listeners;
+
+    /**
+     * @brief Unsubscribes and clears all topic subscriptions.
+     */
+    void unsubscribeAll();
 };
 } // namespace Nebulite::Module::Domain::Common
 #endif // NEBULITE_MODULE_DOMAIN_COMMON_RULESET_HPP
@@ -39,6 +39,13 @@ public:
     static auto constexpr fetchContainerName = "fetch-container";
     static auto constexpr fetchContainerDesc = "Fetches and returns information about the container, including object count per tile.";
 
+    [[nodiscard]] Constants::Event fetchMemory() const ;
+    static auto constexpr fetchMemoryName = "fetch-memory";
+    static auto constexpr fetchMemoryDesc = "Estimates the average memory of all RenderObjects in bytes, broken down by component.\n"
+        "Usage: fetch-memory\n"
+        "\n"
+        "Components are the object itself, its document, the document cache, the cacheline and the ordered cache lists.\n";
+
     //------------------------------------------
     // Keys in the global document
 
@@ -47,6 +54,15 @@ public:
         static auto constexpr containerTotalTiles = makeScoped("container.totalTiles");
         static auto constexpr containerTotalCost = makeScoped("container.totalCost");
         static auto constexpr containerObjectCount = makeScoped("container.objectCount");
+
+        // Last redistribution of objects after a tiling change, summed over all layers
+        static auto constexpr reinsertionDurationMs = makeScoped("container.reinsertion.durationMs");
+        static auto constexpr reinsertionCheckedObjects = makeScoped("container.reinsertion.checkedObjects");
+        static auto constexpr reinsertionMovedObjects = makeScoped("container.reinsertion.movedObjects");
+
+        // Memory per object, see fetch-memory
+        static auto constexpr memoryObjectCount = makeScoped("memory.objectCount");
+        static auto constexpr memoryBytesPerObject = makeScoped("memory.bytesPerObject");
     };
 
     //------------------------------------------
@@ -57,6 +73,7 @@ public:
      */
     explicit Debug(ConstructorParams const& params) : DomainModule(params) {
         bindFunction(&Debug::fetchContainer, fetchContainerName, fetchContainerDesc);
+        bindFunction(&Debug::fetchMemory, fetchMemoryName, fetchMemoryDesc);
     }
 };
 } // namespace Nebulite::Module::Domain::Environment
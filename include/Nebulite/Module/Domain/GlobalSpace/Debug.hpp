@@ -77,6 +77,23 @@ public:
         "- <filenames>: Optional. One or more filenames to log the renderer state to.\n"
         "               If no filenames are provided, defaults to 'state.log.jsonc'.\n";
 
+    [[nodiscard]] static Constants::Event logAsync(std::span<std::string_view const> const& args);
+    static auto constexpr logAsyncName = "log async";
+    static auto constexpr logAsyncDesc = "Activates or deactivates asynchronous console output.\n"
+        "Usage: log async <on/off>\n"
+        "\n"
+        "- on:  Output is submitted to per-thread buffers and written to the console and history by a background thread.\n"
+        "- off: Output is written by the logging thread, after writing all pending output.\n"
+        "Note: The initial state is loaded from the setting 'log.async'.\n";
+
+    [[nodiscard]] static Constants::Event logHistoryLimit(std::span<std::string_view const> const& args);
+    static auto constexpr logHistoryLimitName = "log history-limit";
+    static auto constexpr logHistoryLimitDesc = "Sets the number of lines each domain keeps in its console history.\n"
+        "Usage: log history-limit <lines>\n"
+        "\n"
+        "- <lines>: The maximum number of lines, older lines are dropped. 0 keeps all lines.\n"
+        "Note: The initial value is loaded from the setting 'log.historyLimit'.\n";
+
     [[nodiscard]] static Constants::Event crash(std::span<std::string_view const> const& args, Interaction::Context const& ctx, Interaction::ContextScope& ctxScope);
     static auto constexpr crashName = "crash";
     static auto constexpr crashDesc = "Crashes the program, useful for checking if the testing suite can catch crashes.\n"
@@ -113,7 +130,7 @@ public:
     // Categories
 
     static auto constexpr logName = "log";
-    static auto constexpr logDesc = "Functions for logging various states and documents to files.";
+    static auto constexpr logDesc = "Functions for logging various states and documents to files, and for configuring console output.";
 
     static auto constexpr standardFileName = "standard-file";
     static auto constexpr standardFileDesc = "Functions for generating standard files for common resources.";
@@ -129,6 +146,7 @@ public:
         // Setup key information in the global document
         setupPlatformInfo();
         setupDebugInfo();
+        setupLogging();
 
         //------------------------------------------
         // Binding functions to the FuncTree
@@ -141,6 +159,8 @@ public:
         bindCategory(logName, logDesc);
         bindFunction(&Debug::logGlobal, logGlobalName, logGlobalDesc);
         bindFunction(&Debug::logState, logStateName, logStateDesc);
+        bindFunction(&Debug::logAsync, logAsyncName, logAsyncDesc);
+        bindFunction(&Debug::logHistoryLimit, logHistoryLimitName, logHistoryLimitDesc);
 
         bindCategory(standardFileName, standardFileDesc);
         bindFunction(&Debug::standardFileRenderObject, standardFileRenderObjectName, standardFileRenderObjectDesc);
@@ -156,6 +176,14 @@ public:
         static auto constexpr buildType = makeScoped("debug.buildType");
         static auto constexpr memoryVirtualMegaBytes = makeScoped("debug.memory.virtualMegaBytes");
         static auto constexpr memoryResidentMegaBytes = makeScoped("debug.memory.residentMegaBytes");
+        static auto constexpr memoryPools = makeScoped("debug.memory.pools"); // Per SlabPool: live, capacity, allocations, frees and their rates per second
+
+        static auto constexpr textCacheHits = makeScoped("debug.text.hits");
+        static auto constexpr textCacheComposed = makeScoped("debug.text.composed");
+        static auto constexpr textCacheReused = makeScoped("debug.text.reused");
+        static auto constexpr textCacheRasterized = makeScoped("debug.text.rasterized");
+        static auto constexpr textCacheGlyphs = makeScoped("debug.text.glyphs");
+        static auto constexpr textCacheAtlasPages = makeScoped("debug.text.atlasPages");
 
         static auto constexpr workerInvokeUsed = makeScoped("debug.worker.invoke.used");
         static auto constexpr workerInvokeMax = makeScoped("debug.worker.invoke.max");
@@ -186,6 +214,11 @@ private:
      */
     void setupDebugInfo() const ;
 
+    /**
+     * @brief Applies the logging settings to all captures.
+     */
+    void setupLogging() const ;
+
     void addRoutines();
 };
 } // namespace Nebulite::Module::Domain::GlobalSpace
@@ -11,6 +11,7 @@
 // Nebulite
 #include "Nebulite/Constants/Event.hpp"
 #include "Nebulite/Data/Document/KeyGroup.hpp"
+#include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Module/Base/DomainModule.hpp"
 
 //------------------------------------------
@@ -46,6 +47,76 @@ public:
     static auto constexpr selfOtherGlobalEvaluationDesc = "Tests evaluation of self and other global variable access in one expression\n"
         "Usage: feature-test context-evaluation\n";
 
+    [[nodiscard]] Constants::Event dispatchBenchmark(std::span<std::string_view const> const& args) const ;
+    static auto constexpr dispatchBenchmarkName = "feature-test dispatch-benchmark";
+    static auto constexpr dispatchBenchmarkDesc = "Builds a standalone chain of inheriting FuncTrees, mirroring GlobalSpace, Renderer, Environment and RenderObject,\n"
+        "and parses commands bound in the deepest tree. Compares resolving through each inherited tree in order\n"
+        "against the dispatch table of the inheriting tree and parsing in the owning tree directly.\n"
+        "Usage: feature-test dispatch-benchmark <iterations>\n";
+
+    [[nodiscard]] Constants::Event dispatchPrecedence() const ;
+    static auto constexpr dispatchPrecedenceName = "feature-test dispatch-precedence";
+    static auto constexpr dispatchPrecedenceDesc = "Builds the same chain of inheriting FuncTrees as the dispatch benchmark, binding names in several of them.\n"
+        "Prints the result of each command and checks that the dispatch table resolves them to the same tree as the stepwise lookup.\n"
+        "Usage: feature-test dispatch-precedence\n";
+
+    // Expressions
+
+    [[nodiscard]] Constants::Event expressionBenchmark(std::span<std::string_view const> const& args, Interaction::Context const& ctx, Interaction::ContextScope const& ctxScope) const ;
+    static auto constexpr expressionBenchmarkName = "feature-test expression-benchmark";
+    static auto constexpr expressionBenchmarkDesc = "Evaluates an expression repeatedly using bytecode and the TinyExpr tree, comparing results and timings.\n"
+        "The expression must be returnable as double, e.g. a single $(...) block.\n"
+        "Usage: feature-test expression-benchmark <iterations> <expression>\n";
+
+    // Documents
+
+    [[nodiscard]] Constants::Event jsonCacheBenchmark(std::span<std::string_view const> const& args) const ;
+    static auto constexpr jsonCacheBenchmarkName = "feature-test json-cache-benchmark";
+    static auto constexpr jsonCacheBenchmarkDesc = "Reads and writes a single value of documents with 10, 100 and 1000 cached keys.\n"
+        "Access time should barely depend on the number of cached keys.\n"
+        "Usage: feature-test json-cache-benchmark <iterations>\n";
+
+    [[nodiscard]] Constants::Event transformationMemo() const ;
+    static auto constexpr transformationMemoName = "feature-test transformation-memo";
+    static auto constexpr transformationMemoDesc = "Retrieves a key with a pure transformation from two standalone documents,\n"
+        "printing the results and memo statistics of each document before and after changing the input.\n"
+        "Usage: feature-test transformation-memo\n";
+
+    // Objects
+
+    [[nodiscard]] Constants::Event objectLookupBenchmark(std::span<std::string_view const> const& args) const ;
+    static auto constexpr objectLookupBenchmarkName = "feature-test object-lookup-benchmark";
+    static auto constexpr objectLookupBenchmarkDesc = "Fills a standalone RenderObjectContainer with objects and looks each of them up by id.\n"
+        "Compares the indexed lookup against a linear walk over all tiles and batches, limited to 1000 lookups.\n"
+        "Usage: feature-test object-lookup-benchmark <objectCount>\n";
+
+    [[nodiscard]] Constants::Event componentPoolBenchmark(std::span<std::string_view const> const& args) const ;
+    static auto constexpr componentPoolBenchmarkName = "feature-test component-pool-benchmark";
+    static auto constexpr componentPoolBenchmarkDesc = "Integrates positions of standalone documents, once through their stable double pointers\n"
+        "and once through the columns of a ComponentPool the documents are bound to, comparing results and timings.\n"
+        "Usage: feature-test component-pool-benchmark <objectCount> <iterations>\n";
+
+    [[nodiscard]] Constants::Event rulesetSpawnBenchmark(std::span<std::string_view const> const& args) const ;
+    static auto constexpr rulesetSpawnBenchmarkName = "feature-test ruleset-spawn-benchmark";
+    static auto constexpr rulesetSpawnBenchmarkDesc = "Parses a linked ruleset for standalone objects, as done when spawning them.\n"
+        "Compares compiling its expressions for each object against cloning the compiled ruleset shared by all objects.\n"
+        "Usage: feature-test ruleset-spawn-benchmark <objectCount> <ruleset>\n";
+
+    // Audio
+
+    [[nodiscard]] Constants::Event audioMixer() const ;
+    static auto constexpr audioMixerName = "feature-test audio-mixer";
+    static auto constexpr audioMixerDesc = "Checks a standalone audio mixer offline, without an audio device.\n"
+        "Prints whether resampling matches a linear interpolation, how voices are stolen, dropped, stopped and ended,\n"
+        "and the peaks of a hard-panned voice clamped to full scale.\n"
+        "Usage: feature-test audio-mixer\n";
+
+    [[nodiscard]] Constants::Event audioMixerBenchmark(std::span<std::string_view const> const& args) const ;
+    static auto constexpr audioMixerBenchmarkName = "feature-test audio-mixer-benchmark";
+    static auto constexpr audioMixerBenchmarkDesc = "Mixes looping synthetic sounds on all voices of a standalone audio mixer offline, without an audio device.\n"
+        "Half of the sounds are stereo, most play at a different pitch. Afterward, checks voice stealing and dropping by priority.\n"
+        "Usage: feature-test audio-mixer-benchmark <voices> <seconds>\n";
+
     // Keys
 
     [[nodiscard]] Constants::Event keyCombination(std::span<std::string_view const> const& args) const ;
@@ -81,6 +152,24 @@ public:
         // General
         bindFunction(&FeatureTest::testFuncTree, testFuncTreeName, testFuncTreeDesc);
         bindFunction(&FeatureTest::selfOtherGlobalEvaluation, selfOtherGlobalEvaluationName, selfOtherGlobalEvaluationDesc);
+        bindFunction(&FeatureTest::dispatchBenchmark, dispatchBenchmarkName, dispatchBenchmarkDesc);
+        bindFunction(&FeatureTest::dispatchPrecedence, dispatchPrecedenceName, dispatchPrecedenceDesc);
+
+        // Expressions
+        bindFunction(&FeatureTest::expressionBenchmark, expressionBenchmarkName, expressionBenchmarkDesc);
+
+        // Documents
+        bindFunction(&FeatureTest::jsonCacheBenchmark, jsonCacheBenchmarkName, jsonCacheBenchmarkDesc);
+        bindFunction(&FeatureTest::transformationMemo, transformationMemoName, transformationMemoDesc);
+
+        // Objects
+        bindFunction(&FeatureTest::objectLookupBenchmark, objectLookupBenchmarkName, objectLookupBenchmarkDesc);
+        bindFunction(&FeatureTest::componentPoolBenchmark, componentPoolBenchmarkName, componentPoolBenchmarkDesc);
+        bindFunction(&FeatureTest::rulesetSpawnBenchmark, rulesetSpawnBenchmarkName, rulesetSpawnBenchmarkDesc);
+
+        // Audio
+        bindFunction(&FeatureTest::audioMixer, audioMixerName, audioMixerDesc);
+        bindFunction(&FeatureTest::audioMixerBenchmark, audioMixerBenchmarkName, audioMixerBenchmarkDesc);
 
         // Keys
         bindFunction(&FeatureTest::keyCombination, keyCombinationName, keyCombinationDesc);
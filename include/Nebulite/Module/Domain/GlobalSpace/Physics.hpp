@@ -22,6 +22,8 @@ namespace Nebulite::Module::Domain::GlobalSpace {
  * @class Nebulite::Module::Domain::GlobalSpace::Physics
  * @brief The Physics DomainModule in the GlobalSpace,
  *        containing keys for global physics constants and settings.
+ * @details Also solves the frame-wise physics of rulesets that work on all objects at once,
+ *          such as ::physics::gravityApproximate.
  */
 class Physics final : public Base::DomainModule<Core::GlobalSpace> {
 public:
@@ -67,6 +69,9 @@ public:
             static constexpr auto g        = makeScoped("g");        // Standard gravity (m/s^2)
 
             // NOLINTEND
+
+            // Simulation settings
+            static constexpr auto barnesHutTheta = makeScoped("barnesHut.theta"); // Opening angle of ::physics::gravityApproximate, 0 is exact
         };
 
         // Per-object physics properties
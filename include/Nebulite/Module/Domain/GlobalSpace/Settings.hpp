@@ -92,6 +92,18 @@ public:
         static auto constexpr fontSize2 = makeScoped("renderer.font.size[1]");
         static auto constexpr fontSize3 = makeScoped("renderer.font.size[2]");
 
+        // Simulation level of detail: tiles around the camera update every frame, distant tiles at a reduced tick rate
+        static auto constexpr simulationNearMargin = makeScoped("renderer.simulation.nearMargin");
+        static auto constexpr simulationDistantInterval = makeScoped("renderer.simulation.distantInterval");
+        static auto constexpr simulationDistantRadius = makeScoped("renderer.simulation.distantRadius");
+
+        // Store hot values of newly created RenderObjects in the dense component pool of the environment
+        static auto constexpr componentPool = makeScoped("renderer.componentPool");
+
+        // Logging: asynchronous console output and the number of lines each capture keeps
+        static auto constexpr logAsync = makeScoped("log.async");
+        static auto constexpr logHistoryLimit = makeScoped("log.historyLimit");
+
         // Startup-related settings
         static auto constexpr parseOnStartup = makeScoped("parse.onStartup");
         static auto constexpr parseIfNoArgs = makeScoped("parse.ifNoArgs");
@@ -7,7 +7,6 @@
 // Standard Library
 #include <array>
 #include <cstddef>
-#include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -24,6 +23,8 @@
 #include <absl/container/flat_hash_map.h>
 
 // Nebulite
+#include "Nebulite/Audio/Mixer.hpp"
+#include "Nebulite/Audio/WavStream.hpp"
 #include "Nebulite/Constants/Event.hpp"
 #include "Nebulite/Module/Base/DomainModule.hpp"
 
@@ -49,7 +50,7 @@ public:
     //------------------------------------------
     // Available Functions
 
-    [[nodiscard]] Constants::Event beep(std::span<std::string_view const> const& args) const;
+    [[nodiscard]] Constants::Event beep(std::span<std::string_view const> const& args);
     static auto constexpr beepName = "beep";
     static auto constexpr beepDesc = "Make a beep noise.\n"
         "If no waveform type is specified, defaults to sine.\n"
@@ -60,8 +61,33 @@ public:
 
     [[nodiscard]] Constants::Event playSound(std::span<std::string_view const> const& args);
     static auto constexpr playSoundName = "play-sound";
-    static auto constexpr playSoundDesc = "Play a sound from a file.\n"
-        "Usage: play-sound <file-path>\n";
+    static auto constexpr playSoundDesc = "Play a sound from a WAV file.\n"
+        "The file is decoded once and cached, multiple sounds play at the same time.\n"
+        "If all voices are in use, the oldest sound of the lowest priority is stopped,\n"
+        "unless its priority is higher than the new sound's, in which case the new sound is dropped.\n"
+        "\n"
+        "Usage: play-sound [options] <file-path>\n"
+        "\n"
+        "Options:\n"
+        "  --gain <value>      Linear amplitude, defaults to 1\n"
+        "  --pan <value>       Stereo position from -1 (left) to 1 (right), defaults to 0\n"
+        "  --pitch <value>     Playback speed, 2 plays an octave higher, defaults to 1\n"
+        "  --priority <value>  Integer priority for voice stealing, defaults to 0\n"
+        "  --loop              Repeat until stopped\n";
+
+    [[nodiscard]] Constants::Event playMusic(std::span<std::string_view const> const& args);
+    static auto constexpr playMusicName = "play-music";
+    static auto constexpr playMusicDesc = "Stream music from a WAV file.\n"
+        "The file is decoded incrementally while playing, so long tracks need no loading time or memory.\n"
+        "Takes the same options as play-sound, except for --pitch. The priority defaults to 100.\n"
+        "\n"
+        "Usage: play-music [options] <file-path>\n";
+
+    [[nodiscard]] Constants::Event stopSounds(std::span<std::string_view const> const& args);
+    static auto constexpr stopSoundsName = "stop-sounds";
+    static auto constexpr stopSoundsDesc = "Stop all playing sounds and music.\n"
+        "\n"
+        "Usage: stop-sounds\n";
 
     //------------------------------------------
     // Setup
@@ -71,6 +97,13 @@ public:
      */
     explicit Audio(ConstructorParams const& params);
 
+    ~Audio() override;
+
+    Audio(Audio const&) = delete;
+    Audio& operator=(Audio const&) = delete;
+    Audio(Audio&&) = delete;
+    Audio& operator=(Audio&&) = delete;
+
 private:
     SDL_AudioStream* stream = nullptr;
     SDL_AudioSpec spec = {};
@@ -87,6 +120,10 @@ private:
         static SampleType constexpr SampleMin = std::is_floating_point_v<SampleType> ? static_cast<SampleType>(-1.0) : std::numeric_limits<SampleType>::min();
 
         static double constexpr sampleRate = 44100.0;
+
+        static std::size_t constexpr voices = 64;                  // Sounds playing at once
+        static std::size_t constexpr musicBufferFrames = 22050;    // Frames decoded ahead for streamed music, half a second
+        static int constexpr musicPriority = 100;                  // Default priority of streamed music, above sound effects
     };
 
     struct BasicAudioWaveforms {
@@ -101,14 +138,36 @@ private:
         std::array<Audio::Settings::SampleType, Settings::samples> triangleBuffer{};
     } basicAudioWaveforms{};
 
-    struct Sound {
-        // TODO: Either we add metadata or we reduce this to a type alias for std::vector<Settings::SampleType>
-        std::vector<Settings::SampleType> audioData;
+    Nebulite::Audio::Mixer mixer{Settings::voices};
+
+    std::vector<float> mixBuffer; // Only used on the audio device thread
+
+    /**
+     * @struct Music
+     * @brief A streamed track and the voice playing it.
+     */
+    struct Music {
+        std::unique_ptr<Nebulite::Audio::WavStream> decoder;
+        Nebulite::Audio::VoiceId voice;
     };
+    std::vector<Music> music;
 
-    absl::flat_hash_map<std::string, std::shared_ptr<Sound>> soundCache;
+    absl::flat_hash_map<std::string, std::shared_ptr<Nebulite::Audio::Sound const>> soundCache;
 
-    std::optional<std::shared_ptr<Sound>> loadSound(std::string const& path); // NOLINT
+    /**
+     * @brief Loads a WAV file, converted to float at the output sample rate, or gets it from the cache.
+     * @param path The path of the WAV file.
+     * @return The sound, or std::nullopt if it could not be loaded.
+     */
+    std::optional<std::shared_ptr<Nebulite::Audio::Sound const>> loadSound(std::string const& path);
+
+    /**
+     * @brief Parses the leading voice options of a command.
+     * @param args The arguments of the command, options start after the command name.
+     * @param params The parameters to start from.
+     * @return The parameters and the index of the first argument after the options, or std::nullopt on invalid options.
+     */
+    std::optional<std::pair<Nebulite::Audio::VoiceParams, std::size_t>> parseVoiceParams(std::span<std::string_view const> const& args, Nebulite::Audio::VoiceParams params) const;
 
     /**
      * @brief Initializes basic audio waveforms.
@@ -117,24 +176,21 @@ private:
 
     /**
      * @brief Initializes SDL audio subsystem and opens the audio device.
+     * @details Falls back to SDL's dummy driver if no device can be opened, e.g. on headless machines.
+     *          Set the environment variable SDL_AUDIO_DRIVER=dummy to use it right away.
      */
     void initAudio();
 
     /**
-     * @brief Converts an SDL_AudioFormat to a human-readable string for error messages.
-     * @param format The SDL_AudioFormat to convert.
-     * @return A string representation of the audio format.
+     * @brief Opens the default playback device, fed by the mixer.
+     * @return True on success, false otherwise.
      */
-    static std::string sdlAudioFormatToString(SDL_AudioFormat format);
-
-    using ConverterAndSampleSize = std::pair<std::function<Settings::SampleType(Settings::SdlAudioByte* data)>, std::size_t>;
+    bool openDevice();
 
     /**
-     * @brief Loads a converter function for the given SDL_AudioFormat. The converter function takes a pointer to raw audio data and returns a normalized sample of type Settings::SampleType.
-     * @param format The SDL_AudioFormat for which to load a converter function.
-     * @return An optional function that converts raw audio data to a normalized sample, or std::nullopt if the format is not supported.
+     * @brief Audio device callback, mixes the requested amount of samples.
      */
-    static std::optional<ConverterAndSampleSize> loadConverterFunction(SDL_AudioFormat format);
+    static void SDLCALL fillDevice(void* userdata, SDL_AudioStream* deviceStream, int additionalAmount, int totalAmount);
 
     /**
      * @brief Calculates the time at which a sample occurs.
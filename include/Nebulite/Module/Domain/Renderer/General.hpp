@@ -105,7 +105,8 @@ public:
     static auto constexpr showFpsDesc = "Show FPS of renderer.\n"
         "\n"
         "Usage: show-fps [on|off]\n\n"
-        "Defaults to on if no argument is provided\n";
+        "Defaults to on if no argument is provided\n"
+        "The overlay also shows the time spent updating the UI, and how many expression bindings were evaluated and updated.\n";
 
     [[nodiscard]] Constants::Event camMove(int argc, char const** argv) const ;
     static auto constexpr camMoveName = "cam move";
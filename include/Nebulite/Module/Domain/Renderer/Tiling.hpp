@@ -55,6 +55,11 @@ public:
         static auto constexpr tileSizeW = makeScoped("debug.tiling.size.w");
         static auto constexpr tileSizeH = makeScoped("debug.tiling.size.h");
         static auto constexpr visibleTiles = makeScoped("debug.tiling.visible");
+
+        // Simulation level of detail, tile counts of the last update summed over all layers
+        static auto constexpr simulationNearTiles = makeScoped("debug.tiling.simulation.near");
+        static auto constexpr simulationDistantTiles = makeScoped("debug.tiling.simulation.distant");
+        static auto constexpr simulationDistantTilesUpdated = makeScoped("debug.tiling.simulation.distantUpdated");
     };
 
 private:
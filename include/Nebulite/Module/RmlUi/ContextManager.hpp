@@ -4,12 +4,19 @@
 //------------------------------------------
 // Includes
 
+// External
+#include <absl/container/flat_hash_set.h>
+
 // Nebulite
 #include "Nebulite/Module/Base/RmlUiModule.hpp"
 
 //------------------------------------------
 // Forward declarations
 
+namespace Rml {
+class Element;
+} // namespace Rml
+
 namespace Nebulite::Graphics {
 class RmlInterface;
 } // namespace Nebulite::Graphics
@@ -26,6 +33,20 @@ public:
     explicit ContextManager(Utility::Io::Capture& c, Graphics::RmlInterface& i);
 
     void update() override ;
+
+    void OnElementCreate(Rml::Element* element) override ;
+
+    void OnElementDestroy(Rml::Element* element) override ;
+
+private:
+    // Created elements that may still need the context of their document
+    absl::flat_hash_set<Rml::Element*> pending;
+
+    /**
+     * @brief Assigns the context of its document to an element that requires one.
+     * @return False if the document has no context yet, so the element is checked again on the next update.
+     */
+    bool assignContext(Rml::Element* element) const ;
 };
 } // namespace Nebulite::Module::RmlUi
 #endif // NEBULITE_MODULE_RMLUI_CONTEXTMANAGER_HPP
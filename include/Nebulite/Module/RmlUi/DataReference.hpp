@@ -84,7 +84,7 @@ private:
 
     void registerDataValue(Rml::Element* element) ;
 
-    void updateRegisteredValues(Graphics::RmlInterface::RmlElementIdentifier const& id, Rml::Element* element);
+    void updateRegisteredValues(Graphics::RmlInterface::RmlElementIdentifier const& id);
 
     void synchronizeEntry(std::unique_ptr<RegisteredEntry> const& entry, Rml::Element* element, Data::JsonScope& target);
 
@@ -4,13 +4,26 @@
 //------------------------------------------
 // Includes
 
+// Standard library
+#include <array>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 // External
+#include <RmlUi/Config/Config.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
 // Nebulite
+#include "Nebulite/Data/Document/SimpleValueError.hpp"
+#include "Nebulite/Graphics/RmlInterface.hpp"
+#include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Interaction/Logic/Expression.hpp"
 #include "Nebulite/Module/Base/RmlUiModule.hpp"
-#include "Nebulite/Utility/Coordination/TimedRoutine.hpp"
 
 //------------------------------------------
 // Forward declarations
@@ -19,9 +32,9 @@ namespace Rml {
 class Element;
 } // namespace Rml
 
-namespace Nebulite::Graphics {
-class RmlInterface;
-} // namespace Nebulite::Graphics
+namespace Nebulite::Data {
+class JsonScope;
+} // namespace Nebulite::Data
 
 namespace Nebulite::Utility::Io {
 class Capture;
@@ -29,55 +42,104 @@ class Capture;
 
 //------------------------------------------
 namespace Nebulite::Module::RmlUi {
-
+/**
+ * @class Nebulite::Module::RmlUi::ExpressionManager
+ * @brief Binds the inner rml of elements with a supported attribute to an expression.
+ * @details Elements are bound once after their creation. Each update, a binding is only evaluated
+ *          if a document value its expression reads changed, and its inner rml is only replaced
+ *          if the evaluation differs from the last one. Expressions whose reads are only known
+ *          during evaluation, e.g. with nested keys, are evaluated on each update.
+ */
 class ExpressionManager final : public Base::RmlUiModule {
 public:
     explicit ExpressionManager(Utility::Io::Capture& c, Graphics::RmlInterface& i);
 
     void update() override ;
 
-    void postRenderUpdate() override;
+    void addUpdateStats(Graphics::RmlInterface::UpdateStats& stats) const override ;
+
+    void OnElementCreate(Rml::Element* element) override ;
+
+    void OnElementDestroy(Rml::Element* element) override ;
 
     struct Attribute {
         static auto constexpr eval = "data-eval";
         static auto constexpr conditional = "data-if";
 
+        // Unevaluated inner rml, kept on the element so serializing its parent does not capture evaluated text
+        static auto constexpr source = "__source__data-eval";
+
         static bool hasSupportedAttribute(Rml::Element* element) {
             return element->GetAttribute(eval) || element->GetAttribute(conditional);
         }
     };
 
 private:
-    bool volatile expressionsWereEvaluated = false;
+    /**
+     * @struct CompiledExpression
+     * @brief Expression of an inner rml, shared by all elements with the same source.
+     */
+    struct CompiledExpression {
+        explicit CompiledExpression(std::string const& rml) : expression(rml), dependencies(expression.getDependencies()) {}
+
+        Interaction::Logic::Expression expression;
+        std::optional<std::vector<Interaction::Logic::Expression::Dependency>> dependencies;
+    };
+
+    /**
+     * @struct Binding
+     * @brief An element bound to the expression of its inner rml.
+     */
+    struct Binding {
+        CompiledExpression const* compiled = nullptr;
+        bool evaluated = false;                          // Whether the element holds an evaluation
+        std::array<Data::JsonScope const*, 3> scopes{};  // Scopes self, other and global of the last evaluation
+        std::vector<double const*> numericPointers;      // Stable pointers of numeric dependencies, resolved once per scopes
+        std::vector<double> numericValues;               // Values of numeric dependencies at the last evaluation
+        std::vector<std::expected<std::string, Data::SimpleValueRetrievalError>> variableValues; // Values or error kinds of variable dependencies at the last evaluation
+        Rml::String output;                              // Current inner rml of the element
+    };
 
     // Pre-compiled RML strings to expressions
     absl::flat_hash_map<
         Rml::String,
-        Interaction::Logic::Expression
+        std::unique_ptr<CompiledExpression>
     > expressions;
 
-    // Original, non-evaluated rml strings of elements
-    absl::flat_hash_map<
-        Rml::Element*,
-        Rml::String
-    > rmlStrings;
+    // Created elements, bound on the next update once their inner rml is available
+    absl::flat_hash_set<Rml::Element*> pending;
 
-   // std::unique_ptr<Utility::Coordination::TimedRoutine> evaluationRoutine;
+    absl::flat_hash_map<Rml::Element*, Binding> bindings;
 
-    void updateExpressions();
+    // Evaluations of the last update
+    struct Stats {
+        std::size_t evaluated = 0;
+        std::size_t changed = 0;
+    } stats;
 
-    void resetExpressions();
+    /**
+     * @brief Rounds of binding elements created while refreshing, so nested expressions show up within the same update.
+     */
+    static std::size_t constexpr maximumRounds = Interaction::Logic::Expression::standardRecursionDepth;
 
-    Utility::Coordination::TimedRoutine evaluationRoutine{[this] {
-            updateExpressions();
-            expressionsWereEvaluated = true;
-        },
-        // If 1000.0/fps is higher than this value, the ui starts glitching due to the reset rml still being written while rendering.
-        // So we update Expressions instantly with each new render pass.
-        // Getting rid of the TimedRoutine is also an option, but we leave it here atm.
-        0,
-        Utility::Coordination::TimedRoutine::ConstructionMode::startImmediately
-    };
+    /**
+     * @brief Binds all pending elements to the expression of their source rml.
+     * @return The newly bound elements.
+     */
+    std::vector<Rml::Element*> bindPendingElements();
+
+    void refresh(Rml::Element* element, Binding& binding);
+
+    /**
+     * @brief Reads the dependencies of a binding, storing their current values.
+     * @details Stable pointers of numeric dependencies are only resolved again if the scopes changed.
+     * @return True if any value or scope differs from the last evaluation.
+     */
+    static bool dependenciesChanged(Binding& binding, Interaction::ContextScope const& scope);
+
+    static std::string encodeSource(std::string const& rml);
+
+    static std::string decodeSource(std::string const& encoded);
 };
 } // namespace Nebulite::Module::RmlUi
 #endif // NEBULITE_MODULE_RMLUI_EXPRESSIONMANAGER_HPP
@@ -6,11 +6,15 @@
 
 // Standard library
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
+#include <vector>
 
 // Nebulite
 #include "Nebulite/Constants/KeyNames.hpp"
+#include "Nebulite/Data/Document/JsonScope.hpp"
+#include "Nebulite/Math/BarnesHut.hpp"
 #include "Nebulite/Module/Base/RulesetModule.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/Physics.hpp"
 
@@ -56,6 +60,25 @@ public:
     static std::string_view constexpr dragName = "::physics::drag";
     static std::string_view constexpr dragDesc = "Applies drag force to the render object, simulating air resistance based on its velocity and a drag coefficient.";
 
+    void gravityApproximate(Interaction::Context const& context, double** slf, double** otr) const ;
+    static std::string_view constexpr gravityApproximateName = "::physics::gravityApproximate";
+    static std::string_view constexpr gravityApproximateDesc = "Enlists the render object in the approximated gravity simulation. "
+        "Once per frame, the gravitational forces between all enlisted objects are approximated using a Barnes-Hut quadtree "
+        "with the opening angle physics.barnesHut.theta. "
+        "Scales with O(N log N) instead of the O(N^2) of ::physics::gravity.";
+
+    //------------------------------------------
+    // Frame-wise solvers
+
+    /**
+     * @brief Applies the approximated gravitational forces to all objects enlisted via ::physics::gravityApproximate since the last call.
+     * @details Must be called once per frame while no rulesets are being processed,
+     *          as forces are written without locking.
+     * @param G The gravitational constant.
+     * @param theta The opening angle of the approximation, 0 for an exact solution.
+     */
+    static void solveGravityApproximation(double G, double theta);
+
     //------------------------------------------
     // Constructor
     Physics();
@@ -140,6 +163,46 @@ private:
         double* t; // Simulation time
         /* Add more global variables here as needed */
     } globalVal = {};
+
+    /**
+     * @class GravityEngine
+     * @brief Collects all objects taking part in the approximated gravity simulation and solves it once per frame.
+     * @details Objects are enlisted into per-thread lists, so enlisting from multiple worker threads needs no locking.
+     */
+    class GravityEngine {
+    public:
+        /**
+         * @brief Adds an object to the next solve.
+         * @param slf The physics base list of the object.
+         */
+        void enlist(double** slf);
+
+        /**
+         * @brief Builds the quadtree of all enlisted objects, adds the resulting forces and clears the lists.
+         * @param G The gravitational constant.
+         * @param theta The opening angle.
+         */
+        void solve(double G, double theta);
+
+    private:
+        /**
+         * @brief Number of objects per job when splitting the force evaluation.
+         */
+        static std::size_t constexpr objectsPerJob = 1024;
+
+        // Enlisted objects, per cache lookup index
+        std::array<std::vector<double**>, Data::JsonScope::cacheLookupThreadCount> enlisted;
+
+        // Buffers of the current solve, kept for their allocations
+        std::vector<double**> participants;
+        std::vector<Math::BarnesHut::Body> bodies;
+        Math::BarnesHut tree;
+    };
+
+    /**
+     * @brief Returns the gravity engine shared by all Physics ruleset modules.
+     */
+    static GravityEngine& gravityEngine();
 };
 } // namespace Nebulite::Module::Ruleset
 #endif // NEBULITE_MODULE_RULESET_PHYSICS_HPP
@@ -5,9 +5,12 @@
 // Includes
 
 // Standard library
+#include <complex>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string_view>
+#include <vector>
 
 // Nebulite
 #include "Nebulite/Module/Base/TransformationModule.hpp"
@@ -46,12 +49,38 @@ public:
     static auto constexpr applyIfftDesc = "Stores the inverse fft of a given complex-number or real-number series (mixable)\n"
         "Usage: ifft\n";
 
+    [[nodiscard]] static bool applyRfft(Data::JsonScope& jsonDoc);
+    static auto constexpr applyRfftName = "rfft";
+    static auto constexpr applyRfftDesc = "Stores the spectrum of a given real-number series as complex numbers, without zero-padding\n"
+        "As the spectrum of real numbers is conjugate-symmetric, only the first N/2+1 frequency bins are stored.\n"
+        "Usage: rfft\n";
+
+    [[nodiscard]] static bool applyDft(Data::JsonScope& jsonDoc);
+    static auto constexpr applyDftName = "dft";
+    static auto constexpr applyDftDesc = "Stores the discrete Fourier transform of a given complex-number or real-number series (mixable)\n"
+        "Unlike fft, the series is not zero-padded to a power of two, the result has the same length as the series.\n"
+        "Usage: dft\n";
+
+    [[nodiscard]] static bool applyIdft(Data::JsonScope& jsonDoc);
+    static auto constexpr applyIdftName = "idft";
+    static auto constexpr applyIdftDesc = "Stores the inverse discrete Fourier transform of a given complex-number or real-number series (mixable)\n"
+        "Unlike ifft, the series is not zero-padded to a power of two, the result has the same length as the series.\n"
+        "Usage: idft\n";
+
     [[nodiscard]] static bool applyTransferFunctionFrequencyDomain(std::span<std::string_view const> const& args, Data::JsonScope& jsonDoc);
     static auto constexpr applyTransferFunctionName = "applyTfDomainF";
     static auto constexpr applyTransferFunctionDesc = "Stores the result of applying a transfer function on the frequency domain to a given real-number series\n"
         "Usage: applyTfFDomain --num <num-series> --den <den-series>\n"
         "Where the num-series and den-series start withe the highest order coefficient and end with the lowest order coefficient.\n"
         "Example: 4 -1 0 1 -> 4z^-3 - z^-2 + 1\n";
+
+private:
+    /**
+     * @brief Reads a series of complex numbers, each member may be a real or a complex number.
+     * @param jsonDoc The document holding the series at its root.
+     * @return The series, or nullopt if any member is neither.
+     */
+    static std::optional<std::vector<std::complex<double>>> complexSamples(Data::JsonScope& jsonDoc);
 };
 } // namespace Nebulite::Module::Transformation
 #endif // NEBULITE_MODULE_TRANSFORMATION_FFT_HPP
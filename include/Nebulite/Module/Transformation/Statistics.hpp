@@ -5,8 +5,9 @@
 // Includes
 
 // Standard library
-#include <functional>
 #include <memory>
+#include <optional>
+#include <vector>
 
 // Nebulite
 #include "Nebulite/Module/Base/TransformationModule.hpp"
@@ -81,13 +82,11 @@ public:
 
 private:
     /**
-     * @brief Helper function to accumulate values in an array using a provided (double, double) -> double function.
-     * @param jsonDoc The JSON scope containing the array to accumulate over.
-     * @param func The binary function to apply for accumulation (e.g., addition for sum, multiplication for product).
-     * @param initialValue The initial value for the accumulation (default is 0.0, but can be set to 1.0 for product or +-infinity for min/max).
-     * @return The accumulated result, or NaN if the input is invalid (not an array or contains non-numeric values).
+     * @brief Helper function to read the array of the current JSON value in a single pass.
+     * @param jsonDoc The JSON scope containing the array.
+     * @return The values, or nullopt if the input is invalid (not an array or contains non-numeric or NaN values).
      */
-    static double accumulate(Data::JsonScope const& jsonDoc, std::function<double(double, double)> const& func, double initialValue = 0.0);
+    static std::optional<std::vector<double>> numericValues(Data::JsonScope const& jsonDoc);
 };
 } // namespace Nebulite::Module::Transformation
 #endif // NEBULITE_MODULE_TRANSFORMATION_STATISTICS_HPP
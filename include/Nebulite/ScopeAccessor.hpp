@@ -13,6 +13,7 @@
 namespace Nebulite::Core {
 class GlobalSpace;
 class RenderObject;
+class Renderer;
 } // namespace Nebulite::Core
 
 namespace Nebulite::Module::Domain::Renderer {
@@ -62,6 +63,7 @@ public:
         // Allowed accessors:
         friend class Core::GlobalSpace; // GlobalSpace needs to create the token and manage access to its Subdomains and itself
         friend class Module::Domain::Renderer::Console; // Console needs full access to display entire scope.
+        friend class Core::Renderer; // Renderer needs to adjust the simulation time for tiles updated at a reduced rate.
     };
 
     // Provide scoped GlobalSpace access to DomainModules
@@ -5,8 +5,10 @@
 // Includes
 
 // Standard library
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string>
@@ -120,16 +122,32 @@ public:
      */
     FuncTree(std::string_view name, ReturnValue const& valDefault, ReturnValue const& valFunctionNotFound, Io::Capture& captureInstance);
 
+    /**
+     * @brief Unregisters the tree from all trees it inherited.
+     */
+    ~FuncTree();
+
+    //------------------------------------------
+    // Disable Copying and Moving, inherited trees keep a pointer to this tree
+
+    FuncTree(FuncTree const&) = delete;
+    FuncTree& operator=(FuncTree const&) = delete;
+    FuncTree(FuncTree&&) = delete;
+    FuncTree& operator=(FuncTree&&) = delete;
+
     /**
      * @brief Inherits functions from another Tree.
      * @param toInherit FuncTree pointer to inherit functions from.
      */
     void inherit(std::shared_ptr<FuncTree> const& toInherit) {
         inheritedTrees.push_back(toInherit);
+        toInherit->inheritingTrees.push_back(this);
 
         for (auto& inner : toInherit->inheritedTrees) {
             inheritedTrees.push_back(inner);
+            inner->inheritingTrees.push_back(this);
         }
+        invalidateDispatchTable();
     }
 
     //------------------------------------------
@@ -158,6 +176,16 @@ public:
     ReturnValue parse(std::vector<std::string_view> const& args, AdditionalArgs... addArgs);
     ReturnValue parse(std::vector<std::string> const& args, AdditionalArgs... addArgs);
 
+    /**
+     * @brief Parses like parse, but without the dispatch table.
+     * @details Resolves the function in this tree and then in each inherited tree in order, splitting its name for every check.
+     *          parse falls back to this for names that are not bound exactly. Also used to benchmark the dispatch table.
+     * @param args Modern argument span, where arg[0] is the caller.
+     * @param addArgs Additional arguments to pass to the executed function
+     * @return The return value of the executed function, or the standard/error value.
+     */
+    ReturnValue parseStepwise(std::span<std::string_view const> const& args, AdditionalArgs... addArgs);
+
 
     /**
      * @brief Parses the command line arguments and executes the corresponding function.
@@ -169,6 +197,51 @@ public:
      */
     ReturnValue parseWithPrefix(std::vector<std::string_view>& existingArgs, std::string_view cmd, AdditionalArgs... addArgs);
 
+    //------------------------------------------
+    // Compiled commands
+
+    /**
+     * @struct CompiledCommand
+     * @brief A command resolved once against a FuncTree, skipping tokenization and function lookup on execution.
+     * @details Holds the owned tokens, the variables to set and the resolved function.
+     *          Only valid as long as the tree it was compiled with and all its categories are alive.
+     *          Not copyable, as the arguments are views into the owned tokens.
+     */
+    struct CompiledCommand {
+        std::vector<std::string> tokens; // Owned argument storage
+        std::vector<std::string_view> args; // Arguments passed to the function, starting at the function name
+        std::vector<bool*> variables; // Variables set by --var arguments
+        std::vector<FuncTree const*> preParseChain; // Trees whose preParse is called before execution, in order
+        FunctionPtr function;
+        FuncTree const* root = nullptr; // Tree the command was compiled with
+
+        CompiledCommand() = default;
+        ~CompiledCommand() = default;
+        CompiledCommand(CompiledCommand const&) = delete;
+        CompiledCommand& operator=(CompiledCommand const&) = delete;
+        CompiledCommand(CompiledCommand&&) noexcept = default;
+        CompiledCommand& operator=(CompiledCommand&&) noexcept = default;
+    };
+
+    /**
+     * @brief Resolves a command once, so it can be executed repeatedly without parsing.
+     * @details Same syntax as parseStr. Does not report errors: if the command cannot be resolved
+     *          (unclosed quote, unknown variable or function, nothing to execute), nullopt is returned
+     *          and the caller is expected to fall back to parseStr, which reports the error.
+     * @param cmd Command string to compile
+     * @return The compiled command, or nullopt if it cannot be resolved.
+     */
+    std::optional<CompiledCommand> compile(std::string_view cmd);
+
+    /**
+     * @brief Executes a compiled command.
+     * @details Equivalent to parseStr with the command string the CompiledCommand was compiled from.
+     * @param compiled The compiled command, must have been compiled with this tree.
+     * @param addArgs Additional arguments to pass to the executed function
+     * @return The return value of the executed function, or the error value of a failed preParse.
+     */
+    ReturnValue execute(CompiledCommand const& compiled, AdditionalArgs... addArgs) const;
+
     //------------------------------------------
     // Binding (Functions, Categories, Variables)
 
@@ -288,6 +361,9 @@ private:
     // inherited FuncTrees linked to this tree
     std::vector<std::shared_ptr<FuncTree>> inheritedTrees;
 
+    // FuncTrees that inherited this tree, directly or through another tree
+    std::vector<FuncTree*> inheritingTrees;
+
     /**
      * @struct BindingContainer
      * @brief Contains all bindings for categories, functions, and variables.
@@ -315,6 +391,70 @@ private:
      */
     ReturnValue executeFunction(std::string_view name, std::span<std::string_view const> const& args, AdditionalArgs... addArgs);
 
+    /**
+     * @brief Looks up the function in this tree and all inherited trees in order, then executes it.
+     * @param name The name of the function to execute.
+     * @param args Modern argument span.
+     * @param addArgs Additional arguments to pass to the function.
+     * @return The return value of the function.
+     */
+    ReturnValue executeStepwise(std::string_view name, std::span<std::string_view const> const& args, AdditionalArgs... addArgs);
+
+    /**
+     * @brief Calls a resolved function with the provided arguments.
+     * @param function The function to call.
+     * @param args Modern argument span.
+     * @param addArgs Additional arguments to pass to the function.
+     * @return The return value of the function.
+     */
+    static ReturnValue invokeFunction(FunctionPtr const& function, std::span<std::string_view const> const& args, AdditionalArgs... addArgs);
+
+    //------------------------------------------
+    // Dispatch table
+
+    /**
+     * @struct DispatchEntry
+     * @brief A function or category name, resolved across this tree and all inherited trees.
+     */
+    struct DispatchEntry {
+        FuncTree* owner = nullptr; // Tree the name is bound in, its preParse is called before execution
+        FunctionPtr const* function = nullptr; // Bound function, nullptr for categories
+        FuncTree* category = nullptr; // Category tree, nullptr for functions
+    };
+
+    /**
+     * @brief Flattened lookup of all names this tree executes, including those of inherited trees.
+     * @details Built on first use, so each command resolves with a single lookup instead of
+     *          checking this tree and every inherited tree in order.
+     *          Invalidated whenever this tree or an inherited tree binds a function or category, or inherits.
+     *          Entries point into the binding containers, which only change while binding.
+     */
+    absl::flat_hash_map<std::string, DispatchEntry> dispatchTable;
+    std::atomic<bool> dispatchTableValid = false;
+    std::mutex dispatchTableMutex;
+
+    /**
+     * @brief Marks the dispatch tables of this tree and all inheriting trees for rebuild.
+     */
+    void invalidateDispatchTable();
+
+    /**
+     * @brief Resolves a name through the dispatch table, rebuilding it if needed.
+     * @param name The function or category name.
+     * @return The entry, or nullptr if the name is not bound exactly like this.
+     */
+    DispatchEntry const* findDispatchEntry(std::string_view name);
+
+    /**
+     * @brief Executes a resolved function or category, mirroring executeFunction.
+     * @details Must be called on the owner of the entry.
+     * @param entry The resolved entry.
+     * @param args Modern argument span, starting at the function name.
+     * @param addArgs Additional arguments to pass to the function.
+     * @return The return value of the function.
+     */
+    ReturnValue executeDispatchEntry(DispatchEntry const& entry, std::span<std::string_view const> const& args, AdditionalArgs... addArgs);
+
     /**
      * @brief Displays help information to all bound functions. Automatically bound to any FuncTree on construction.
      * @return The standard return value.
@@ -398,6 +538,32 @@ private:
      */
     std::shared_ptr<FuncTree> findInInheritedTrees(std::string_view funcName);
 
+    //------------------------------------------
+    // Compilation helper
+
+    /**
+     * @brief Finds a bound variable in this tree or its inherited trees.
+     * @param varName Name of the variable
+     * @return Pointer to the variable, or nullptr if not found.
+     */
+    bool* findVariable(std::string_view varName);
+
+    /**
+     * @brief Resolves variables and the function of an argument list, mirroring parse.
+     * @param compiled The command to fill.
+     * @param args The arguments, first arg is the caller.
+     * @return true if the function was resolved.
+     */
+    bool compileArgs(CompiledCommand& compiled, std::span<std::string_view const> args);
+
+    /**
+     * @brief Resolves a function or category of this tree, mirroring executeFunction.
+     * @param compiled The command to fill.
+     * @param args The arguments, first arg is the function or category name.
+     * @return true if the function was resolved.
+     */
+    bool compileFunction(CompiledCommand& compiled, std::span<std::string_view const> args);
+
     //------------------------------------------
     // Completion
 
@@ -6,10 +6,14 @@
 
 // Standard library
 #include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <ranges>
 #include <span>
 #include <string>
@@ -78,6 +82,16 @@ FuncTree<ReturnValue, AdditionalArgs...>::FuncTree(std::string_view const name,
 } // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
 // Somehow marked as "potential memory leak" by clang-tidy, even though it's a unique_ptr and will be cleaned up automatically
 
+template <typename ReturnValue, typename... AdditionalArgs>
+FuncTree<ReturnValue, AdditionalArgs...>::~FuncTree() {
+    // Inherited trees are kept alive by us, so they are still valid here
+    for (auto const& inheritedTree : inheritedTrees) {
+        if (inheritedTree != nullptr) {
+            std::erase(inheritedTree->inheritingTrees, this);
+        }
+    }
+}
+
 //------------------------------------------
 // Binding (Functions, Categories, Variables)
 
@@ -191,6 +205,7 @@ void FuncTree<ReturnValue, AdditionalArgs...>::bindFunction(WrappedFunction cons
             .description=std::string(helpDescription),
         }
     );
+    invalidateDispatchTable();
 }
 
 template <typename ReturnValue, typename... AdditionalArgs>
@@ -210,10 +225,12 @@ void FuncTree<ReturnValue, AdditionalArgs...>::bindCategory(std::string_view con
     // Category traversal
     auto const categoryStructure = StringHandler::split(name, ' ');
     absl::flat_hash_map<std::string, CategoryInfo>* currentCategoryMap = &bindingContainer.categories;
+    FuncTree* currentTree = this;
     for (auto const& currentCategoryName : categoryStructure | std::views::take(categoryStructure.size() - 1)) {
         if (currentCategoryMap->find(currentCategoryName) != currentCategoryMap->end()) {
             // Category exists, go deeper
-            currentCategoryMap = &(*currentCategoryMap)[currentCategoryName].tree->bindingContainer.categories;
+            currentTree = (*currentCategoryMap)[currentCategoryName].tree.get();
+            currentCategoryMap = &currentTree->bindingContainer.categories;
         } else {
             // Category does not exist, throw error
             BindErrorMessage::parentCategoryDoesNotExist(capture, name, currentCategoryName);
@@ -236,6 +253,7 @@ void FuncTree<ReturnValue, AdditionalArgs...>::bindCategory(std::string_view con
         ),
         std::string(helpDescription),
     };
+    currentTree->invalidateDispatchTable();
 }
 
 template <typename ReturnValue, typename... AdditionalArgs>
@@ -520,14 +538,22 @@ ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::parse(std::span<std::strin
     }
     // Call function
     auto funcName = actualArgs.front();
-    auto inheritedTree = findInInheritedTrees(funcName);
-    if (inheritedTree != nullptr) {
-        // Function is in inherited tree, call there
-        return inheritedTree->executeFunction(funcName, actualArgs, addArgs...);
+    if (auto const* entry = findDispatchEntry(funcName); entry != nullptr) [[likely]] {
+        return entry->owner->executeDispatchEntry(*entry, actualArgs, addArgs...);
     }
 
-    // Not found in inherited trees, execute the function in main tree
-    return executeFunction(funcName, actualArgs, addArgs...);
+    // Not an exact match, e.g. surrounding whitespaces or an unknown function: resolve step by step
+    return executeStepwise(funcName, actualArgs, addArgs...);
+}
+
+template <typename ReturnValue, typename... AdditionalArgs>
+ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::parseStepwise(std::span<std::string_view const> const& args, AdditionalArgs... addArgs) {
+    auto actualArgs = args.subspan(1); // First arg is caller, remove
+    processVariableArguments(actualArgs);
+    if (actualArgs.empty()) {
+        return standardReturn.valDefault; // Nothing to execute, return standard
+    }
+    return executeStepwise(actualArgs.front(), actualArgs, addArgs...);
 }
 
 template <typename ReturnValue, typename... AdditionalArgs>
@@ -564,6 +590,42 @@ ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::parseWithPrefix(std::vecto
     return parse(existingArgs, addArgs...);
 }
 
+//------------------------------------------
+// Compiled commands
+
+template <typename ReturnValue, typename... AdditionalArgs>
+std::optional<typename FuncTree<ReturnValue, AdditionalArgs...>::CompiledCommand> FuncTree<ReturnValue, AdditionalArgs...>::compile(std::string_view cmd) {
+    StringHandler::rStrip(cmd);
+    auto [tokens, unclosedQuote] = StringHandler::parseQuotedArguments(cmd);
+    if (unclosedQuote || tokens.empty()) {
+        return std::nullopt;
+    }
+    CompiledCommand compiled;
+    compiled.root = this;
+    compiled.tokens = std::move(tokens);
+    std::vector<std::string_view> const argsView(compiled.tokens.begin(), compiled.tokens.end());
+    if (!compileArgs(compiled, argsView)) {
+        return std::nullopt;
+    }
+    return compiled;
+}
+
+template <typename ReturnValue, typename... AdditionalArgs>
+ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::execute(CompiledCommand const& compiled, AdditionalArgs... addArgs) const {
+    assert(compiled.root == this);
+    for (bool* variable : compiled.variables) {
+        *variable = true;
+    }
+    for (FuncTree const* tree : compiled.preParseChain) {
+        if (tree->preParse != nullptr) {
+            if (ReturnValue err = tree->preParse(); !Math::isEqual(err, tree->standardReturn.valDefault)) {
+                return err; // Return error if preParse failed
+            }
+        }
+    }
+    return invokeFunction(compiled.function, compiled.args, addArgs...);
+}
+
 template <typename ReturnValue, typename... AdditionalArgs>
 ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::executeFunction(std::string_view const name, std::span<std::string_view const> const& args, AdditionalArgs... addArgs) {
     // Call preParse function if set
@@ -580,50 +642,7 @@ ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::executeFunction(std::strin
     // Find and execute the function
     auto functionPosition = bindingContainer.functions.find(function);
     if (functionPosition != bindingContainer.functions.end()) {
-        auto& [functionPtr, description] = functionPosition->second.function;
-        return std::visit([&]<typename Func>(Func& func) {
-            using T = std::decay_t<Func>;
-
-            // Legacy function types
-            if constexpr (std::is_same_v<T, std::function<ReturnValue(int, char const**)>>) {
-                // Convert to argc/argv
-                std::size_t const argc = args.size();
-                std::vector<char const*> argvVec;
-                argvVec.reserve(argc + 1);
-                std::vector<std::string> argsOwned;
-                std::transform(
-                    args.begin(),
-                    args.end(),
-                    std::back_inserter(argsOwned),
-                    [](std::string_view const str) { return std::string(str); }
-                );
-                std::transform(
-                    argsOwned.begin(),
-                    argsOwned.end(),
-                    std::back_inserter(argvVec),
-                    [](std::string const& str) { return str.c_str(); }
-                );
-                argvVec.push_back(nullptr); // Null-terminate
-                return func(static_cast<int>(argc), argvVec.data());
-            }
-            // Modern function types
-            else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::Full> || std::is_same_v<T, typename SupportedFunctions::Modern::FullConstRef>) {
-                return func(args, addArgs...);
-            }
-            else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::NoCmdArgs>) {
-                return func(addArgs...);
-            }
-            else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::NoAddArgs> || std::is_same_v<T, typename SupportedFunctions::Modern::NoAddArgsConstRef>) {
-                return func(args);
-            }
-            else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::NoArgs>) {
-                return func();
-            }
-            // Unsupported function type
-            else {
-                static_assert(CompileTimeEvaluate::alwaysFalse(), "Unsupported function signature in FuncTree::executeFunction. Check if you just need to remove some const/ref qualifiers.");
-            }
-        }, functionPtr);
+        return invokeFunction(functionPosition->second.function.function, args, addArgs...);
     }
     // Find function name in bindingContainer.categories
     if (bindingContainer.categories.find(function) != bindingContainer.categories.end()) {
@@ -639,6 +658,123 @@ ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::executeFunction(std::strin
     return standardReturn.valFunctionNotFound;
 }
 
+template <typename ReturnValue, typename... AdditionalArgs>
+ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::executeStepwise(std::string_view const name, std::span<std::string_view const> const& args, AdditionalArgs... addArgs) {
+    auto inheritedTree = findInInheritedTrees(name);
+    if (inheritedTree != nullptr) {
+        // Function is in inherited tree, call there
+        return inheritedTree->executeFunction(name, args, addArgs...);
+    }
+
+    // Not found in inherited trees, execute the function in main tree
+    return executeFunction(name, args, addArgs...);
+}
+
+//------------------------------------------
+// Dispatch table
+
+template <typename ReturnValue, typename... AdditionalArgs>
+void FuncTree<ReturnValue, AdditionalArgs...>::invalidateDispatchTable() {
+    dispatchTableValid.store(false, std::memory_order_release);
+    for (auto* inheritingTree : inheritingTrees) {
+        inheritingTree->dispatchTableValid.store(false, std::memory_order_release);
+    }
+}
+
+template <typename ReturnValue, typename... AdditionalArgs>
+typename FuncTree<ReturnValue, AdditionalArgs...>::DispatchEntry const* FuncTree<ReturnValue, AdditionalArgs...>::findDispatchEntry(std::string_view const name) {
+    if (!dispatchTableValid.load(std::memory_order_acquire)) [[unlikely]] {
+        std::scoped_lock const lock(dispatchTableMutex);
+        if (!dispatchTableValid.load(std::memory_order_relaxed)) {
+            // Same precedence as findInInheritedTrees: this tree first, then inherited trees in order
+            dispatchTable.clear();
+            auto const addBindings = [this](FuncTree& tree) {
+                for (auto& [functionName, info] : tree.bindingContainer.functions) {
+                    dispatchTable.try_emplace(functionName, DispatchEntry{.owner = &tree, .function = &info.function.function});
+                }
+                for (auto& [categoryName, info] : tree.bindingContainer.categories) {
+                    dispatchTable.try_emplace(categoryName, DispatchEntry{.owner = &tree, .category = info.tree.get()});
+                }
+            };
+            addBindings(*this);
+            for (auto const& inheritedTree : inheritedTrees) {
+                if (inheritedTree != nullptr) {
+                    addBindings(*inheritedTree);
+                }
+            }
+            dispatchTableValid.store(true, std::memory_order_release);
+        }
+    }
+    if (auto const it = dispatchTable.find(name); it != dispatchTable.end()) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+template <typename ReturnValue, typename... AdditionalArgs>
+ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::executeDispatchEntry(DispatchEntry const& entry, std::span<std::string_view const> const& args, AdditionalArgs... addArgs) {
+    assert(entry.owner == this);
+
+    // Call preParse function if set
+    if (preParse != nullptr) {
+        if (ReturnValue err = preParse(); !Math::isEqual(err, standardReturn.valDefault)) {
+            return err; // Return error if preParse failed
+        }
+    }
+
+    if (entry.function != nullptr) {
+        return invokeFunction(*entry.function, args, addArgs...);
+    }
+    return entry.category->parseStr(StringHandler::recombineArgs(args), addArgs...);
+}
+
+template <typename ReturnValue, typename... AdditionalArgs>
+ReturnValue FuncTree<ReturnValue, AdditionalArgs...>::invokeFunction(FunctionPtr const& function, std::span<std::string_view const> const& args, AdditionalArgs... addArgs) {
+    return std::visit([&]<typename Func>(Func const& func) {
+        using T = std::decay_t<Func>;
+
+        // Legacy function types
+        if constexpr (std::is_same_v<T, std::function<ReturnValue(int, char const**)>>) {
+            // Convert to argc/argv
+            std::size_t const argc = args.size();
+            std::vector<char const*> argvVec;
+            argvVec.reserve(argc + 1);
+            std::vector<std::string> argsOwned;
+            std::transform(
+                args.begin(),
+                args.end(),
+                std::back_inserter(argsOwned),
+                [](std::string_view const str) { return std::string(str); }
+            );
+            std::transform(
+                argsOwned.begin(),
+                argsOwned.end(),
+                std::back_inserter(argvVec),
+                [](std::string const& str) { return str.c_str(); }
+            );
+            argvVec.push_back(nullptr); // Null-terminate
+            return func(static_cast<int>(argc), argvVec.data());
+        }
+        // Modern function types
+        else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::Full> || std::is_same_v<T, typename SupportedFunctions::Modern::FullConstRef>) {
+            return func(args, addArgs...);
+        }
+        else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::NoCmdArgs>) {
+            return func(addArgs...);
+        }
+        else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::NoAddArgs> || std::is_same_v<T, typename SupportedFunctions::Modern::NoAddArgsConstRef>) {
+            return func(args);
+        }
+        else if constexpr (std::is_same_v<T, typename SupportedFunctions::Modern::NoArgs>) {
+            return func();
+        }
+        // Unsupported function type
+        else {
+            static_assert(CompileTimeEvaluate::alwaysFalse(), "Unsupported function signature in FuncTree::invokeFunction. Check if you just need to remove some const/ref qualifiers.");
+        }
+    }, function);
+}
+
 //------------------------------------------
 // Argument processing helper
 
@@ -697,5 +833,68 @@ std::shared_ptr<FuncTree<ReturnValue, AdditionalArgs...>> FuncTree<ReturnValue,
     return nullptr;
 }
 
+//------------------------------------------
+// Compilation helper
+
+template <typename ReturnValue, typename... AdditionalArgs>
+bool* FuncTree<ReturnValue, AdditionalArgs...>::findVariable(std::string_view varName) {
+    if (auto const& varIt = bindingContainer.variables.find(varName); varIt != bindingContainer.variables.end()) {
+        return varIt->second.pointer;
+    }
+    for (auto const& inheritedTree : inheritedTrees) {
+        auto& inheritedVars = inheritedTree->bindingContainer.variables;
+        if (auto const& inheritedVarIt = inheritedVars.find(varName); inheritedVarIt != inheritedVars.end() && inheritedVarIt->second.pointer) {
+            return inheritedVarIt->second.pointer;
+        }
+    }
+    return nullptr;
+}
+
+template <typename ReturnValue, typename... AdditionalArgs>
+bool FuncTree<ReturnValue, AdditionalArgs...>::compileArgs(CompiledCommand& compiled, std::span<std::string_view const> args) {
+    args = args.subspan(1); // First arg is caller, remove
+    while (!args.empty() && args[0].length() >= 2 && args[0].starts_with("--")) {
+        bool* variable = findVariable(args[0].substr(2));
+        if (variable == nullptr) {
+            return false;
+        }
+        compiled.variables.push_back(variable);
+        args = args.subspan(1);
+    }
+    if (args.empty()) {
+        return false; // Nothing to execute
+    }
+    if (auto const inheritedTree = findInInheritedTrees(args.front()); inheritedTree != nullptr) {
+        return inheritedTree->compileFunction(compiled, args);
+    }
+    return compileFunction(compiled, args);
+}
+
+template <typename ReturnValue, typename... AdditionalArgs>
+bool FuncTree<ReturnValue, AdditionalArgs...>::compileFunction(CompiledCommand& compiled, std::span<std::string_view const> args) {
+    compiled.preParseChain.push_back(this);
+
+    std::string_view function = args.front();
+    StringHandler::strip(function);
+
+    if (auto const functionPosition = bindingContainer.functions.find(function); functionPosition != bindingContainer.functions.end()) {
+        compiled.function = functionPosition->second.function.function;
+        compiled.args.assign(args.begin(), args.end());
+        return true;
+    }
+    if (auto const categoryPosition = bindingContainer.categories.find(function); categoryPosition != bindingContainer.categories.end()) {
+        // Categories re-parse the recombined arguments, see executeFunction
+        std::string const recombined = StringHandler::recombineArgs(args);
+        auto [tokens, unclosedQuote] = StringHandler::parseQuotedArguments(recombined);
+        if (unclosedQuote || tokens.empty()) {
+            return false;
+        }
+        compiled.tokens = std::move(tokens); // Invalidates args, not used below
+        std::vector<std::string_view> const argsView(compiled.tokens.begin(), compiled.tokens.end());
+        return categoryPosition->second.tree->compileArgs(compiled, argsView);
+    }
+    return false;
+}
+
 } // namespace Nebulite::Utility::Args
 #endif // NEBULITE_UTILITY_ARGS_FUNCTREE_TPP
@@ -0,0 +1,139 @@
+#ifndef NEBULITE_UTILITY_COORDINATION_TASKSCHEDULER_HPP
+#define NEBULITE_UTILITY_COORDINATION_TASKSCHEDULER_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <atomic>
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//------------------------------------------
+namespace Nebulite::Utility::Coordination {
+/**
+ * @class Nebulite::Utility::Coordination::TaskScheduler
+ * @brief Shared work-stealing thread pool for fine-grained parallel jobs, such as tiles or broadcast-listen shards.
+ * @details Each worker owns a job deque. Submitted jobs are dealt round-robin onto all deques,
+ *          workers take jobs from the back of their own deque and steal from the front of others once it runs empty.
+ *          Uneven jobs are therefore balanced automatically, without a start-all/wait-all handshake per worker.
+ *          The submitting thread takes part in processing until all of its jobs are done.
+ *          Workers sleep on an atomic wait while no jobs are available.
+ */
+class TaskScheduler {
+public:
+    static TaskScheduler& instance();
+
+    ~TaskScheduler();
+
+    // Non-copyable, non-movable
+    TaskScheduler(TaskScheduler const&) = delete;
+    TaskScheduler& operator=(TaskScheduler const&) = delete;
+    TaskScheduler(TaskScheduler&&) = delete;
+    TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+    /**
+     * @brief Calls func(index) for every index in [0, count) in parallel and returns once all calls are done.
+     * @details Each index is a separate job. The calling thread takes part in processing.
+     *          Lower indices tend to start first, so expensive jobs should be given the lowest indices.
+     *          May be called from within a job, the waiting job then processes other jobs in the meantime.
+     * @tparam Func The function type, invocable with the job index.
+     * @param count The number of jobs.
+     * @param func The function to call. Must be safe to call concurrently for different indices.
+     * @throws Rethrows the first exception thrown by any job, after all jobs are done.
+     */
+    template<typename Func>
+    void parallelFor(std::size_t const count, Func const& func) {
+        static_assert(std::is_invocable_v<Func const&, std::size_t>, "Function must be invocable with (std::size_t)");
+        run(count, [](void const* context, std::size_t const index) {
+            (*static_cast<Func const*>(context))(index);
+        }, &func);
+    }
+
+    /**
+     * @brief Returns the number of dedicated worker threads, not counting submitting threads.
+     * @return The worker count.
+     */
+    [[nodiscard]] std::size_t getWorkerCount() const { return workers.size(); }
+
+private:
+    TaskScheduler();
+
+    using JobFunction = void (*)(void const* context, std::size_t index);
+
+    /**
+     * @brief Shared state of all jobs of a single parallelFor call.
+     */
+    struct Batch {
+        std::atomic<std::size_t> remaining;
+        std::atomic<bool> failed{false};
+        std::exception_ptr exception;
+    };
+
+    struct Job {
+        JobFunction function = nullptr;
+        void const* context = nullptr;
+        std::size_t index = 0;
+        Batch* batch = nullptr;
+    };
+
+    /**
+     * @brief Job deque of a single worker. The last queue is shared by all threads that are not workers.
+     */
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    /**
+     * @brief Submits all jobs of a batch and processes jobs until the batch is done.
+     */
+    void run(std::size_t count, JobFunction function, void const* context);
+
+    /**
+     * @brief Takes a job from the back of the given queue.
+     */
+    bool pop(std::size_t queueIndex, Job& job);
+
+    /**
+     * @brief Takes a job from the front of any queue other than the given one.
+     */
+    bool steal(std::size_t queueIndex, Job& job);
+
+    /**
+     * @brief Executes a job and marks it as done in its batch.
+     */
+    void execute(Job const& job);
+
+    /**
+     * @brief Main loop of each worker thread.
+     * @param queueIndex The index of the queue owned by the worker.
+     */
+    void workerLoop(std::size_t queueIndex);
+
+    /**
+     * @brief Index of the queue owned by the calling thread.
+     */
+    [[nodiscard]] std::size_t ownQueueIndex() const ;
+
+    std::vector<std::unique_ptr<Queue>> queues;
+
+    // Incremented whenever new jobs are submitted, sleeping workers wait on changes
+    std::atomic<std::uint64_t> submissions{0};
+
+    // Incremented whenever a job finishes, waiting submitters wait on changes
+    std::atomic<std::uint64_t> completions{0};
+
+    std::atomic<bool> stopFlag{false};
+
+    std::vector<std::jthread> workers;
+};
+} // namespace Nebulite::Utility::Coordination
+#endif // NEBULITE_UTILITY_COORDINATION_TASKSCHEDULER_HPP
@@ -0,0 +1,98 @@
+/**
+ * @file AsyncLog.hpp
+ * @brief Defines the asynchronous backend of Capture.
+ */
+
+#ifndef NEBULITE_UTILITY_IO_ASYNCLOG_HPP
+#define NEBULITE_UTILITY_IO_ASYNCLOG_HPP
+
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+// Nebulite
+#include "Nebulite/Utility/Io/Capture.hpp"
+
+//------------------------------------------
+namespace Nebulite::Utility::Io {
+/**
+ * @class Nebulite::Utility::Io::AsyncLog
+ * @brief Optional backend of Capture, moving console output and history appends off the logging threads.
+ * @details Once enabled, each thread submits its output to its own lock-free ring buffer, with a single drain
+ *          thread writing all rings to the console and the histories of their captures.
+ *          Output of a thread keeps its order, output of different threads is not ordered.
+ *          A thread that fills its ring drains all rings itself. If its ring is still full afterward,
+ *          e.g. because another thread drains or an entry waits for a redirected capture,
+ *          it writes the entry right away, ahead of its pending entries.
+ *          Redirected captures bypass the rings, so redirect and redirectHistory capture output as before.
+ *          Entries for a capture that is being redirected on another thread stay pending until the redirect ends,
+ *          along with all later entries of the same thread.
+ *
+ *          Formatting stays on the logging thread, as arguments may not outlive the call.
+ */
+class AsyncLog {
+public:
+    /**
+     * @struct Entry
+     * @brief A formatted string submitted to a capture.
+     */
+    struct Entry {
+        Capture* capture = nullptr;
+        std::string content;
+        HistoryLine::Type type = HistoryLine::Type::info;
+        std::ostream* console = nullptr; // nullptr to only capture the string
+    };
+
+    /**
+     * @brief Number of entries each thread can submit before it has to wait for a drain.
+     */
+    static std::size_t constexpr ringCapacity = 1024;
+
+    /**
+     * @brief Maximum time between two drains.
+     */
+    static auto constexpr drainInterval = std::chrono::milliseconds(5);
+
+    /**
+     * @brief Starts the drain thread, captures submit to the rings from now on.
+     * @details Disabled automatically on exit.
+     */
+    static void enable();
+
+    /**
+     * @brief Stops the drain thread after writing all pending entries.
+     * @details Captures write synchronously again.
+     *          Only call while no other thread is logging, their entries may otherwise stay pending until the next flush.
+     */
+    static void disable();
+
+    [[nodiscard]] static bool isEnabled() noexcept;
+
+    /**
+     * @brief Submits an entry to the ring of the calling thread.
+     * @param entry The entry to submit, moved from.
+     */
+    static void push(Entry&& entry);
+
+    /**
+     * @brief Writes all pending entries on the calling thread.
+     * @details Call before changing a console stream, e.g. redirecting std::cerr to a file.
+     *          Entries for captures redirected on another thread are skipped, see tryWrite.
+     */
+    static void flush();
+
+private:
+    /**
+     * @brief Writes a drained entry to its capture, unless the history of the capture is locked.
+     * @param entry The entry to write.
+     * @return True if the entry was written, false to keep it pending.
+     */
+    static bool tryWrite(Entry const& entry);
+};
+} // namespace Nebulite::Utility::Io
+#endif // NEBULITE_UTILITY_IO_ASYNCLOG_HPP
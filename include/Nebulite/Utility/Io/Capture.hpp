@@ -10,6 +10,8 @@
 // Includes
 
 // Standard library
+#include <atomic>
+#include <cstddef>
 #include <cstdint> // NOLINT
 #include <deque>
 #include <functional>
@@ -24,6 +26,7 @@
 // Forward declarations
 
 namespace Nebulite::Utility::Io {
+class AsyncLog;
 class Capture;
 } // namespace Nebulite::Utility::Io
 
@@ -51,10 +54,9 @@ struct HistoryLine{
 template<std::ostream* /*BaseStream*/, HistoryLine::Type /*LineType*/>
 class Stream {
     Capture* capture; // Main capture reference so we can lock its mutex, so cout/cerr don't interfere with each other
-    void putStr(std::string const& str, bool printToConsole) const ;
 
     template<typename T>
-    decltype(auto) logArg(T&& t) {
+    static decltype(auto) logArg(T&& t) {
         using U = std::remove_reference_t<T>;
 
         if constexpr (std::is_array_v<U>) {
@@ -70,6 +72,22 @@ public:
     //------------------------------------------
     // Printing helpers
 
+    /**
+     * @brief Formats the provided arguments into a single string.
+     * @tparam Args The types of the arguments to format.
+     * @param args The arguments to format.
+     * @return The formatted string.
+     */
+    template<typename... Args>
+    [[nodiscard]] static std::string format(Args&&... args);
+
+    /**
+     * @brief Submits an already formatted string to the capture.
+     * @param str The string to submit.
+     * @param printToConsole Whether to print to the console or just capture in the list.
+     */
+    void putStr(std::string str, bool printToConsole) const ;
+
     /**
      * @brief Prints the provided arguments to the stream and captures them in a list.
      * @tparam Args The types of the arguments to print.
@@ -104,6 +122,12 @@ class HierarchicalStream {
 
     bool outputEnabled = true;
 
+    /**
+     * @brief Submits a formatted string to all parents first, then to this stream.
+     * @param str The formatted string.
+     */
+    void putStr(std::string const& str);
+
 public:
     explicit HierarchicalStream(Capture* cap, HierarchicalStream* par = nullptr)
         : coutStream(cap), parent(par) {}
@@ -128,18 +152,53 @@ class Capture{
 public:
     static auto constexpr noParent = nullptr;
 
+    /**
+     * @brief Number of lines each capture keeps by default, older lines are dropped.
+     */
+    static std::size_t constexpr defaultHistoryLimit = 10000;
+
     explicit Capture(Capture* parent);
 
+    /**
+     * @brief Flushes pending asynchronous output of this capture, see AsyncLog.
+     */
+    ~Capture();
+
+    //------------------------------------------
+    // Disable Copying and Moving, pending asynchronous output refers to this capture
+
+    Capture(Capture const&) = delete;
+    Capture& operator=(Capture const&) = delete;
+    Capture(Capture&&) = delete;
+    Capture& operator=(Capture&&) = delete;
+
     HierarchicalStream<&std::cout, HistoryLine::Type::info> log;
     HierarchicalStream<&std::cerr, HistoryLine::Type::warning> warning;
     HierarchicalStream<&std::cerr, HistoryLine::Type::error> error;
 
     /**
      * @brief Retrieves a pointer to the history.
+     * @details Lines may be added from other threads, or the drain thread of AsyncLog.
+     *          Hold the lock from lockHistory while reading.
      * @return A pointer to the output log deque, const.
      */
     [[nodiscard]] std::deque<HistoryLine> const& getHistory() const ;
 
+    /**
+     * @brief Locks the history, so it can be read while other threads capture output.
+     * @return The lock, held until destroyed.
+     */
+    [[nodiscard]] std::unique_lock<std::recursive_mutex> lockHistory();
+
+    /**
+     * @brief Sets the number of lines all captures keep, older lines are dropped.
+     * @details Histories of redirected output are not limited.
+     * @param lines The maximum number of lines, 0 for unlimited.
+     */
+    static void setHistoryLimit(std::size_t lines) noexcept;
+
+    [[nodiscard]] static std::size_t getHistoryLimit() noexcept;
+
     /**
      * @brief Clears the output log.
      */
@@ -149,11 +208,21 @@ public:
 
     /**
      * @brief Appends input to the history
+     * @details Goes through AsyncLog if enabled, so the line stays in order with pending output.
      * @param str The string to append to the log.
      * @param lineType The type of line to add.
      */
     void appendToHistory(std::string const& str, HistoryLine::Type lineType);
 
+    /**
+     * @brief Prints a string to the console, if given, and appends it to the history.
+     * @details Deferred to the drain thread of AsyncLog if enabled and no redirect is active.
+     * @param str The string to submit.
+     * @param lineType The type of line to add.
+     * @param console The stream to print to, nullptr to only capture the string.
+     */
+    void submit(std::string str, HistoryLine::Type lineType, std::ostream* console);
+
     /**
      * @brief Redirects any captured history during a called function to a string
      * @tparam F The function type to call
@@ -164,10 +233,12 @@ public:
     std::string redirect(F f) {
         std::scoped_lock const lock(historyMutex);
         redirectorStack.emplace_back();
+        redirectDepth.fetch_add(1, std::memory_order_relaxed);
         disableOutput();
         std::invoke(f);
         auto const history = redirectorStack.back().toString();
         redirectorStack.pop_back();
+        redirectDepth.fetch_sub(1, std::memory_order_relaxed);
         if (redirectorStack.empty()) {
             enableOutput();
         }
@@ -184,10 +255,12 @@ public:
     std::deque<HistoryLine> redirectHistory(F f) {
         std::scoped_lock const lock(historyMutex);
         redirectorStack.emplace_back();
+        redirectDepth.fetch_add(1, std::memory_order_relaxed);
         disableOutput();
         std::invoke(f);
         auto const history = redirectorStack.back().getLines();
         redirectorStack.pop_back();
+        redirectDepth.fetch_sub(1, std::memory_order_relaxed);
         if (redirectorStack.empty()) {
             enableOutput();
         }
@@ -195,6 +268,16 @@ public:
     }
 
 private:
+    friend class AsyncLog;
+
+    /**
+     * @brief Prints and appends a string right away, used by submit and the drain of AsyncLog.
+     * @param str The string to append to the log.
+     * @param lineType The type of line to add.
+     * @param console The stream to print to, nullptr to only capture the string.
+     */
+    void write(std::string const& str, HistoryLine::Type lineType, std::ostream* console);
+
     /**
      * @brief Disables the output temporarily, preventing any further output from being printed to the console.
      * @details Output is still captured by the log!
@@ -248,12 +331,23 @@ private:
         std::string toString();
 
         void addHistoryLine(std::string const& str, HistoryLine::Type lineType);
+
+        /**
+         * @brief Drops the oldest lines until at most maxLines remain.
+         * @param maxLines The maximum number of lines, 0 for unlimited.
+         */
+        void trim(std::size_t maxLines);
     };
 
     History localHistory;
     std::recursive_mutex historyMutex;  // Mutex for thread-safe access to outputList
 
     std::vector<History> redirectorStack;
+    std::atomic<std::size_t> redirectDepth = 0; // Size of redirectorStack, readable without the lock
+
+    std::atomic<std::size_t> pendingEntries = 0; // Entries submitted to AsyncLog, but not yet written
+
+    static inline std::atomic<std::size_t> historyLimit = defaultHistoryLimit;
 };
 
 } // namespace Nebulite::Utility::Io
@@ -8,6 +8,7 @@
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <utility>
 
 //------------------------------------------
 // Conditional includes
@@ -20,54 +21,58 @@
 namespace Nebulite::Utility::Io {
 
 template<std::ostream* BaseStream, HistoryLine::Type LineType>
-void Stream<BaseStream, LineType>::putStr(std::string const& str, bool const printToConsole) const {
-    if (printToConsole) {
-        *BaseStream << str;
+template<typename... Args>
+std::string Stream<BaseStream, LineType>::format(Args&&... args) {
+    std::ostringstream workingBuffer{};
+    if constexpr (sizeof...(args) != 0) {
+        (workingBuffer << ... << logArg(std::forward<Args>(args)));
     }
-    capture->appendToHistory(str, LineType);
+    return std::move(workingBuffer).str();
+}
+
+template<std::ostream* BaseStream, HistoryLine::Type LineType>
+void Stream<BaseStream, LineType>::putStr(std::string str, bool const printToConsole) const {
+    capture->submit(std::move(str), LineType, printToConsole ? BaseStream : nullptr);
 }
 
 template<std::ostream* BaseStream, HistoryLine::Type LineType>
 template<typename... Args>
 void Stream<BaseStream, LineType>::print(bool const printToConsole, Args&&... args) {
-    std::ostringstream workingBuffer{};
-    if constexpr (sizeof...(args) != 0) {
-        (workingBuffer << ... << logArg(std::forward<Args>(args)));
-    }
-    putStr(workingBuffer.str(), printToConsole);
+    putStr(format(std::forward<Args>(args)...), printToConsole);
 }
 
 template<std::ostream* BaseStream, HistoryLine::Type LineType>
 template<typename... Args>
 void Stream<BaseStream, LineType>::println(bool const printToConsole, Args&&... args) {
-    std::ostringstream workingBuffer{};
-    if constexpr (sizeof...(args) != 0) {
-        (workingBuffer << ... << logArg(std::forward<Args>(args)));
-    }
-    workingBuffer << '\n';
-    putStr(workingBuffer.str(), printToConsole);
+    auto str = format(std::forward<Args>(args)...);
+    str.push_back('\n');
+    putStr(std::move(str), printToConsole);
 }
 
 template<std::ostream* BaseStream, HistoryLine::Type LineType>
-template<typename... Args>
-void HierarchicalStream<BaseStream, LineType>::print(Args&&... args){
+void HierarchicalStream<BaseStream, LineType>::putStr(std::string const& str){
     if (parent) {
         // Pass to parent stream for retention
-        parent->print(args...);
+        parent->putStr(str);
     }
     // Only print to console if this is the root stream, to avoid duplicate prints
-    coutStream.print(!parent && outputEnabled, std::forward<Args>(args)...);
+    coutStream.putStr(str, !parent && outputEnabled);
+}
+
+template<std::ostream* BaseStream, HistoryLine::Type LineType>
+template<typename... Args>
+void HierarchicalStream<BaseStream, LineType>::print(Args&&... args){
+    // Format once for the whole hierarchy
+    putStr(Stream<BaseStream, LineType>::format(std::forward<Args>(args)...));
 }
 
 template<std::ostream* BaseStream, HistoryLine::Type LineType>
 template<typename... Args>
 void HierarchicalStream<BaseStream, LineType>::println(Args&&... args){
-    if (parent) {
-        // Pass to parent stream for retention
-        parent->println(args...);
-    }
-    // Only print to console if this is the root stream, to avoid duplicate prints
-    coutStream.println(!parent && outputEnabled, std::forward<Args>(args)...);
+    // Format once for the whole hierarchy
+    auto str = Stream<BaseStream, LineType>::format(std::forward<Args>(args)...);
+    str.push_back('\n');
+    putStr(str);
 }
 
 } // namespace Nebulite::Utility::Io
@@ -0,0 +1,358 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Nebulite
+#include "Nebulite/Audio/Mixer.hpp"
+#include "Nebulite/Audio/Stream.hpp"
+
+//------------------------------------------
+namespace Nebulite::Audio {
+
+namespace {
+/**
+ * @brief Adds a source to a channel, with a gain ramping linearly from start by step per frame.
+ */
+void accumulate(std::span<float> const channel, std::span<float const> const source, float const start, float const step) {
+    // A signed 32-bit counter, as only those have a vector conversion to float
+    auto const count = static_cast<std::int32_t>(channel.size());
+    for (std::int32_t i = 0; i < count; i++) {
+        channel[static_cast<std::size_t>(i)] += source[static_cast<std::size_t>(i)] * (start + step * static_cast<float>(i + 1));
+    }
+}
+
+/**
+ * @brief Splits interleaved frames into the first two channels.
+ */
+void deinterleave(float const* interleaved, std::size_t const channels, std::span<float> const left, std::span<float> const right) {
+    for (std::size_t i = 0; i < left.size(); i++) {
+        left[i] = interleaved[i * channels];
+        right[i] = interleaved[i * channels + 1];
+    }
+}
+
+/**
+ * @brief Resamples frames by linear interpolation, starting at a fractional frame and advancing by step.
+ * @details Positions are computed from the start instead of accumulated, so long blocks do not drift.
+ *          The frame after the last interpolated position must exist.
+ */
+template <bool stereo>
+void interpolate(float const* samples, std::size_t const channels, double const start, double const step, std::span<float> const left, std::span<float> const right) {
+    for (std::size_t i = 0; i < left.size(); i++) {
+        double const position = start + step * static_cast<double>(i);
+        auto const index = static_cast<std::size_t>(position);
+        auto const fraction = static_cast<float>(position - static_cast<double>(index));
+        float const* frame = samples + index * channels;
+        left[i] = frame[0] + (frame[channels] - frame[0]) * fraction;
+        if constexpr (stereo) {
+            right[i] = frame[1] + (frame[channels + 1] - frame[1]) * fraction;
+        }
+    }
+}
+} // namespace
+
+Mixer::Mixer(std::size_t const voiceCount)
+    : voices(voiceCount),
+      mixLeft(blockFrames),
+      mixRight(blockFrames),
+      sourceLeft(blockFrames),
+      sourceRight(blockFrames),
+      streamSamples(blockFrames * outputChannels) {}
+
+//------------------------------------------
+// Voices
+
+std::optional<VoiceId> Mixer::play(std::shared_ptr<Sound const> sound, VoiceParams const& params) {
+    if (sound == nullptr || sound->channels == 0) {
+        return std::nullopt;
+    }
+    std::scoped_lock const lock(mutex);
+    auto const index = acquire(params.priority);
+    if (!index.has_value()) {
+        return std::nullopt;
+    }
+    voices[*index].sound = std::move(sound);
+    return start(*index, params);
+}
+
+std::optional<VoiceId> Mixer::play(std::shared_ptr<Stream> stream, VoiceParams const& params) {
+    if (stream == nullptr) {
+        return std::nullopt;
+    }
+    std::scoped_lock const lock(mutex);
+    auto const index = acquire(params.priority);
+    if (!index.has_value()) {
+        return std::nullopt;
+    }
+    voices[*index].stream = std::move(stream);
+    return start(*index, params);
+}
+
+bool Mixer::update(VoiceId const id, VoiceParams const& params) {
+    std::scoped_lock const lock(mutex);
+    auto* voice = find(id);
+    if (voice == nullptr) {
+        return false;
+    }
+    voice->params = params;
+    return true;
+}
+
+void Mixer::stop(VoiceId const id) {
+    std::scoped_lock const lock(mutex);
+    if (auto* voice = find(id); voice != nullptr) {
+        voice->stopping = true;
+    }
+}
+
+void Mixer::stopAll() {
+    std::scoped_lock const lock(mutex);
+    for (auto& voice : voices) {
+        voice.stopping = voice.active;
+    }
+}
+
+bool Mixer::isPlaying(VoiceId const id) const {
+    std::scoped_lock const lock(mutex);
+    return find(id) != nullptr;
+}
+
+void Mixer::setMasterGain(float const gain) {
+    std::scoped_lock const lock(mutex);
+    masterGain = gain;
+}
+
+Mixer::Stats Mixer::getStats() const {
+    std::scoped_lock const lock(mutex);
+    Stats result = stats;
+    result.active = static_cast<std::size_t>(std::ranges::count_if(voices, [](Voice const& voice) { return voice.active; }));
+    return result;
+}
+
+//------------------------------------------
+// Mixing
+
+void Mixer::mix(std::span<float> const output) {
+    std::scoped_lock const lock(mutex);
+    auto const frames = output.size() / outputChannels;
+    for (std::size_t done = 0; done < frames; done += blockFrames) {
+        auto const count = std::min(blockFrames, frames - done);
+        mixBlock(count);
+
+        // Interleave and clamp, so overlapping voices clip instead of wrapping around in integer formats downstream
+        auto const block = output.subspan(done * outputChannels, count * outputChannels);
+        for (std::size_t i = 0; i < count; i++) {
+            block[i * outputChannels] = std::clamp(mixLeft[i], -1.0f, 1.0f);
+            block[i * outputChannels + 1] = std::clamp(mixRight[i], -1.0f, 1.0f);
+        }
+    }
+    std::fill(output.begin() + static_cast<std::ptrdiff_t>(frames * outputChannels), output.end(), 0.0f);
+}
+
+//------------------------------------------
+// Private methods
+
+std::optional<std::size_t> Mixer::acquire(int const priority) {
+    if (auto const it = std::ranges::find_if(voices, [](Voice const& voice) { return !voice.active; }); it != voices.end()) {
+        return static_cast<std::size_t>(it - voices.begin());
+    }
+
+    // Steal a voice that is fading out anyway, otherwise the lowest priority and oldest one
+    auto const victim = std::ranges::min_element(voices, [](Voice const& a, Voice const& b) {
+        if (a.stopping != b.stopping) return a.stopping;
+        if (a.params.priority != b.params.priority) return a.params.priority < b.params.priority;
+        return a.started < b.started;
+    });
+    if (victim == voices.end() || (!victim->stopping && victim->params.priority > priority)) {
+        stats.dropped++;
+        return std::nullopt;
+    }
+    stats.stolen += victim->stopping ? 0 : 1;
+    release(*victim);
+    return static_cast<std::size_t>(victim - voices.begin());
+}
+
+VoiceId Mixer::start(std::size_t const index, VoiceParams const& params) {
+    auto& voice = voices[index];
+    voice.params = params;
+    voice.position = 0.0;
+    voice.started = startCounter++;
+    voice.active = true;
+    voice.stopping = false;
+    voice.drained = false;
+
+    // No ramp on the first block, so attacks stay sharp
+    std::tie(voice.gainLeft, voice.gainRight) = targetGains(voice);
+
+    stats.played++;
+    return {static_cast<std::uint32_t>(index), voice.generation};
+}
+
+void Mixer::release(Voice& voice) {
+    voice.sound.reset();
+    voice.stream.reset();
+    voice.active = false;
+    voice.generation++;
+}
+
+Mixer::Voice* Mixer::find(VoiceId const id) {
+    if (id.index >= voices.size()) {
+        return nullptr;
+    }
+    auto& voice = voices[id.index];
+    return voice.active && !voice.stopping && voice.generation == id.generation ? &voice : nullptr;
+}
+
+Mixer::Voice const* Mixer::find(VoiceId const id) const {
+    return const_cast<Mixer*>(this)->find(id); // NOLINT
+}
+
+std::pair<float, float> Mixer::targetGains(Voice const& voice) const {
+    float const gain = voice.params.gain * masterGain;
+    float const pan = std::clamp(voice.params.pan, -1.0f, 1.0f);
+    auto const channels = voice.sound != nullptr ? voice.sound->channels : voice.stream->getChannels();
+    if (channels > 1) {
+        // Balance: keep both channels at full gain in the center, attenuate the opposite side
+        return {gain * std::min(1.0f, 1.0f - pan), gain * std::min(1.0f, 1.0f + pan)};
+    }
+    // Equal power: constant loudness while panning a mono source
+    float const angle = (pan + 1.0f) * std::numbers::pi_v<float> / 4.0f;
+    return {gain * std::cos(angle), gain * std::sin(angle)};
+}
+
+void Mixer::mixBlock(std::size_t const frames) {
+    std::span const left(mixLeft.data(), frames);
+    std::span const right(mixRight.data(), frames);
+    std::ranges::fill(left, 0.0f);
+    std::ranges::fill(right, 0.0f);
+
+    float const rampStep = 1.0f / static_cast<float>(frames);
+    for (auto& voice : voices) {
+        if (!voice.active) {
+            continue;
+        }
+        bool const stereo = voice.sound != nullptr ? renderSound(voice, frames) : renderStream(voice, frames);
+
+        auto const [targetLeft, targetRight] = voice.stopping ? std::pair{0.0f, 0.0f} : targetGains(voice);
+        std::span<float const> const sourceL(sourceLeft.data(), frames);
+        std::span<float const> const sourceR(stereo ? sourceRight.data() : sourceLeft.data(), frames);
+        accumulate(left, sourceL, voice.gainLeft, (targetLeft - voice.gainLeft) * rampStep);
+        accumulate(right, sourceR, voice.gainRight, (targetRight - voice.gainRight) * rampStep);
+        voice.gainLeft = targetLeft;
+        voice.gainRight = targetRight;
+
+        if (voice.stopping || voice.drained) {
+            release(voice);
+        }
+    }
+}
+
+bool Mixer::renderSound(Voice& voice, std::size_t const frames) {
+    auto const& sound = *voice.sound;
+    auto const length = sound.frames();
+    auto const channels = sound.channels;
+    bool const stereo = channels > 1;
+    float const* samples = sound.samples.data();
+    double const pitch = std::max(static_cast<double>(voice.params.pitch), 1.0 / 64.0);
+
+    std::size_t i = 0;
+    while (i < frames) {
+        if (voice.position >= static_cast<double>(length)) {
+            if (!voice.params.loop || length == 0) {
+                voice.drained = true;
+                break;
+            }
+            voice.position = std::fmod(voice.position, static_cast<double>(length));
+        }
+
+        auto const frame = static_cast<std::size_t>(voice.position);
+        if (voice.params.pitch == 1.0f && static_cast<double>(frame) == voice.position) { // NOLINT
+            // Native speed on whole frames: a plain copy
+            auto const count = std::min(frames - i, length - frame);
+            if (stereo) {
+                deinterleave(samples + frame * channels, channels, std::span(sourceLeft).subspan(i, count), std::span(sourceRight).subspan(i, count));
+            } else {
+                std::copy_n(samples + frame, count, sourceLeft.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+            i += count;
+            voice.position += static_cast<double>(count);
+            continue;
+        }
+
+        // Linear interpolation, without bounds handling while the next frame is within the sound:
+        // all positions stay strictly below the last frame, which the step below handles
+        auto const last = static_cast<double>(length - 1);
+        auto const base = voice.position;
+        auto count = base < last ? std::min(frames - i, static_cast<std::size_t>(std::ceil((last - base) / pitch))) : 0;
+        while (count > 0 && base + pitch * static_cast<double>(count - 1) >= last) {
+            count--; // Rounding of the division may land the final position on the last frame
+        }
+        if (stereo) {
+            interpolate<true>(samples, channels, base, pitch, std::span(sourceLeft).subspan(i, count), std::span(sourceRight).subspan(i, count));
+        } else {
+            interpolate<false>(samples, channels, base, pitch, std::span(sourceLeft).subspan(i, count), {});
+        }
+        i += count;
+        voice.position = base + pitch * static_cast<double>(count);
+
+        // From the last frame, interpolate towards the start for loops and hold otherwise
+        if (i < frames && voice.position < static_cast<double>(length)) {
+            auto const index = static_cast<std::size_t>(voice.position);
+            auto const fraction = static_cast<float>(voice.position - static_cast<double>(index));
+            auto const next = index + 1 < length ? index + 1 : voice.params.loop ? 0 : index;
+            sourceLeft[i] = samples[index * channels] + (samples[next * channels] - samples[index * channels]) * fraction;
+            if (stereo) {
+                sourceRight[i] = samples[index * channels + 1] + (samples[next * channels + 1] - samples[index * channels + 1]) * fraction;
+            }
+            voice.position += pitch;
+            i++;
+        }
+    }
+
+    std::fill(sourceLeft.begin() + static_cast<std::ptrdiff_t>(i), sourceLeft.begin() + static_cast<std::ptrdiff_t>(frames), 0.0f);
+    if (stereo) {
+        std::fill(sourceRight.begin() + static_cast<std::ptrdiff_t>(i), sourceRight.begin() + static_cast<std::ptrdiff_t>(frames), 0.0f);
+    }
+    return stereo;
+}
+
+bool Mixer::renderStream(Voice& voice, std::size_t const frames) {
+    auto& stream = *voice.stream;
+    auto const channels = stream.getChannels();
+    bool const stereo = channels > 1;
+    if (streamSamples.size() < frames * channels) {
+        streamSamples.resize(blockFrames * channels);
+    }
+
+    auto const read = stream.read(std::span(streamSamples).first(frames * channels)) / channels;
+    if (stereo) {
+        deinterleave(streamSamples.data(), channels, std::span(sourceLeft).first(read), std::span(sourceRight).first(read));
+        std::fill(sourceRight.begin() + static_cast<std::ptrdiff_t>(read), sourceRight.begin() + static_cast<std::ptrdiff_t>(frames), 0.0f);
+    } else {
+        std::copy_n(streamSamples.begin(), read, sourceLeft.begin());
+    }
+    std::fill(sourceLeft.begin() + static_cast<std::ptrdiff_t>(read), sourceLeft.begin() + static_cast<std::ptrdiff_t>(frames), 0.0f);
+
+    if (read < frames) {
+        if (stream.finished()) {
+            voice.drained = true;
+        } else {
+            stats.underruns++;
+        }
+    }
+    return stereo;
+}
+
+} // namespace Nebulite::Audio
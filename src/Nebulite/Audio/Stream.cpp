@@ -0,0 +1,65 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <span>
+
+// Nebulite
+#include "Nebulite/Audio/Stream.hpp"
+
+//------------------------------------------
+namespace Nebulite::Audio {
+
+Stream::Stream(std::size_t const channels, std::size_t const capacityFrames)
+    : channels(std::max<std::size_t>(channels, 1)),
+      buffer(std::max<std::size_t>(capacityFrames, 1) * this->channels) {}
+
+//------------------------------------------
+// Producer
+
+std::size_t Stream::write(std::span<float const> const samples) {
+    auto const h = head.load(std::memory_order_relaxed);
+    auto const free = buffer.size() - (h - tail.load(std::memory_order_acquire));
+    auto const count = std::min(free, samples.size()) / channels * channels;
+
+    // At most two contiguous segments, as the ring wraps around once
+    auto const offset = h % buffer.size();
+    auto const first = std::min(count, buffer.size() - offset);
+    std::copy_n(samples.begin(), first, buffer.begin() + static_cast<std::ptrdiff_t>(offset));
+    std::copy_n(samples.begin() + static_cast<std::ptrdiff_t>(first), count - first, buffer.begin());
+
+    head.store(h + count, std::memory_order_release);
+    return count;
+}
+
+std::size_t Stream::writable() const noexcept {
+    auto const used = head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire);
+    return (buffer.size() - used) / channels * channels;
+}
+
+//------------------------------------------
+// Consumer
+
+std::size_t Stream::read(std::span<float> const samples) {
+    auto const t = tail.load(std::memory_order_relaxed);
+    auto const available = head.load(std::memory_order_acquire) - t;
+    auto const count = std::min(available, samples.size()) / channels * channels;
+
+    auto const offset = t % buffer.size();
+    auto const first = std::min(count, buffer.size() - offset);
+    std::copy_n(buffer.begin() + static_cast<std::ptrdiff_t>(offset), first, samples.begin());
+    std::copy_n(buffer.begin(), count - first, samples.begin() + static_cast<std::ptrdiff_t>(first));
+
+    tail.store(t + count, std::memory_order_release);
+    return count;
+}
+
+bool Stream::finished() const noexcept {
+    // Check the end marker first, so samples written right before finishing are not missed
+    return ended.load(std::memory_order_acquire) && head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+}
+
+} // namespace Nebulite::Audio
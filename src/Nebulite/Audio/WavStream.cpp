@@ -0,0 +1,236 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+// External
+#include <SDL3/SDL_audio.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_iostream.h>
+
+// Nebulite
+#include "Nebulite/Audio/Stream.hpp"
+#include "Nebulite/Audio/WavStream.hpp"
+
+//------------------------------------------
+namespace Nebulite::Audio {
+
+namespace {
+std::uint16_t readU16(std::uint8_t const* bytes) {
+    return static_cast<std::uint16_t>(bytes[0] | bytes[1] << 8);
+}
+
+std::uint32_t readU32(std::uint8_t const* bytes) {
+    return static_cast<std::uint32_t>(bytes[0]) | static_cast<std::uint32_t>(bytes[1]) << 8 | static_cast<std::uint32_t>(bytes[2]) << 16 | static_cast<std::uint32_t>(bytes[3]) << 24;
+}
+
+/**
+ * @brief Maps a WAV format tag and sample size to an SDL audio format.
+ */
+SDL_AudioFormat formatOf(std::uint16_t const tag, std::uint16_t const bits) {
+    static std::uint16_t constexpr pcm = 0x0001;
+    static std::uint16_t constexpr ieeeFloat = 0x0003;
+    if (tag == pcm) {
+        switch (bits) {
+        case 8: return SDL_AUDIO_U8;
+        case 16: return SDL_AUDIO_S16LE;
+        case 32: return SDL_AUDIO_S32LE;
+        default: return SDL_AUDIO_UNKNOWN;
+        }
+    }
+    if (tag == ieeeFloat && bits == 32) {
+        return SDL_AUDIO_F32LE;
+    }
+    return SDL_AUDIO_UNKNOWN;
+}
+
+/**
+ * @struct Header
+ * @brief Format and data section of a WAV file.
+ */
+struct Header {
+    SDL_AudioSpec spec;
+    std::int64_t dataStart;
+    std::uint64_t dataSize;
+};
+
+/**
+ * @brief Reads the chunks of a WAV file up to the start of its data section.
+ * @return The header, or std::nullopt with the reason set through SDL_SetError.
+ */
+std::optional<Header> readHeader(SDL_IOStream* io) {
+    std::array<std::uint8_t, 12> riff{};
+    if (SDL_ReadIO(io, riff.data(), riff.size()) != riff.size() || std::memcmp(riff.data(), "RIFF", 4) != 0 || std::memcmp(riff.data() + 8, "WAVE", 4) != 0) {
+        SDL_SetError("Not a RIFF WAVE file");
+        return std::nullopt;
+    }
+
+    std::optional<SDL_AudioSpec> spec;
+    while (true) {
+        std::array<std::uint8_t, 8> chunk{};
+        if (SDL_ReadIO(io, chunk.data(), chunk.size()) != chunk.size()) {
+            SDL_SetError("WAV file has no data chunk");
+            return std::nullopt;
+        }
+        auto const size = readU32(chunk.data() + 4);
+
+        if (std::memcmp(chunk.data(), "data", 4) == 0) {
+            if (!spec.has_value()) {
+                SDL_SetError("WAV data chunk precedes its fmt chunk");
+                return std::nullopt;
+            }
+            auto const dataStart = SDL_TellIO(io);
+            auto const fileSize = SDL_GetIOSize(io);
+            std::uint64_t dataSize = size;
+            if (fileSize >= dataStart) {
+                // Streamed recordings may leave the size unset or too large
+                dataSize = std::min(dataSize, static_cast<std::uint64_t>(fileSize - dataStart));
+            }
+            auto const frameBytes = static_cast<std::uint64_t>(SDL_AUDIO_FRAMESIZE(*spec));
+            return Header{*spec, dataStart, dataSize / frameBytes * frameBytes};
+        }
+
+        if (std::memcmp(chunk.data(), "fmt ", 4) == 0) {
+            static std::uint32_t constexpr minimumSize = 16;
+            static std::uint16_t constexpr extensible = 0xFFFE;
+            if (size < minimumSize) {
+                SDL_SetError("WAV fmt chunk is too small");
+                return std::nullopt;
+            }
+            std::vector<std::uint8_t> fmt(size);
+            if (SDL_ReadIO(io, fmt.data(), fmt.size()) != fmt.size()) {
+                SDL_SetError("WAV fmt chunk is truncated");
+                return std::nullopt;
+            }
+            auto tag = readU16(fmt.data());
+            auto const channels = readU16(fmt.data() + 2);
+            auto const rate = readU32(fmt.data() + 4);
+            auto const bits = readU16(fmt.data() + 14);
+            if (tag == extensible && size >= 26) {
+                tag = readU16(fmt.data() + 24); // The sub format GUID starts with the actual tag
+            }
+            auto const format = formatOf(tag, bits);
+            if (format == SDL_AUDIO_UNKNOWN || channels == 0 || rate == 0) {
+                SDL_SetError("Unsupported WAV format %u with %u bits per sample", static_cast<unsigned>(tag), static_cast<unsigned>(bits));
+                return std::nullopt;
+            }
+            spec = SDL_AudioSpec{format, static_cast<int>(channels), static_cast<int>(rate)};
+            if (size % 2 != 0 && SDL_SeekIO(io, 1, SDL_IO_SEEK_CUR) < 0) {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        // Skip unknown chunks, which are padded to an even size
+        if (SDL_SeekIO(io, static_cast<Sint64>(size) + size % 2, SDL_IO_SEEK_CUR) < 0) {
+            return std::nullopt;
+        }
+    }
+}
+} // namespace
+
+std::unique_ptr<WavStream> WavStream::open(std::string const& path, int const sampleRate, std::size_t const bufferFrames, bool const loop) {
+    SDL_IOStream* io = SDL_IOFromFile(path.c_str(), "rb");
+    if (io == nullptr) {
+        return nullptr;
+    }
+    auto const header = readHeader(io);
+    if (!header.has_value()) {
+        SDL_CloseIO(io);
+        return nullptr;
+    }
+
+    // The mixer plays mono or stereo, SDL downmixes anything wider
+    SDL_AudioSpec const output{SDL_AUDIO_F32, std::min(header->spec.channels, 2), sampleRate};
+    SDL_AudioStream* converter = SDL_CreateAudioStream(&header->spec, &output);
+    if (converter == nullptr) {
+        SDL_CloseIO(io);
+        return nullptr;
+    }
+    auto const channels = static_cast<std::size_t>(output.channels);
+    auto const frameBytes = static_cast<std::size_t>(SDL_AUDIO_FRAMESIZE(header->spec));
+    return std::unique_ptr<WavStream>(new WavStream(io, converter, channels, bufferFrames, frameBytes, header->dataStart, header->dataSize, loop));
+}
+
+WavStream::WavStream(SDL_IOStream* io, SDL_AudioStream* converter, std::size_t const channels, std::size_t const bufferFrames, std::size_t const frameBytes, std::int64_t const dataStart, std::uint64_t const dataSize, bool const loop)
+    : io(io),
+      converter(converter),
+      stream(std::make_shared<Stream>(channels, bufferFrames)),
+      frameBytes(frameBytes),
+      dataStart(dataStart),
+      dataSize(dataSize),
+      remaining(dataSize),
+      loop(loop),
+      raw(std::max(chunkBytes / frameBytes, std::size_t{1}) * frameBytes),
+      converted(std::max(chunkBytes / sizeof(float) / channels, std::size_t{1}) * channels) {}
+
+WavStream::~WavStream() {
+    SDL_DestroyAudioStream(converter);
+    SDL_CloseIO(io);
+}
+
+void WavStream::pump() {
+    while (!ended) {
+        auto const writable = std::min(stream->writable(), converted.size());
+        if (writable == 0) {
+            return;
+        }
+        // The converter only hands out whole frames, which always fit into the stream
+        int const bytes = SDL_GetAudioStreamData(converter, converted.data(), static_cast<int>(writable * sizeof(float)));
+        if (bytes < 0) {
+            end();
+        } else if (bytes > 0) {
+            stream->write(std::span(converted).first(static_cast<std::size_t>(bytes) / sizeof(float)));
+        } else if (!feed()) {
+            end();
+        }
+    }
+}
+
+//------------------------------------------
+// Private methods
+
+bool WavStream::feed() {
+    if (remaining == 0) {
+        if (loop && dataSize > 0) {
+            // Keep the converter running, so the loop point has no gap
+            if (SDL_SeekIO(io, dataStart, SDL_IO_SEEK_SET) < 0) {
+                return false;
+            }
+            remaining = dataSize;
+        } else if (!flushed) {
+            flushed = true;
+            return SDL_FlushAudioStream(converter);
+        } else {
+            return false;
+        }
+    }
+
+    auto const count = static_cast<std::size_t>(std::min<std::uint64_t>(remaining, raw.size()));
+    auto const read = SDL_ReadIO(io, raw.data(), count) / frameBytes * frameBytes;
+    if (read == 0) {
+        // Truncated file: play what was decoded, without looping over a broken data section
+        remaining = 0;
+        loop = false;
+        return feed();
+    }
+    remaining -= read;
+    return SDL_PutAudioStreamData(converter, raw.data(), static_cast<int>(read));
+}
+
+void WavStream::end() {
+    ended = true;
+    stream->finish();
+}
+
+} // namespace Nebulite::Audio
@@ -111,6 +111,14 @@ void Environment::updateObjects(std::vector<Data::TileCoordinate> const& tiles,
     }
 }
 
+void Environment::updateSelectedObjects(Data::RenderObjectContainer::TileSelection const& selection, Data::TilingInformation const& tilingInformation, Data::RendererProcessor& rendererProcessor) {
+    // Same layers as updateObjects
+    for (unsigned int i = 1; i < allLayers.size(); i++) {
+        rendererProcessor.prepareForNewLayer(&roc[i]);
+        roc[i].updateSelection(selection, tilingInformation, rendererProcessor);
+    }
+}
+
 void Environment::reinsertAllObjects(Data::TilingInformation const& tilingInformation) {
     for (unsigned int i = 0; i < allLayers.size(); i++) {
         roc[i].reinsertAllObjects(tilingInformation);
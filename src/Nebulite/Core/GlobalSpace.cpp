@@ -214,6 +214,10 @@ void GlobalSpace::listen(std::shared_ptr<Interaction::Rules::Listener> const& li
     invoke.listen(listener);
 }
 
+void GlobalSpace::subscribe(std::shared_ptr<Interaction::Rules::Listener> const& listener) {
+    invoke.subscribe(listener);
+}
+
 //------------------------------------------
 // Getters
 
@@ -4,10 +4,12 @@
 // Standard library
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint> // NOLINT
 #include <memory>
-#include <ranges>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 // Nebulite
@@ -15,9 +17,13 @@
 #include "Nebulite/Constants/KeyNames.hpp"
 #include "Nebulite/Core/GlobalSpace.hpp"
 #include "Nebulite/Core/RenderObject.hpp"
+#include "Nebulite/Core/Renderer.hpp"
+#include "Nebulite/Data/ComponentPool.hpp"
 #include "Nebulite/Data/Document/JsonScope.hpp"
+#include "Nebulite/Data/SlabPool.hpp"
 #include "Nebulite/Graphics/Drawcall.hpp"
 #include "Nebulite/Interaction/Rules/Ruleset.hpp"
+#include "Nebulite/Module/Domain/GlobalSpace/Settings.hpp"
 #include "Nebulite/Module/Domain/Initializer.hpp"
 #include "Nebulite/Nebulite.hpp"
 #include "Nebulite/Utility/Io/Capture.hpp"
@@ -56,6 +62,10 @@ void setStandardValues(Data::JsonScope& document) {
 
 RenderObject::RenderObject(Utility::Io::Capture& parentCapture)
     : Domain("RenderObject", parentCapture){
+    //------------------------------------------
+    // Place hot values in the component pool before anything links to them
+    acquireComponentSlot();
+
     //------------------------------------------
     // Set standard values
     setStandardValues(domainScope);
@@ -69,6 +79,45 @@ RenderObject::RenderObject(Utility::Io::Capture& parentCapture)
     init();
 }
 
+RenderObject::RenderObject(Utility::Io::Capture& parentCapture, std::string const& serialOrLink)
+    : Domain("RenderObject", parentCapture){
+    //------------------------------------------
+    // Place hot values in the component pool before anything links to them
+    acquireComponentSlot();
+
+    //------------------------------------------
+    // Load the document, no modules are required for this
+    auto const commands = deserializeDocument(serialOrLink);
+
+    //------------------------------------------
+    // Flags
+    flag.deleteFromScene = false;
+
+    //------------------------------------------
+    // Initialize Linkages, References and DomainModules
+    linkFrequentRefs();
+    Module::Domain::Initializer::initRenderObject(this);
+
+    //------------------------------------------
+    // Apply commands, then initialize everything once
+    applyDeserializeCommands(commands);
+    linkFrequentRefs();
+    reinitModules();
+    initDrawcalls();
+
+    //------------------------------------------
+    // Update once to initialize
+    Global::instance().notifyEvent(update());
+}
+
+void* RenderObject::operator new(std::size_t const size) {
+    return Data::SlabPool::allocate<RenderObject>(size);
+}
+
+void RenderObject::operator delete(void* ptr, std::size_t const size) noexcept {
+    Data::SlabPool::deallocate<RenderObject>(ptr, size);
+}
+
 void RenderObject::init() {
     // Inherit functions from child objects
     // None so far
@@ -86,18 +135,30 @@ void RenderObject::init() {
     Global::instance().notifyEvent(update());
 }
 
-RenderObject::~RenderObject() = default;
+RenderObject::~RenderObject() {
+    if (componentSlot.pool != nullptr) {
+        componentSlot.pool->release(componentSlot.index);
+    }
+}
+
+void RenderObject::acquireComponentSlot() {
+    using SettingsKey = Module::Domain::GlobalSpace::Settings::Key;
+    if (!Global::settings().get<bool>(SettingsKey::componentPool).value_or(false)) {
+        return;
+    }
+    componentSlot.pool = &Global::instance().getRenderer().getComponentPool();
+    componentSlot.index = componentSlot.pool->acquire();
+    componentSlot.pool->bind(domainScope, componentSlot.index);
+}
 
 //------------------------------------------
 // Drawcalls
 
 void RenderObject::draw(Renderer const& renderer, float const& offsetX, float const& offsetY) {
-    for (auto const& member : drawcallOrder) {
-        drawcalls[member]->draw(
-            renderer,
-            static_cast<float>(*refs.posX) - offsetX,
-            static_cast<float>(*refs.posY) - offsetY
-        );
+    auto const x = static_cast<float>(*refs.posX) - offsetX;
+    auto const y = static_cast<float>(*refs.posY) - offsetY;
+    for (auto const& entry : drawcalls) {
+        entry.drawcall->draw(renderer, x, y);
     }
 }
 
@@ -108,40 +169,56 @@ void RenderObject::reinitDrawcalls() {
     // Get list of drawcalls from document
     for (auto const& [member, key] : domainScope.listAvailableMembersAndKeys(Constants::KeyNames::RenderObject::draw)) {
         // Initialize drawcall with its own scope
-        drawcalls[member] = std::make_unique<Graphics::Drawcall>(domainScope.shareScope(key.view()), capture);
+        drawcalls.push_back({.name = member, .drawcall = std::make_unique<Graphics::Drawcall>(domainScope.shareScope(key.view()), capture)});
     }
     sortDrawcalls();
 }
 
 void RenderObject::initDrawcalls() {
-    // Get list of drawcalls from document
+    // Rebuild from the document: keep known drawcalls, initialize unknown ones, drop removed ones
+    std::vector<DrawcallEntry> updated;
     for (auto const& [member, key] : domainScope.listAvailableMembersAndKeys(Constants::KeyNames::RenderObject::draw)) {
-        // Initialize drawcall with its own scope
-        if (drawcalls.find(member) == drawcalls.end()) {
-            drawcalls[member] = std::make_unique<Graphics::Drawcall>(domainScope.shareScope(key.view()), capture);
+        if (auto const it = findDrawcall(member); it != drawcalls.end()) {
+            // Keep the name in place, so drawcalls stays sorted for further lookups
+            updated.push_back({.name = member, .drawcall = std::move(it->drawcall)});
+        }
+        else {
+            // Initialize drawcall with its own scope
+            updated.push_back({.name = member, .drawcall = std::make_unique<Graphics::Drawcall>(domainScope.shareScope(key.view()), capture)});
         }
     }
+    drawcalls = std::move(updated);
     sortDrawcalls();
 }
 
 void RenderObject::reInitDrawcall(std::string const& drawcallName) {
     // Reinitialize a specific drawcall from document
     auto const key = Constants::KeyNames::RenderObject::draw.addMember(drawcallName);
-    drawcalls[drawcallName] = std::make_unique<Graphics::Drawcall>(domainScope.shareScope(key.view()), capture);
+    auto drawcall = std::make_unique<Graphics::Drawcall>(domainScope.shareScope(key.view()), capture);
+    if (auto const it = findDrawcall(drawcallName); it != drawcalls.end()) {
+        it->drawcall = std::move(drawcall);
+        return;
+    }
+    drawcalls.push_back({.name = drawcallName, .drawcall = std::move(drawcall)});
+    sortDrawcalls();
 }
 
 void RenderObject::sortDrawcalls() {
-    // re-generate drawcall order (alphabetical for now)
-    drawcallOrder.clear();
-    for (auto const& [member, _] : domainScope.listAvailableMembersAndKeys(Constants::KeyNames::RenderObject::draw)) {
-        drawcallOrder.push_back(member);
+    // Draw order is alphabetical for now
+    std::ranges::sort(drawcalls, {}, &DrawcallEntry::name);
+}
+
+std::vector<RenderObject::DrawcallEntry>::iterator RenderObject::findDrawcall(std::string_view const drawcallName) {
+    auto const it = std::ranges::lower_bound(drawcalls, drawcallName, {}, [](DrawcallEntry const& entry) -> std::string_view { return entry.name; });
+    if (it != drawcalls.end() && it->name == drawcallName) {
+        return it;
     }
-    std::ranges::sort(drawcallOrder.begin(), drawcallOrder.end());
+    return drawcalls.end();
 }
 
 void RenderObject::updateDrawcalls() {
-    for (auto const& member : drawcallOrder) {
-        drawcalls[member]->update();
+    for (auto const& entry : drawcalls) {
+        entry.drawcall->update();
     }
 }
 
@@ -150,7 +227,7 @@ Constants::Event RenderObject::parseDrawcallCommand(std::string_view const drawC
         capture.error.println("Drawcall name is empty. Cannot parse command.");
         return Constants::Event::error;
     }
-    auto const drawcallIt = drawcalls.find(std::string(drawCallName));
+    auto const drawcallIt = findDrawcall(drawCallName);
     if (drawcallIt == drawcalls.end()) {
         capture.warning.println(
             "Drawcall '",
@@ -158,7 +235,7 @@ Constants::Event RenderObject::parseDrawcallCommand(std::string_view const drawC
             "' not found in RenderObject. Available drawcalls: ",
             [&]{
                 std::string result;
-                for (auto const& member: drawcalls | std::views::keys) {
+                for (auto const& member: listDrawcalls()) {
                     result += member + " ";
                 }
                 return result;
@@ -166,7 +243,7 @@ Constants::Event RenderObject::parseDrawcallCommand(std::string_view const drawC
         );
         return Constants::Event::warning;
     }
-    return drawcallIt->second->parseStr(args, ctx, ctxScope);
+    return drawcallIt->drawcall->parseStr(args, ctx, ctxScope);
 }
 
 //------------------------------------------
@@ -4,6 +4,7 @@
 // Standard library
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -42,8 +43,10 @@
 #include "Nebulite/Data/Tiling.hpp"
 #include "Nebulite/Graphics/RmlInterface.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/Settings.hpp"
+#include "Nebulite/Module/Domain/GlobalSpace/Time.hpp"
 #include "Nebulite/Module/Domain/Initializer.hpp"
 #include "Nebulite/Nebulite.hpp"
+#include "Nebulite/ScopeAccessor.hpp"
 #include "Nebulite/Utility/Io/Capture.hpp"
 #include "Nebulite/Utility/Io/FileManagement.hpp"
 #include "Nebulite/Utility/TypeCheck.hpp"
@@ -363,29 +366,32 @@ void Renderer::setView(ViewSetting const view) noexcept {
     viewSetting = view;
 }
 
-std::vector<Data::TileCoordinate> Renderer::visibleTiles() const {
-    auto getTileCount = [&] -> std::pair<int, int> {
-        auto const w = domainScope.get<int16_t>(Constants::KeyNames::Renderer::dispResXLogical).value_or(0);
-        auto const h = domainScope.get<int16_t>(Constants::KeyNames::Renderer::dispResYLogical).value_or(0);
-
-        switch (viewSetting) {
-        case ViewSetting::high: return {
-            w / tilingInformation().w + 1,
-            h / tilingInformation().h + 1
-        };
-        case ViewSetting::low: return {
-            w/4 / tilingInformation().w + 1,
-            h/4 / tilingInformation().h + 1
-        };
-        case ViewSetting::lowest:
-            return {1,1};
-        default:
-            std::unreachable();
-        }
+std::pair<int, int> Renderer::visibleTileExtent() const {
+    auto const w = domainScope.get<int16_t>(Constants::KeyNames::Renderer::dispResXLogical).value_or(0);
+    auto const h = domainScope.get<int16_t>(Constants::KeyNames::Renderer::dispResYLogical).value_or(0);
+
+    switch (viewSetting) {
+    case ViewSetting::high: return {
+        w / tilingInformation().w + 1,
+        h / tilingInformation().h + 1
     };
+    case ViewSetting::low: return {
+        w/4 / tilingInformation().w + 1,
+        h/4 / tilingInformation().h + 1
+    };
+    case ViewSetting::lowest:
+        return {1,1};
+    default:
+        std::unreachable();
+    }
+}
 
-    auto [wCount, hCount] = getTileCount();
+std::vector<Data::TileCoordinate> Renderer::visibleTiles() const {
+    auto const [wCount, hCount] = visibleTileExtent();
+    return tilesAroundCamera(wCount, hCount);
+}
 
+std::vector<Data::TileCoordinate> Renderer::tilesAroundCamera(int const wCount, int const hCount) const {
     std::vector<Data::TileCoordinate> tiles;
     tiles.reserve(static_cast<size_t>(wCount)*static_cast<size_t>(hCount)*4u); // small fixed neighborhood
     for (auto const dX : std::views::iota(-wCount, wCount+1)) {
@@ -447,6 +453,8 @@ void Renderer::renderFps() const {
     );
 
     ImGui::Text("FPS: %04d", fps.real);
+    auto const& ui = Graphics::RmlInterface::instance().getUpdateStats();
+    ImGui::Text("UI: %.2f ms, %zu/%zu bindings evaluated, %zu updated", ui.milliseconds, ui.evaluated, ui.bindings, ui.changed);
     ImGui::End();
     ImGui::PopStyleVar(2); // pop ItemSpacing and WindowPadding
 }
@@ -535,11 +543,7 @@ Constants::Event Renderer::update() {
     if (!status.skipUpdate) { // Skip update if flagged
         // Update environment
         Global::instance().notifyEvent(env.update());
-        env.updateObjects(
-            visibleTiles(),
-            tilingInformation(),
-            Data::RendererProcessor::instance()
-        );
+        updateObjects();
     }
     if (SDL_GetError()[0] != '\0') {
         capture.error.println("SDL Error during rendering: ", SDL_GetError());
@@ -549,6 +553,80 @@ Constants::Event Renderer::update() {
     return Constants::Event::success;
 }
 
+void Renderer::updateObjects() {
+    using SettingsKey = Module::Domain::GlobalSpace::Settings::Key;
+    using TimeKey = Module::Domain::GlobalSpace::Time::Key;
+
+    auto const nearMargin = Global::settings().get<uint16_t>(SettingsKey::simulationNearMargin).value_or(0);
+    auto const distantRadius = Global::settings().get<uint16_t>(SettingsKey::simulationDistantRadius).value_or(0);
+    auto const distantInterval = std::min(
+        Global::settings().get<uint16_t>(SettingsKey::simulationDistantInterval).value_or(0),
+        SimulationSchedule::maxDistantInterval
+    );
+
+    // Remember the simulation delta time of this frame
+    auto& globalScope = Global::shareScope(ScopeAccessor::Full());
+    double const deltaTime = globalScope.get<double>(TimeKey::deltaTime).value_or(0.0);
+    simulationSchedule.deltaTimes[simulationSchedule.frame % SimulationSchedule::maxDistantInterval] = deltaTime;
+
+    //------------------------------------------
+    // Near tiles: visible tiles plus margin, every frame
+
+    auto [wCount, hCount] = visibleTileExtent();
+    wCount += nearMargin;
+    hCount += nearMargin;
+
+    auto const nearTiles = tilesAroundCamera(wCount, hCount);
+    env.updateObjects(nearTiles, tilingInformation(), Data::RendererProcessor::instance());
+    simulationInfo = SimulationInfo{.nearTiles = nearTiles.size()};
+
+    //------------------------------------------
+    // Distant tiles: every n-th frame with the accumulated delta time
+
+    if (distantInterval == 0) {
+        simulationSchedule.frame++;
+        return; // Distant tiles stay frozen
+    }
+
+    // Each distant tile was last updated distantInterval frames ago
+    // Unsigned wraparound of frame - i is fine, as 2^64 is a multiple of maxDistantInterval
+    double distantDeltaTime = 0.0;
+    for (std::uint64_t i = 0; i < distantInterval; i++) {
+        distantDeltaTime += simulationSchedule.deltaTimes[(simulationSchedule.frame - i) % SimulationSchedule::maxDistantInterval];
+    }
+
+    auto const isDueDistantTile = [&](Data::TileCoordinate const& pos) {
+        int const dX = std::abs(pos.x - cameraTilePosition.x);
+        int const dY = std::abs(pos.y - cameraTilePosition.y);
+        if (dX <= wCount && dY <= hCount) {
+            return false; // Near tile, already updated
+        }
+        if (distantRadius > 0 && std::max(dX, dY) > distantRadius) {
+            return false; // Out of simulation range
+        }
+        simulationInfo.distantTiles++;
+
+        // Neighboring tiles get different phases, spreading the cost evenly across frames
+        auto const phase = static_cast<std::uint64_t>(static_cast<uint16_t>(pos.x)) * 7u
+                         + static_cast<std::uint64_t>(static_cast<uint16_t>(pos.y)) * 3u;
+        if ((simulationSchedule.frame + phase) % distantInterval != 0) {
+            return false;
+        }
+        simulationInfo.distantTilesUpdated++;
+        return true;
+    };
+
+    // Objects read the simulation delta time from the global document, so it is swapped for the duration of the update
+    auto const deltaTimeMilliSeconds = globalScope.get<uint64_t>(TimeKey::timeDeltaTimeMilliSeconds).value_or(0);
+    globalScope.set<double>(TimeKey::deltaTime, distantDeltaTime);
+    globalScope.set<uint64_t>(TimeKey::timeDeltaTimeMilliSeconds, static_cast<uint64_t>(std::llround(distantDeltaTime * 1000.0)));
+    env.updateSelectedObjects(isDueDistantTile, tilingInformation(), Data::RendererProcessor::instance());
+    globalScope.set<double>(TimeKey::deltaTime, deltaTime);
+    globalScope.set<uint64_t>(TimeKey::timeDeltaTimeMilliSeconds, deltaTimeMilliSeconds);
+
+    simulationSchedule.frame++;
+}
+
 bool Renderer::timeToRender() {
     // Goal: dtProjected() == target
     // Issue: target might be fractional, dtProjected() is integer milliseconds
@@ -629,6 +707,8 @@ void Renderer::destroy() {
 
     // SDL cleanup
     if (status.sdlInitialized) {
+        // Textures of the cache belong to the renderer
+        textCache.clear();
         if (window) {
             SDL_DestroyWindow(window);
             window = nullptr;
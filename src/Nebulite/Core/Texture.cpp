@@ -80,8 +80,9 @@ void Texture::generateLocallyManagedTexture() {
     }
 
     // Get global texture
+    // Text drawcalls have no link, their linked texture is shared with the text cache instead
     std::string const& imageLink = domainScope.get<std::string>(Graphics::Drawcall::Key::SpriteSpecific::imageLocation).value_or("");
-    auto* const globalTexture = Global::instance().getRenderer().getTexture(imageLink);
+    auto* const globalTexture = imageLink.empty() && texture != nullptr && !textureStoredLocally ? texture : Global::instance().getRenderer().getTexture(imageLink);
     if (globalTexture == nullptr) {
         capture.error.println("Failed to find texture in global renderer for image link: ", imageLink);
         return; // Could not find the texture in the global renderer, cannot proceed
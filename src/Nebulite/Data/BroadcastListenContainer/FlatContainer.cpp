@@ -3,10 +3,13 @@
 
 // Standard library
 #include <cassert>
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint> // NOLINT
 #include <memory>
 #include <ranges>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,6 +18,9 @@
 #include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Core/GlobalSpace.hpp"
 #include "Nebulite/Data/BroadcastListenContainer/FlatContainer.hpp"
+#include "Nebulite/Data/BroadcastListenContainer/SpatialGrid.hpp"
+#include "Nebulite/Data/BroadcastListenContainer/SubscriptionRegistry.hpp"
+#include "Nebulite/Interaction/Rules/Broadphase.hpp"
 #include "Nebulite/Interaction/Rules/Listener.hpp"
 #include "Nebulite/Interaction/Rules/Ruleset.hpp"
 #include "Nebulite/Nebulite.hpp"
@@ -59,8 +65,8 @@ public:
         static auto threadSpreader = Utility::Coordination::IdGenerator::atomicIncrementIdGenerator();
         thread_local std::size_t const threadId = threadSpreader();
 
-        // Sanity check: cannot have more threads than workerCount
-        assert(threadId < Constants::ThreadSettings::getInvokeWorkerCount());
+        // Sanity check: cannot have more threads than the TaskScheduler workers plus the main thread
+        assert(threadId <= Constants::ThreadSettings::getInvokeWorkerCount());
 
 #ifdef NDEBUG
         if (threadId > maximum().get()) {
@@ -75,44 +81,42 @@ public:
 
 void FlatContainerBase::broadcast(std::shared_ptr<Interaction::Rules::Ruleset>&& entry) {
     thread_local auto threadId = ThreadIdGenerator::getThreadId();
-    assert(threadId < activeWorkerCount); // Too many threads trying to broadcast/listen, increase FlatContainerBase::activeWorkerCount
+    assert(threadId < activeWorkerCount); // Too many threads trying to broadcast, increase FlatContainerBase::activeWorkerCount
     broadcasters[threadId][entry->getTopic()].push_back(std::move(entry));
 }
 
-void FlatContainerBase::listen(std::shared_ptr<Interaction::Rules::Listener>&& listener) {
-    thread_local auto threadId = ThreadIdGenerator::getThreadId();
-    assert(threadId < activeWorkerCount); // Too many threads trying to broadcast/listen, increase FlatContainerBase::activeWorkerCount
-    listeners[threadId][listener->topic].push_back(std::move(listener));
-}
-
 namespace {
 /**
- * @brief Rotates a range by a given percentage.
- * @tparam R The type of the range to rotate. Must be a viewable range.
- * @param r The range to rotate.
+ * @brief Calculates the offset of a rotation by a given percentage.
+ * @param size The size of the range to rotate.
  * @param percent The percentage to rotate the range by. Should be in the range [0, 1), but can be any real number.
- * @return A new range that is the result of rotating the input range by the specified percentage.
+ * @return The offset in the range [0, size), 0 for empty ranges.
  */
-template <std::ranges::viewable_range R>
-auto rotate(R&& r, double percent) {
-    auto view = std::views::all(std::forward<R>(r));
-
-    auto size = std::ranges::size(view);
-
+std::size_t rotationOffset(std::size_t const size, double const percent) {
     if (size == 0) {
-        percent = 0.0;
+        return 0;
     }
 
     double normalized = std::fmod(percent, 1.0);
     if (normalized < 0)
         normalized += 1.0;
 
-    std::size_t const offset =
-        size == 0 ? 0 :
-        static_cast<std::size_t>(
-            std::floor(normalized * static_cast<double>(size))
-        ) % size;
+    return static_cast<std::size_t>(
+        std::floor(normalized * static_cast<double>(size))
+    ) % size;
+}
 
+/**
+ * @brief Rotates a range by a given percentage.
+ * @tparam R The type of the range to rotate. Must be a viewable range.
+ * @param r The range to rotate.
+ * @param percent The percentage to rotate the range by. Should be in the range [0, 1), but can be any real number.
+ * @return A new range that is the result of rotating the input range by the specified percentage.
+ */
+template <std::ranges::viewable_range R>
+auto rotate(R&& r, double const percent) {
+    auto view = std::views::all(std::forward<R>(r));
+    std::size_t const offset = rotationOffset(std::ranges::size(view), percent);
     return std::views::concat(
         view | std::views::drop(offset),
         view | std::views::take(offset)
@@ -120,30 +124,119 @@ auto rotate(R&& r, double percent) {
 }
 } // namespace
 
-void FlatContainerBase::processWithOffset() {
-    for (auto& listenerMap : rotate(listeners, settings.listenerOffset)) {
-        listenerMap.forall([&](std::string const& topic, auto& lv) {
-            // Build a flattened view of all rulesets for this topic
-            auto rulesets = rotate(broadcasters, settings.broadcasterOffset)
-                | std::views::transform([&](auto& broadcasterMap) -> auto& {
-                      return broadcasterMap[topic];
-                  })
-                | std::views::transform([&](auto& bv) {
-                      return rotate(bv, settings.bvOffset);
-                  })
-                | std::views::join;
-
-            // Apply all valid rulesets and clear listeners
-            for (auto& listener : rotate(lv, settings.lvOffset)) {
-                for (auto const& ruleset : rulesets) {
-                    if (ruleset->getId() == listener->domain.getId()) continue;
-                    if (ruleset->evaluateConditionGlobally(listener->domain, Global::instance())) {
-                        ruleset->applyListener(listener, Global::instance());
-                    }
-                }
+namespace {
+/**
+ * @brief Builds a bounding box from an ordered cache list of bounds.
+ * @param bounds The ordered cache list, indexable with Broadphase::Key.
+ * @param expansion The distance to expand the box by on each side.
+ * @return The bounding box.
+ */
+SpatialGrid::Aabb toAabb(double** bounds, double const expansion) {
+    using Key = Interaction::Rules::Broadphase::Key;
+    auto const val = [bounds](Key const k) { return *bounds[static_cast<std::uint8_t>(k)]; }; // NOLINT
+    double const x = val(Key::posX);
+    double const y = val(Key::posY);
+    double const w = val(Key::sizeX);
+    double const h = val(Key::sizeY);
+    return SpatialGrid::Aabb{
+        .minX = std::min(x, x + w) - expansion,
+        .minY = std::min(y, y + h) - expansion,
+        .maxX = std::max(x, x + w) + expansion,
+        .maxY = std::max(y, y + h) + expansion,
+    };
+}
+} // namespace
+
+FlatContainerBase::BroadphaseTopic* FlatContainerBase::prepareBroadphase(std::string const& topic) {
+    auto& broadphase = broadphaseTopics[topic];
+    if (!broadphase.prepared) {
+        broadphase.prepared = true;
+        for (auto& broadcasterMap : broadcasters) {
+            for (auto const& ruleset : broadcasterMap[topic]) {
+                if (!ruleset->usesBroadphase()) continue;
+                broadphase.grid.insert(toAabb(ruleset->getBounds(), ruleset->getInteractionRadius()));
+                broadphase.rulesets.push_back(ruleset.get());
             }
-            lv.clear();
-        });
+        }
+        broadphase.grid.build();
+    }
+    return broadphase.rulesets.empty() ? nullptr : &broadphase;
+}
+
+void FlatContainerBase::clearBroadphase() {
+    for (auto& broadphase : broadphaseTopics | std::views::values) {
+        broadphase.grid.clear();
+        broadphase.rulesets.clear();
+        broadphase.prepared = false;
+    }
+}
+
+void FlatContainerBase::invokePair(Interaction::Rules::Ruleset& ruleset, std::shared_ptr<Interaction::Rules::Listener> const& listener) {
+    if (ruleset.getId() == listener->domain.getId()) return;
+    if (ruleset.evaluateConditionGlobally(listener->domain, Global::instance())) {
+        ruleset.applyListener(listener, Global::instance());
+    }
+}
+
+void FlatContainerBase::invokeBatch(Interaction::Rules::Ruleset& ruleset, std::span<std::shared_ptr<Interaction::Rules::Listener> const> const listeners) {
+    if (listeners.empty()) return;
+    thread_local std::vector<bool> matches;
+    if (!ruleset.evaluateConditionBatch(listeners, Global::instance(), matches)) {
+        for (auto const& listener : listeners) {
+            invokePair(ruleset, listener);
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < listeners.size(); i++) {
+        if (!matches[i] || ruleset.getId() == listeners[i]->domain.getId()) continue;
+        ruleset.applyListener(listeners[i], Global::instance());
+    }
+}
+
+void FlatContainerBase::invokeBroadphase(BroadphaseTopic& broadphase, std::shared_ptr<Interaction::Rules::Listener> const& listener) {
+    double** bounds = listener->getBounds();
+    if (bounds == nullptr) {
+        // No bounding box available, listener is in range of everything
+        for (auto* ruleset : broadphase.rulesets) {
+            invokePair(*ruleset, listener);
+        }
+        return;
+    }
+    broadphase.grid.query(toAabb(bounds, 0.0), [&](std::size_t const idx) {
+        invokePair(*broadphase.rulesets[idx], listener);
+    });
+}
+
+void FlatContainerBase::processWithOffset(SubscriptionRegistry const& subscriptions) {
+    for (auto const& topic : rotate(subscriptions.getTopics(), settings.listenerOffset)) {
+        auto const lv = topic.activeListeners();
+        if (lv.empty()) continue;
+
+        // Build a flattened view of all rulesets for this topic
+        auto rulesets = rotate(broadcasters, settings.broadcasterOffset)
+            | std::views::transform([&](auto& broadcasterMap) -> auto& {
+                  return broadcasterMap[topic.name];
+              })
+            | std::views::transform([&](auto& bv) {
+                  return rotate(bv, settings.bvOffset);
+              })
+            | std::views::join;
+
+        // Rulesets with an interaction radius are only paired through the broad-phase
+        auto* broadphase = prepareBroadphase(topic.name);
+
+        // Apply all valid rulesets, each evaluated for all listeners at once, split at the rotation offset
+        std::size_t const offset = rotationOffset(lv.size(), settings.lvOffset);
+        for (auto const& ruleset : rulesets) {
+            if (broadphase != nullptr && ruleset->usesBroadphase()) continue;
+            invokeBatch(*ruleset, lv.subspan(offset));
+            invokeBatch(*ruleset, lv.first(offset));
+        }
+        if (broadphase != nullptr) {
+            for (auto const& listener : rotate(lv, settings.lvOffset)) {
+                invokeBroadphase(*broadphase, listener);
+            }
+        }
     }
 
     // Cleanup: Clear all broadcasters
@@ -152,27 +245,32 @@ void FlatContainerBase::processWithOffset() {
             bv.clear();
         });
     }
+    clearBroadphase();
 }
 
-void FlatContainerBase::processNoOffset(){
-    for (auto& listenerMap : listeners) {
-        listenerMap.forall([&](std::string const& topic, auto& lv) {
-            // Build a flattened view of all rulesets for this topic
-            auto rulesets = broadcasters
-                | std::views::transform([&](auto& broadcasterMap) -> auto& {return broadcasterMap[topic];})
-                | std::views::join;
-
-            // Apply all valid rulesets and clear listeners
-            for (auto& listener : lv) {
-                for (auto const& ruleset : rulesets) {
-                    if (ruleset->getId() == listener->domain.getId()) continue;
-                    if (ruleset->evaluateConditionGlobally(listener->domain, Global::instance())) {
-                        ruleset->applyListener(listener, Global::instance());
-                    }
-                }
+void FlatContainerBase::processNoOffset(SubscriptionRegistry const& subscriptions) {
+    for (auto const& topic : subscriptions.getTopics()) {
+        auto const lv = topic.activeListeners();
+        if (lv.empty()) continue;
+
+        // Build a flattened view of all rulesets for this topic
+        auto rulesets = broadcasters
+            | std::views::transform([&](auto& broadcasterMap) -> auto& {return broadcasterMap[topic.name];})
+            | std::views::join;
+
+        // Rulesets with an interaction radius are only paired through the broad-phase
+        auto* broadphase = prepareBroadphase(topic.name);
+
+        // Apply all valid rulesets, each evaluated for all listeners at once
+        for (auto const& ruleset : rulesets) {
+            if (broadphase != nullptr && ruleset->usesBroadphase()) continue;
+            invokeBatch(*ruleset, lv);
+        }
+        if (broadphase != nullptr) {
+            for (auto const& listener : lv) {
+                invokeBroadphase(*broadphase, listener);
             }
-            lv.clear();
-        });
+        }
     }
 
     // Cleanup: Clear all broadcasters
@@ -181,6 +279,7 @@ void FlatContainerBase::processNoOffset(){
             bv.clear();
         });
     }
+    clearBroadphase();
 }
 
 } // namespace Nebulite::Data::BroadcastListenContainer
@@ -0,0 +1,91 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <limits>
+#include <ranges>
+
+// Nebulite
+#include "Nebulite/Data/BroadcastListenContainer/SpatialGrid.hpp"
+
+//------------------------------------------
+namespace Nebulite::Data::BroadcastListenContainer {
+
+void SpatialGrid::clear() {
+    boxes.clear();
+    oversized.clear();
+    for (auto& cell : cells | std::views::values) {
+        cell.clear();
+    }
+}
+
+void SpatialGrid::insert(Aabb const& box) {
+    boxes.push_back(box);
+}
+
+void SpatialGrid::build() {
+    // Drop stale cells if objects moved far, otherwise keep their allocations
+    if (cells.size() > 4 * boxes.size() + 64) {
+        cells.clear();
+    }
+
+    // Cell size is the average extent of all entries
+    double extentSum = 0.0;
+    for (auto const& box : boxes) {
+        if (double const extent = std::max(box.maxX - box.minX, box.maxY - box.minY); std::isfinite(extent)) {
+            extentSum += extent;
+        }
+    }
+    double const cellSize = boxes.empty() ? 1.0 : std::max(1.0, extentSum / static_cast<double>(boxes.size()));
+    inverseCellSize = 1.0 / cellSize;
+
+    for (std::size_t idx = 0; idx < boxes.size(); idx++) {
+        CellRange const range = cellRange(boxes[idx]);
+        if (range.count() > maxCellsPerEntry) {
+            oversized.push_back(idx);
+            continue;
+        }
+        for (std::int32_t y = range.minY; y <= range.maxY; y++) {
+            for (std::int32_t x = range.minX; x <= range.maxX; x++) {
+                cells[cellKey(x, y)].push_back(idx);
+            }
+        }
+    }
+
+    stamps.assign(boxes.size(), 0);
+    currentStamp = 0;
+}
+
+std::int32_t SpatialGrid::cellCoordinate(double const value) const {
+    // Limit range, so that the cell count of a range never overflows
+    static auto constexpr limit = static_cast<double>(std::numeric_limits<std::int32_t>::max() / 4);
+    double const scaled = std::floor(value * inverseCellSize);
+    if (std::isnan(scaled)) {
+        return 0;
+    }
+    return static_cast<std::int32_t>(std::clamp(scaled, -limit, limit));
+}
+
+SpatialGrid::CellRange SpatialGrid::cellRange(Aabb const& box) const {
+    return CellRange{
+        .minX = cellCoordinate(std::min(box.minX, box.maxX)),
+        .minY = cellCoordinate(std::min(box.minY, box.maxY)),
+        .maxX = cellCoordinate(std::max(box.minX, box.maxX)),
+        .maxY = cellCoordinate(std::max(box.minY, box.maxY)),
+    };
+}
+
+void SpatialGrid::nextStamp() {
+    currentStamp++;
+    if (currentStamp == 0) {
+        // Wrapped around, reset all markers
+        std::ranges::fill(stamps, 0);
+        currentStamp = 1;
+    }
+}
+
+} // namespace Nebulite::Data::BroadcastListenContainer
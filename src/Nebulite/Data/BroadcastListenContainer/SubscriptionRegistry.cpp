@@ -0,0 +1,71 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Nebulite
+#include "Nebulite/Data/BroadcastListenContainer/SubscriptionRegistry.hpp"
+#include "Nebulite/Interaction/Rules/Listener.hpp"
+
+//------------------------------------------
+namespace Nebulite::Data::BroadcastListenContainer {
+
+void SubscriptionRegistry::subscribe(std::shared_ptr<Interaction::Rules::Listener> const& listener) {
+    std::scoped_lock const lock(mtx);
+    listener->subscribed.store(true, std::memory_order_relaxed);
+    add(listener);
+}
+
+void SubscriptionRegistry::listenOnce(std::shared_ptr<Interaction::Rules::Listener> const& listener) {
+    std::scoped_lock const lock(mtx);
+    listener->activate();
+    add(listener);
+}
+
+void SubscriptionRegistry::prepare() {
+    for (auto& topic : topics) {
+        auto& listeners = topic.listeners;
+
+        // Move active listeners to the front, evaluating and resetting each flag exactly once
+        std::size_t activeCount = 0;
+        for (std::size_t i = 0; i < listeners.size(); i++) {
+            if (listeners[i]->active.exchange(false, std::memory_order_relaxed)) {
+                std::swap(listeners[i], listeners[activeCount]);
+                activeCount++;
+            }
+        }
+
+        // Inactive listeners that unsubscribed are dropped, active ones are kept for this final round
+        auto const removed = std::ranges::remove_if(
+            listeners.begin() + static_cast<std::ptrdiff_t>(activeCount),
+            listeners.end(),
+            [](std::shared_ptr<Interaction::Rules::Listener> const& listener) {
+                return !listener->subscribed.load(std::memory_order_relaxed);
+            }
+        );
+        listeners.erase(removed.begin(), removed.end());
+        topic.activeCount = activeCount;
+    }
+}
+
+void SubscriptionRegistry::add(std::shared_ptr<Interaction::Rules::Listener> const& listener) {
+    listener->topicId = intern(listener->topic);
+    topics[listener->topicId].listeners.push_back(listener);
+}
+
+SubscriptionRegistry::TopicId SubscriptionRegistry::intern(std::string_view const topic) {
+    auto const [it, inserted] = topicIds.try_emplace(std::string(topic), static_cast<TopicId>(topics.size()));
+    if (inserted) {
+        topics.push_back(Topic{.name = std::string(topic), .listeners = {}, .activeCount = 0});
+    }
+    return it->second;
+}
+
+} // namespace Nebulite::Data::BroadcastListenContainer
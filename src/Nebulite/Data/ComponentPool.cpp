@@ -0,0 +1,79 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+// Nebulite
+#include "Nebulite/Constants/KeyNames.hpp"
+#include "Nebulite/Data/ComponentPool.hpp"
+#include "Nebulite/Data/Document/JsonScope.hpp"
+#include "Nebulite/Module/Domain/GlobalSpace/Physics.hpp"
+
+//------------------------------------------
+namespace Nebulite::Data {
+
+std::array<ScopedKeyView, ComponentPool::componentCount> const& ComponentPool::keys() {
+    using PhysicsKey = Module::Domain::GlobalSpace::Physics::Key::Local;
+    static std::array<ScopedKeyView, componentCount> constexpr componentKeys = {
+        // Position and size
+        Constants::KeyNames::RenderObject::positionX,
+        Constants::KeyNames::RenderObject::positionY,
+        Constants::KeyNames::RenderObject::sizeX,
+        Constants::KeyNames::RenderObject::sizeY,
+        // Physics
+        PhysicsKey::aX,
+        PhysicsKey::aY,
+        PhysicsKey::vX,
+        PhysicsKey::vY,
+        PhysicsKey::m,
+        PhysicsKey::forceX,
+        PhysicsKey::forceY,
+    };
+    return componentKeys;
+}
+
+std::size_t ComponentPool::acquire() {
+    std::scoped_lock const lock(mtx);
+    if (!freeSlots.empty()) {
+        std::size_t const slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
+    if (nextSlot == blocks.size() * blockSize) {
+        blocks.push_back(std::make_unique<Block>());
+    }
+    return nextSlot++;
+}
+
+void ComponentPool::release(std::size_t const slot) {
+    std::scoped_lock const lock(mtx);
+    assert(slot < nextSlot);
+    for (auto& column : blocks[slot / blockSize]->columns) {
+        column[slot % blockSize] = 0.0;
+    }
+    freeSlots.push_back(slot);
+}
+
+void ComponentPool::bind(JsonScope& scope, std::size_t const slot) {
+    for (std::size_t i = 0; i < componentCount; i++) {
+        scope.bindExternalDouble(keys()[i], value(static_cast<Component>(i), slot));
+    }
+}
+
+double* ComponentPool::value(Component const c, std::size_t const slot) {
+    std::scoped_lock const lock(mtx);
+    assert(slot < nextSlot);
+    return &blocks[slot / blockSize]->columns[static_cast<std::size_t>(c)][slot % blockSize];
+}
+
+std::size_t ComponentPool::size() const {
+    std::scoped_lock const lock(mtx);
+    return nextSlot - freeSlots.size();
+}
+
+} // namespace Nebulite::Data
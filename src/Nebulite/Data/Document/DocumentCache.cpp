@@ -10,8 +10,10 @@
 
 // Nebulite
 #include "Nebulite/Data/Document/DocumentCache.hpp"
+#include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Data/Document/KeyType.hpp"
 #include "Nebulite/Data/Document/ReadOnlyDocs.hpp"
+#include "Nebulite/Data/Document/ScopedKeyView.hpp"
 #include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Utility/StringHandler.hpp"
 
@@ -83,6 +85,24 @@ std::string DocumentCache::getDocString(std::string_view const link) const {
     return serial;
 }
 
+bool DocumentCache::copyDocInto(std::string_view const link, JsonScope& target) const {
+    ReadOnlyDoc const* docPtr = readOnlyDocs.getDocument(link);
+    if (docPtr == nullptr) {
+        return false;
+    }
+
+    // Lock the source, as copying flushes it
+    {
+        auto const lock = docPtr->document.lock();
+        static ScopedKeyView constexpr root("");
+        target.setSubDoc(root, docPtr->document);
+    }
+
+    // Update the cache (unload old documents)
+    readOnlyDocs.update();
+    return true;
+}
+
 std::pair<std::string, std::string> DocumentCache::splitDocKey(std::string const& docAndKey) {
     std::string_view docAndKeyView(docAndKey);
     Utility::StringHandler::strip(docAndKeyView, ' '); // Remove whitespace for more forgiving input handling
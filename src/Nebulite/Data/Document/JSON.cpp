@@ -4,6 +4,8 @@
 // Standard library
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <complex>
 #include <cstddef>
 #include <cstdint> // NOLINT
 #include <expected>
@@ -11,6 +13,7 @@
 #include <mutex>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -22,12 +25,14 @@
 #include <rapidjson/document.h>
 
 // Nebulite
+#include "Nebulite/Data/Document/DocumentMemoryUsage.hpp"
 #include "Nebulite/Data/Document/Json.hpp"
 #include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Data/Document/JsonTransformer.hpp"
 #include "Nebulite/Data/Document/KeyType.hpp"
 #include "Nebulite/Data/Document/RjDirectAccess.hpp"
 #include "Nebulite/Data/Document/SimpleValueError.hpp"
+#include "Nebulite/Data/MappedOrderedCacheList.hpp"
 #include "Nebulite/Math/Equality.hpp"
 #include "Nebulite/Module/Base/TransformationModule.hpp"
 #include "Nebulite/Nebulite.hpp"
@@ -66,7 +71,7 @@ Json::Json() {
 Json::~Json() {
     std::scoped_lock const lockGuard(mtx);
     doc.SetObject();
-    cache.clear();
+    clearCache();
 }
 
 //------------------------------------------
@@ -77,12 +82,17 @@ Json& Json::operator=(Json&& other) noexcept {
         std::scoped_lock const lockGuard(mtx, other.mtx);
         doc = std::move(other.doc);
         cache = std::move(other.cache);
+        cacheIndex = std::move(other.cacheIndex);
+        externalDoubles = std::move(other.externalDoubles);
         cacheLine = std::move(other.cacheLine);
+        orderedCacheListsOwned = std::move(other.orderedCacheListsOwned);
+        orderedCacheLists.store(other.orderedCacheLists.exchange(nullptr));
+        pipelineMemo = std::move(other.pipelineMemo);
     }
     return *this;
 }
 
-Json::Json(Json&& other) noexcept : cacheLine(std::move(other.cacheLine)), cache(std::move(other.cache)), doc(std::move(other.doc)) {
+Json::Json(Json&& other) noexcept : cacheLine(std::move(other.cacheLine)), cache(std::move(other.cache)), cacheIndex(std::move(other.cacheIndex)), externalDoubles(std::move(other.externalDoubles)), doc(std::move(other.doc)), pipelineMemo(std::move(other.pipelineMemo)), orderedCacheListsOwned(std::move(other.orderedCacheListsOwned)), orderedCacheLists(other.orderedCacheLists.exchange(nullptr)) {
     std::scoped_lock const lockGuard(mtx, other.mtx); // Locks both, deadlock-free
 }
 
@@ -121,6 +131,16 @@ void Json::copyFrom(Json const& other) {
     setSubDoc("", other);
 }
 
+bool Json::isEqual(Json const& other) const {
+    if (&other == this) {
+        return true;
+    }
+    std::scoped_lock const lockGuard(mtx, other.mtx);
+    flush("");
+    other.flush("");
+    return doc == other.doc;
+}
+
 //------------------------------------------
 // Validity check
 
@@ -165,9 +185,9 @@ JsonScope& Json::fullScope() {
 void Json::synchronizeChildren(std::string_view const parentKey) const {
     std::scoped_lock const lockGuard(mtx);
 
-    // Find all child keys and invalidate them
-    for (auto& [key, entry] : cache) {
-        bool const base = key.starts_with(parentKey) && key.length() > parentKey.length();
+    // Find all child keys and invalidate them, only the subtree of parentKey is visited
+    for (auto const& [key, entry] : cachedWithPrefix(parentKey)) {
+        bool const base = key.length() > parentKey.length();
         bool const startsWithParentKeyPlusDot = base && key[parentKey.length()] == SpecialCharacter::dot;
         bool const startsWithParentKeyPlusArr = base && key[parentKey.length()] == SpecialCharacter::arrayOpen;
         if (bool const parentKeyIsRoot = parentKey.empty(); parentKeyIsRoot || startsWithParentKeyPlusDot || startsWithParentKeyPlusArr) {
@@ -178,7 +198,7 @@ void Json::synchronizeChildren(std::string_view const parentKey) const {
                 entry->lastDoubleValue = *entry->stableDoublePointer;
             }
             else {
-                deleteCacheEntry(entry);
+                deleteCacheEntry(*entry);
             }
         }
     }
@@ -189,9 +209,7 @@ void Json::flush(std::string_view const key) const {
 
     auto const parent = findParentKey(key);
 
-    for (auto& [entryKey, entry] : cache) {
-        if (!entryKey.starts_with(parent)) continue;
-
+    for (auto const& [entryKey, entry] : cachedWithPrefix(parent)) {
         // Skip malformed entries
         if (entry->state == CacheEntry::EntryState::malformed) {
             continue;
@@ -212,6 +230,19 @@ void Json::flush(std::string_view const key) const {
     }
 }
 
+rapidjson::Value& Json::replaceWithArray(std::string_view const key, std::size_t const capacity) {
+    helperNonConstVar++; // Signal non-const operation
+    deleteCacheEntry(key);
+    flush(key);
+    rapidjson::Value* val = RjDirectAccess::ensurePath(key, doc, doc.GetAllocator());
+    if (val == nullptr) {
+        throw std::runtime_error("Failed to create or access path: " + std::string(key));
+    }
+    val->SetArray();
+    val->Reserve(static_cast<rapidjson::SizeType>(capacity), doc.GetAllocator());
+    return *val;
+}
+
 //------------------------------------------
 // Get methods
 
@@ -227,10 +258,9 @@ std::expected<RjDirectAccess::SimpleValue, SimpleValueRetrievalError> Json::getV
     }
 
     // Check cache first
-    if (!std::ranges::any_of(cache, [&key](auto const& pair) {
-        auto& [cachedKey, entry] = pair;
-        return cachedKey.starts_with(key)
-            && cachedKey != key
+    if (!std::ranges::any_of(cachedWithPrefix(key), [&key](auto const& pair) {
+        auto const& [cachedKey, entry] = pair;
+        return cachedKey != key
             && entry->state != CacheEntry::EntryState::deleted
             && Math::isEqualAllowNan(*entry->stableDoublePointer, entry->lastDoubleValue);
     })) {
@@ -289,18 +319,23 @@ Json Json::getSubDoc(std::string_view const key) const {
 }
 
 bool Json::getSubDocWithTransformations(std::string_view const key, Json& outDoc) const {
-    auto args = splitKeyWithTransformations(key);
-    {
-        auto const& baseKey = args[0];
+    auto const& transformer = JsonTransformer::instance();
+    auto const pipeline = transformer.compile(key);
 
-        // Using getSubDoc to properly populate the tempDoc with the rapidjson::Value
-        // Slower than a manual copy that handles types, but more secure and less error-prone
-        outDoc = getSubDoc(baseKey);
-    }
+    // Using getSubDoc to properly populate the tempDoc with the rapidjson::Value
+    // Slower than a manual copy that handles types, but more secure and less error-prone
+    outDoc = getSubDoc(pipeline->baseKey);
 
     // Apply each transformation in sequence
-    args.erase(args.begin());
-    return JsonTransformer::instance().parse(args, outDoc);
+    return transformer.apply(*pipeline, outDoc, pipeline->hasPureSteps ? &getPipelineMemo() : nullptr);
+}
+
+PipelineMemo& Json::getPipelineMemo() const {
+    std::scoped_lock const lockGuard(mtx);
+    if (pipelineMemo == nullptr) {
+        pipelineMemo = std::make_unique<PipelineMemo>();
+    }
+    return *pipelineMemo;
 }
 
 double* Json::getStableDoublePointer(std::string_view const key) const {
@@ -326,25 +361,99 @@ double* Json::getStableDoublePointer(std::string_view const key) const {
     if (rapidjson::Value const* val = RjDirectAccess::traversePath(key, doc); val != nullptr) {
         if (jsonValueToCache<double>(key, val).has_value()) {
             // Successfully loaded into cache, return pointer
-            return cache[key]->stableDoublePointer;
+            return cache.find(key)->second->stableDoublePointer;
         }
     }
 
     // If loading from document failed, create a new derived entry
-    auto newEntry = std::make_unique<CacheEntry>(*cacheLine, cachelineIndex);
+    auto newEntry = createCacheEntry(key);
     newEntry->value = standardNumericValue;
     *newEntry->stableDoublePointer = standardNumericValue;
     newEntry->lastDoubleValue = standardNumericValue;
     newEntry->state = CacheEntry::EntryState::derived;
-    auto* const ptr = newEntry->stableDoublePointer;
-    cache[key] = std::move(newEntry);
-    return ptr;
+    return insertCacheEntry(key, std::move(newEntry)).stableDoublePointer;
+}
+
+void Json::bindExternalDouble(std::string_view const key, double* storage) {
+    std::scoped_lock const lockGuard(mtx);
+
+    // Check for transformations
+    if (key.contains(SpecialCharacter::transformationPipe)) {
+        throw std::runtime_error("Transformations are not supported in bindExternalDouble()");
+    }
+    externalDoubles[key] = storage;
+
+    // Move an existing entry over, keeping its value
+    if (auto const it = cache.find(key); it != cache.end()) {
+        auto& entry = *it->second;
+        *storage = *entry.stableDoublePointer;
+        if (entry.managedInternalDouble) {
+            delete entry.stableDoublePointer;
+            entry.managedInternalDouble = false;
+        }
+        entry.stableDoublePointer = storage;
+    }
+}
+
+Json::CacheEntry& Json::insertCacheEntry(std::string_view const key, std::unique_ptr<CacheEntry> entry) const {
+    auto& slot = cache[key];
+    slot = std::move(entry);
+    cacheIndex.insert_or_assign(std::string(key), slot.get());
+    return *slot;
+}
+
+void Json::eraseCacheEntry(std::string_view const key) const {
+    cache.erase(key);
+    if (auto const it = cacheIndex.find(key); it != cacheIndex.end()) {
+        cacheIndex.erase(it);
+    }
+}
+
+void Json::clearCache() const {
+    cacheIndex.clear();
+    cache.clear();
+}
+
+std::unique_ptr<Json::CacheEntry> Json::createCacheEntry(std::string_view const key) const {
+    if (auto const it = externalDoubles.find(key); it != externalDoubles.end()) [[unlikely]] {
+        return std::make_unique<CacheEntry>(it->second);
+    }
+    return std::make_unique<CacheEntry>(*cacheLine, cachelineIndex);
 }
 
 std::unique_lock<std::recursive_mutex> Json::lock() const {
     return std::unique_lock(mtx);
 }
 
+MappedOrderedCacheList& Json::getOrderedCacheLists() const {
+    if (auto* lists = orderedCacheLists.load(std::memory_order_acquire); lists != nullptr) [[likely]] {
+        return *lists;
+    }
+    std::scoped_lock const lockGuard(mtx);
+    if (orderedCacheListsOwned == nullptr) {
+        orderedCacheListsOwned = std::make_unique<MappedOrderedCacheList>();
+        orderedCacheLists.store(orderedCacheListsOwned.get(), std::memory_order_release);
+    }
+    return *orderedCacheListsOwned;
+}
+
+DocumentMemoryUsage Json::getMemoryUsage() const {
+    std::scoped_lock const lockGuard(mtx);
+    DocumentMemoryUsage usage;
+    usage.document = sizeof(Json) + doc.GetAllocator().Size();
+    usage.cache = cache.capacity() * sizeof(decltype(cache)::value_type) + cache.size() * sizeof(CacheEntry);
+    for (auto const& key : std::views::keys(cacheIndex)) {
+        // Map node: key, value and tree pointers, plus the key buffer if not stored inline
+        usage.cache += sizeof(decltype(cacheIndex)::value_type) + 4 * sizeof(void*);
+        usage.cache += key.capacity() > std::string().capacity() ? 2 * (key.capacity() + 1) : 0; // Cache and index each own the key
+    }
+    usage.cacheLine = cacheLine != nullptr ? sizeof(CacheLine) : 0;
+    if (auto const* lists = orderedCacheLists.load(std::memory_order_acquire); lists != nullptr) {
+        usage.orderedCacheLists = lists->memoryUsage();
+    }
+    return usage;
+}
+
 
 //------------------------------------------
 // Set methods
@@ -384,7 +493,7 @@ void Json::setVariant(std::string_view const key, RjDirectAccess::SimpleValue co
         synchronizeChildren(key);
 
         // Create new entry directly in DIRTY state
-        auto newEntry = std::make_unique<CacheEntry>(*cacheLine, cachelineIndex);
+        auto newEntry = createCacheEntry(key);
 
         // Set entry values
         newEntry->value = val;
@@ -394,7 +503,7 @@ void Json::setVariant(std::string_view const key, RjDirectAccess::SimpleValue co
         newEntry->state = CacheEntry::EntryState::dirty;
 
         // Insert into cache
-        cache[key] = std::move(newEntry);
+        insertCacheEntry(key, std::move(newEntry));
 
         // Flush to RapidJSON document for structural integrity
         flush(key);
@@ -480,7 +589,7 @@ void Json::deserialize(std::string_view const serialOrLink) {
     flush("");
     doc.SetObject();
     for (auto const& entry : std::views::values(cache)) {
-        deleteCacheEntry(entry);
+        deleteCacheEntry(*entry);
     }
 
     //------------------------------------------
@@ -492,6 +601,74 @@ void Json::deserialize(std::string_view const serialOrLink) {
     synchronizeChildren("");
 }
 
+//------------------------------------------
+// Bulk array access
+
+std::optional<std::vector<double>> Json::getNumericArray(std::string_view const key) const {
+    std::scoped_lock const lockGuard(mtx);
+    flush(key); // Elements may have been modified through the cache
+
+    rapidjson::Value const* val = RjDirectAccess::traversePath(key, doc);
+    if (val == nullptr || !val->IsArray()) {
+        return std::nullopt;
+    }
+
+    std::vector<double> values;
+    values.reserve(val->Size());
+    for (auto const& element : val->GetArray()) {
+        if (element.IsNumber()) [[likely]] {
+            values.push_back(element.GetDouble());
+            continue;
+        }
+        // Same conversion as get<double>, e.g. for numeric strings
+        auto const simpleValue = RjDirectAccess::getSimpleValue(&element);
+        if (!simpleValue.has_value()) {
+            return std::nullopt;
+        }
+        auto const converted = convertVariant<double>(simpleValue.value());
+        if (!converted.has_value()) {
+            return std::nullopt;
+        }
+        values.push_back(converted.value());
+    }
+    return values;
+}
+
+void Json::setComplexArray(std::string_view const key, std::span<std::complex<double> const> const values, std::string_view const realMember, std::string_view const imagMember) {
+    std::scoped_lock const lockGuard(mtx);
+    auto& array = replaceWithArray(key, values.size());
+    auto& allocator = doc.GetAllocator();
+    for (auto const& value : values) {
+        rapidjson::Value element(rapidjson::kObjectType);
+        element.AddMember(rapidjson::Value(realMember.data(), static_cast<rapidjson::SizeType>(realMember.size()), allocator), rapidjson::Value(value.real()), allocator);
+        element.AddMember(rapidjson::Value(imagMember.data(), static_cast<rapidjson::SizeType>(imagMember.size()), allocator), rapidjson::Value(value.imag()), allocator);
+        array.PushBack(element, allocator);
+    }
+    synchronizeChildren(key);
+}
+
+bool Json::permuteArray(std::string_view const key, std::span<std::size_t const> const order) {
+    std::scoped_lock const lockGuard(mtx);
+    helperNonConstVar++; // Signal non-const operation
+    flush(key);
+
+    rapidjson::Value* val = RjDirectAccess::traversePath(key, doc);
+    if (val == nullptr || !val->IsArray() || val->Size() != order.size()) {
+        return false;
+    }
+
+    // Swapping only exchanges the values' handles, their contents are never copied
+    std::vector<rapidjson::Value> reordered(order.size());
+    for (auto const [target, source] : std::views::zip(reordered, order)) {
+        target.Swap((*val)[static_cast<rapidjson::SizeType>(source)]);
+    }
+    for (auto const [index, element] : std::views::enumerate(reordered)) {
+        (*val)[static_cast<rapidjson::SizeType>(index)].Swap(element);
+    }
+    synchronizeChildren(key);
+    return true;
+}
+
 //------------------------------------------
 // Key Types, Sizes
 
@@ -624,7 +801,7 @@ void Json::removeMember(std::string_view const key) {
     flush(key);
 
     // Remove member from cache, synchronize children
-    cache.erase(key);
+    eraseCacheEntry(key);
     RjDirectAccess::removeMember(key, doc);
     synchronizeChildren(key);
 }
@@ -806,8 +983,7 @@ std::expected<RjDirectAccess::SimpleValue, SimpleValueRetrievalError> Json::getS
         if (it == cache.end() && RjDirectAccess::getSimpleValue(val).has_value()) {
             // Insert only if the value is of a supported type, otherwise complex types might be interpreted as simple values.
             // Create new cache entry and insert into cache
-            auto newEntry = std::make_unique<CacheEntry>(*cacheLine, cachelineIndex);
-            cache[key] = std::move(newEntry);
+            insertCacheEntry(key, createCacheEntry(key));
             it = cache.find(key);
         }
 
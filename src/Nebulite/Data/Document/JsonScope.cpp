@@ -2,6 +2,7 @@
 // Includes
 
 // Standard library
+#include <atomic>
 #include <complex>
 #include <cstddef>
 #include <cstdint> // NOLINT
@@ -16,6 +17,7 @@
 #include <vector>
 
 // Nebulite
+#include "Nebulite/Data/Document/DocumentMemoryUsage.hpp"
 #include "Nebulite/Data/Document/Json.hpp"
 #include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Data/Document/KeyType.hpp"
@@ -24,7 +26,6 @@
 #include "Nebulite/Data/Document/SimpleValueError.hpp"
 #include "Nebulite/Data/MappedOrderedCacheList.hpp"
 #include "Nebulite/Utility/Coordination/IdGenerator.hpp"
-#include "Nebulite/Utility/Generate.hpp"
 
 //------------------------------------------
 namespace Nebulite::Data {
@@ -34,21 +35,18 @@ JsonScope::JsonScope(Json& doc, std::optional<std::string> const& prefix)
     // create a non-owning shared_ptr to the provided JSON (no delete on destruction)
     : baseDocument(std::shared_ptr<Json>(&doc, [](Json*){}))
     , scopePrefix(generateScopePrefix(doc, prefix))
-    , odpCache(Utility::Generate::array<MappedOrderedCacheList, cacheLookupThreadCount>([this](std::size_t) {return MappedOrderedCacheList(*this);}))
 {}
 
 // Constructing a JsonScope from another JsonScope and a sub-prefix
 JsonScope::JsonScope(JsonScope const& other, std::optional<std::string> const& prefix)
     : baseDocument(other.baseDocument)
     , scopePrefix(generateScopePrefix(other, prefix))
-    , odpCache(Utility::Generate::array<MappedOrderedCacheList, cacheLookupThreadCount>([this](std::size_t) {return MappedOrderedCacheList(*this);}))
 {}
 
 // Default constructor, we create a self-owned empty JSON document
 JsonScope::JsonScope()
     : baseDocument(std::make_shared<Json>())
     , scopePrefix("")
-    , odpCache(Utility::Generate::array<MappedOrderedCacheList, cacheLookupThreadCount>([this](std::size_t) {return MappedOrderedCacheList(*this);}))
 {}
 
 JsonScope::~JsonScope() = default;
@@ -132,6 +130,10 @@ double* JsonScope::getStableDoublePointer(ScopedKey const& key) const {
     return getStableDoublePointer(key.view());
 }
 
+void JsonScope::bindExternalDouble(ScopedKeyView const& key, double* storage) {
+    doc().bindExternalDouble(key.full(*this), storage);
+}
+
 std::optional<std::complex<double>> JsonScope::getComplex(ScopedKeyView const& key) const {
     if (auto const [realPart, imagPart] = getMultiple<double>(key.addMember(complexRe).view(), key.addMember(complexIm).view()); realPart.has_value() && imagPart.has_value()) {
         return {std::complex(realPart.value(), imagPart.value())};
@@ -143,6 +145,14 @@ std::optional<std::complex<double>> JsonScope::getComplex(ScopedKey const& key)
     return getComplex(key.view());
 }
 
+std::optional<std::vector<double>> JsonScope::getNumericArray(ScopedKeyView const& key) const {
+    return baseDocument->getNumericArray(key.full(*this));
+}
+
+std::optional<std::vector<double>> JsonScope::getNumericArray(ScopedKey const& key) const {
+    return getNumericArray(key.view());
+}
+
 //------------------------------------------
 // Setter
 
@@ -191,6 +201,14 @@ void JsonScope::setComplex(ScopedKey const& key, std::complex<double> const& val
     setComplex(key.view(), value);
 }
 
+void JsonScope::setComplexArray(ScopedKeyView const& key, std::span<std::complex<double> const> const values) {
+    doc().setComplexArray(key.full(*this), values, complexRe, complexIm);
+}
+
+bool JsonScope::permuteArray(ScopedKeyView const& key, std::span<std::size_t const> const order) {
+    return doc().permuteArray(key.full(*this), order);
+}
+
 //------------------------------------------
 // Special sets for threadsafe maths operations
 
@@ -244,6 +262,24 @@ std::unique_lock<std::recursive_mutex> JsonScope::lock() const {
 //------------------------------------------
 // Ordered cache list related
 
+MappedOrderedCacheList& JsonScope::getOrderedCacheLists() const {
+    return baseDocument->getOrderedCacheLists();
+}
+
+MappedOrderedCacheList::ScopeId JsonScope::getOrderedCacheScopeId(MappedOrderedCacheList& lists) const {
+    auto id = orderedCacheScopeId.load(std::memory_order_relaxed);
+    if (id == unassignedScopeId) [[unlikely]] {
+        // Concurrent callers receive the same id for the same prefix
+        id = lists.getScopeId(getScopePrefix());
+        orderedCacheScopeId.store(id, std::memory_order_relaxed);
+    }
+    return id;
+}
+
+DocumentMemoryUsage JsonScope::getDocumentMemoryUsage() const {
+    return baseDocument->getMemoryUsage();
+}
+
 std::size_t JsonScope::assignCacheLookupIndex() {
     static auto indexCounter = Utility::Coordination::IdGenerator::atomicIncrementIdGenerator();
     thread_local std::size_t const threadIndex = indexCounter();
@@ -3,9 +3,14 @@
 
 // Standard library
 #include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 // Nebulite
@@ -13,7 +18,9 @@
 #include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Data/Document/JsonTransformer.hpp"
 #include "Nebulite/Nebulite.hpp"
+#include "Nebulite/Module/Base/TransformationModule.hpp"
 #include "Nebulite/Utility/Args/FuncTree.hpp"
+#include "Nebulite/Utility/StringHandler.hpp"
 
 // Nebulite: Transformation modules
 #include "Nebulite/Module/Transformation/Arithmetic.hpp"
@@ -38,8 +45,20 @@
 //------------------------------------------
 namespace Nebulite::Data {
 
+struct PipelineMemo::Entry {
+    Json input;
+    Json output;
+};
+
+namespace {
+/**
+ * @brief Caller name passed as first argument to the transformation tree.
+ */
+std::string_view constexpr callerName = "JsonTransformer";
+} // namespace
+
 JsonTransformer::JsonTransformer() {
-    transformationFuncTree = std::make_shared<Utility::Args::FuncTree<bool, JsonScope&>>(
+    transformationFuncTree = std::make_shared<TransformationTree>(
         "JSON rvalue transformation FuncTree",
         true,
         false,
@@ -71,6 +90,9 @@ JsonTransformer::JsonTransformer() {
     // Bind all transformations
     for (auto const& module : modules) {
         module->bindTransformations();
+        for (auto const& name : module->getPureTransformations()) {
+            pureTransformations.emplace(name);
+        }
     }
 }
 
@@ -104,4 +126,116 @@ bool JsonTransformer::parseSingleTransformation(std::span<std::string_view const
     return transformationFuncTree->parse(args, jsonDoc);
 }
 
+// Compiled pipelines
+
+std::shared_ptr<JsonTransformer::Pipeline const> JsonTransformer::compile(std::string_view const key) const {
+    {
+        std::scoped_lock const lock(pipelineCacheMutex);
+        if (auto const it = pipelineCache.find(key); it != pipelineCache.end()) {
+            return it->second;
+        }
+    }
+
+    // Compile outside the lock, concurrent compilations of the same key yield equal pipelines
+    auto pipeline = std::make_shared<Pipeline>();
+    auto const args = Json::splitKeyWithTransformations(key);
+    if (!args.empty()) {
+        pipeline->baseKey = args.front();
+        pipeline->steps.reserve(args.size() - 1);
+        std::string memoKey = pipeline->baseKey;
+        for (auto const& transformation : std::span(args).subspan(1)) {
+            memoKey += Json::SpecialCharacter::transformationPipe;
+            memoKey += transformation;
+            auto& step = pipeline->steps.emplace_back(compileStep(transformation));
+            if (isPure(transformation)) {
+                step.memoKey = memoKey;
+                pipeline->hasPureSteps = true;
+            }
+        }
+    }
+
+    std::scoped_lock const lock(pipelineCacheMutex);
+    if (pipelineCache.size() >= pipelineCacheCapacity) {
+        pipelineCache.clear();
+    }
+    return pipelineCache.try_emplace(key, std::move(pipeline)).first->second;
+}
+
+bool JsonTransformer::apply(Pipeline const& pipeline, Json& jsonDoc, PipelineMemo* memo) const {
+    if (pipeline.steps.empty()) [[unlikely]] {
+        return false;
+    }
+    return std::ranges::all_of(pipeline.steps, [&](Pipeline::Step const& step) {
+        if (memo != nullptr && !step.memoKey.empty()) {
+            return applyStep(step, jsonDoc, *memo);
+        }
+        return applyStep(step, jsonDoc);
+    });
+}
+
+JsonTransformer::Pipeline::Step JsonTransformer::compileStep(std::string_view const source) const {
+    Pipeline::Step step;
+    step.source = source;
+    std::string command(callerName);
+    command += ' ';
+    command += source;
+    step.compiled = transformationFuncTree->compile(command);
+    return step;
+}
+
+bool JsonTransformer::isPure(std::string_view const source) const {
+    // Names of transformations in categories span multiple tokens, e.g. 'sort numerically'
+    auto const [tokens, unclosedQuote] = Utility::StringHandler::parseQuotedArguments(source);
+    if (unclosedQuote) {
+        return false;
+    }
+    std::string name;
+    for (auto const& token : tokens) {
+        if (!name.empty()) {
+            name += ' ';
+        }
+        name += token;
+        if (pureTransformations.contains(name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JsonTransformer::applyStep(Pipeline::Step const& step, Json& jsonDoc) const {
+    if (step.compiled.has_value()) {
+        return transformationFuncTree->execute(step.compiled.value(), jsonDoc.fullScope());
+    }
+    // Not resolvable, parse to report the error
+    std::vector<std::string_view> argsView = {callerName};
+    return transformationFuncTree->parseWithPrefix(argsView, step.source, jsonDoc.fullScope());
+}
+
+bool JsonTransformer::applyStep(Pipeline::Step const& step, Json& jsonDoc, PipelineMemo& memo) const {
+    {
+        std::scoped_lock const lock(memo.mutex);
+        if (auto const it = memo.entries.find(step.memoKey); it != memo.entries.end() && it->second->input.isEqual(jsonDoc)) {
+            jsonDoc.copyFrom(it->second->output);
+            memo.hits++;
+            return true;
+        }
+    }
+
+    // Keep the input before it is transformed in place
+    auto entry = std::make_shared<PipelineMemo::Entry>();
+    entry->input.copyFrom(jsonDoc);
+    if (!applyStep(step, jsonDoc)) {
+        return false;
+    }
+    entry->output.copyFrom(jsonDoc);
+
+    std::scoped_lock const lock(memo.mutex);
+    memo.misses++;
+    if (memo.entries.size() >= PipelineMemo::capacity && !memo.entries.contains(step.memoKey)) {
+        memo.entries.clear();
+    }
+    memo.entries.insert_or_assign(step.memoKey, std::move(entry));
+    return true;
+}
+
 } // namespace Nebulite::Data
@@ -4,6 +4,9 @@
 // Standard library
 #include <cstddef>
 #include <cstdint> // NOLINT
+#include <mutex>
+#include <ranges>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -20,6 +23,27 @@ std::size_t MappedOrderedCacheList::generateUniqueId(std::string_view const iden
     return generator(identifier);
 }
 
+MappedOrderedCacheList::ScopeId MappedOrderedCacheList::getScopeId(std::string_view const prefix) {
+    std::scoped_lock const lock(mtxScopeIds);
+    auto const [it, inserted] = scopeIds.try_emplace(std::string(prefix), static_cast<ScopeId>(scopeIds.size()));
+    return it->second;
+}
+
+std::size_t MappedOrderedCacheList::memoryUsage() const {
+    std::size_t bytes = sizeof(MappedOrderedCacheList);
+    for (auto const& slot : threadSlots) {
+        if (slot == nullptr) {
+            continue;
+        }
+        bytes += sizeof(ThreadSlot) + slot->map.capacity() * sizeof(Map::value_type);
+        for (auto const& list : slot->map | std::views::values) {
+            bytes += list.capacity() * sizeof(double*);
+        }
+    }
+    bytes += scopeIds.capacity() * sizeof(decltype(scopeIds)::value_type);
+    return bytes;
+}
+
 void MappedOrderedCacheList::addToVec(std::vector<double*>& vec, JsonScope const& reference, ScopedKeyView const& key){
     vec.push_back(reference.getStableDoublePointer(key));
 }
@@ -2,18 +2,18 @@
 // Includes
 
 // Standard library
-#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint> // NOLINT
-#include <iterator>
 #include <ranges>
-#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+// External
+#include <absl/container/flat_hash_map.h>
+
 // Nebulite
-#include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Core/RenderObject.hpp"
 #include "Nebulite/Data/Batch.hpp"
 #include "Nebulite/Data/Document/Json.hpp"
@@ -21,7 +21,6 @@
 #include "Nebulite/Data/RenderObjectContainer.hpp"
 #include "Nebulite/Data/RendererProcessor.hpp"
 #include "Nebulite/Data/Tiling.hpp"
-#include "Nebulite/Utility/Coordination/WorkDispatcher.hpp"
 
 //------------------------------------------
 namespace Nebulite::Data {
@@ -77,8 +76,7 @@ void RenderObjectContainer::deserialize(std::string const& serialOrLink, TilingI
                 str = roSerial.value();
             }
 
-            auto* ro = new Core::RenderObject(capture);
-            ro->deserialize(str);
+            auto* ro = new Core::RenderObject(capture, str);
             append(ro, tilingInformation);
         }
     }
@@ -89,6 +87,7 @@ void RenderObjectContainer::deserialize(std::string const& serialOrLink, TilingI
 
 void RenderObjectContainer::append(Core::RenderObject* toAppend, TilingInformation const& tilingInformation) {
     auto const pos = getTilePos(toAppend->getPosition(), tilingInformation);
+    objectIndex[toAppend->getId()] = toAppend;
 
     // Try to insert into an existing batch
     if (objectContainer[pos].insertIfCostGoalMatches(toAppend)) {
@@ -122,38 +121,32 @@ void RenderObjectContainer::update(std::vector<TileCoordinate> const& viewport,
     //------------------------------------------
     // Update only tiles that might be visible
 
-    std::size_t workerIdx = 0;
     for (auto tilePosition : viewport) {
         // Check if container has tile at position, if not, skip
         auto const it = objectContainer.find(tilePosition);
         if (it == objectContainer.end()) {
             continue;
         }
+        rendererProcessor.addTile(it->second, tilePosition, tilingInformation);
+    }
+    processTiles(tilingInformation, rendererProcessor);
+}
 
-        // Create worker threads, one for each visible tile
-        // Get current worker, set up workspace and add work to it
-        if (auto& thread = rendererProcessor.batchWorkerPool[workerIdx]; thread.has_value()) {
-            auto& workspace = thread.value().workspace;
-            workspace.work = &it->second;
-            workspace.pos = tilePosition;
-            workspace.tilingInformation = tilingInformation;
-
-            // if workerIdx exceeds, process pool
-            workerIdx++;
-            if (workerIdx == Constants::ThreadSettings::getRendererWorkerCount()) {
-                rendererProcessor.processPool();
-                workerIdx = 0;
-            }
-        }
-        else {
-            throw std::runtime_error("RendererProcessor worker pool not initialized for worker index " + std::to_string(workerIdx));
+void RenderObjectContainer::updateSelection(TileSelection const& selection, TilingInformation const& tilingInformation, RendererProcessor& rendererProcessor) {
+    for (auto& [tilePosition, tile] : objectContainer) {
+        if (selection(tilePosition)) {
+            rendererProcessor.addTile(tile, tilePosition, tilingInformation);
         }
     }
+    processTiles(tilingInformation, rendererProcessor);
+}
 
-    // Process rest
-    if (workerIdx > 0) {
-        rendererProcessor.processPool(workerIdx);
-    }
+void RenderObjectContainer::processTiles(TilingInformation const& tilingInformation, RendererProcessor& rendererProcessor) {
+    // Process all tiles in parallel
+    rendererProcessor.processPool();
+
+    // Objects deleted during processing are no longer accessible by id
+    unindexTrash();
 
     // Objects to move to new tile positions
     for (auto* const obj : reinsertionProcess.queue) {
@@ -162,37 +155,45 @@ void RenderObjectContainer::update(std::vector<TileCoordinate> const& viewport,
     reinsertionProcess.queue.clear();
 }
 
-Core::RenderObject* RenderObjectContainer::getObjectFromId(std::size_t const domainId) {
-    // Go through all batches
-    for (auto& tile : std::views::values(objectContainer)) {
-        for (auto const& objects : tile.getBatchedObjects()) {
-            for (auto const& object : objects) {
-                if (object->getId() == domainId) {
-                    return object;
-                }
-            }
+void RenderObjectContainer::unindexTrash() {
+    for (auto const* obj : deletionProcess.trash) {
+        if (auto const it = objectIndex.find(obj->getId()); it != objectIndex.end() && it->second == obj) {
+            objectIndex.erase(it);
         }
     }
+}
+
+Core::RenderObject* RenderObjectContainer::getObjectFromId(std::size_t const domainId) {
+    if (auto const it = objectIndex.find(domainId); it != objectIndex.end()) {
+        return it->second;
+    }
     return nullptr; // Not found
 }
 
 void RenderObjectContainer::reinsertAllObjects(TilingInformation const& tilingInformation) {
-    // Collect all objects
+    auto const start = std::chrono::steady_clock::now();
+
+    // Collect only objects whose tile changed, all others keep their batch
     std::vector<Core::RenderObject*> toReinsert;
-    for (auto& tile : std::views::values(objectContainer)) {
-        for (auto const& objects : tile.getBatchedObjects()) {
-            // Collect all objects from the batch
-            std::ranges::copy(objects.begin(), objects.end(), std::back_inserter(toReinsert));
-        }
+    std::size_t checkedObjects = 0;
+    for (auto& [tileCoordinate, tile] : objectContainer) {
+        checkedObjects += tile.extractMisplaced(toReinsert, tilingInformation, tileCoordinate);
     }
 
-    // Fully reset container
-    objectContainer.clear();
+    // Drop emptied tiles, their textures were already released by the extraction
+    absl::erase_if(objectContainer, [](auto const& entry) { return entry.second.getBatches().empty(); });
 
-    // Reinsert
-    for (auto const& ptr : toReinsert) {
+    // Reinsert, objects stay indexed
+    for (auto* const ptr : toReinsert) {
         append(ptr, tilingInformation);
     }
+
+    auto const end = std::chrono::steady_clock::now();
+    lastReinsertion = ReinsertionStats{
+        .durationMs = std::chrono::duration<double, std::milli>(end - start).count(),
+        .checkedObjects = checkedObjects,
+        .movedObjects = toReinsert.size(),
+    };
 }
 
 bool RenderObjectContainer::isValidPosition(TileCoordinate const& position) const {
@@ -206,15 +207,11 @@ void RenderObjectContainer::purgeObjects() {
         tile.moveObjects(deletionProcess.trash);
     }
     objectContainer.clear();
+    unindexTrash();
 }
 
 size_t RenderObjectContainer::getObjectCount() const {
-    // Calculate the total item count
-    std::size_t totalCount = 0;
-    for (auto const it = objectContainer.begin(); it != objectContainer.end();) {
-        totalCount += it->second.getBatches().size();
-    }
-    return totalCount;
+    return objectIndex.size();
 }
 
 RenderObjectContainer::ContainerInfo RenderObjectContainer::getContainerInfo() const {
@@ -228,6 +225,11 @@ RenderObjectContainer::ContainerInfo RenderObjectContainer::getContainerInfo() c
             info.containerTotalCost += cost;
         }
     }
+
+    // Reinsertion stats
+    info.reinsertionDurationMs = lastReinsertion.durationMs;
+    info.reinsertionCheckedObjects = lastReinsertion.checkedObjects;
+    info.reinsertionMovedObjects = lastReinsertion.movedObjects;
     return info;
 }
 
@@ -2,22 +2,18 @@
 // Includes
 
 // Standard library
+#include <algorithm>
 #include <cstddef>
-#include <exception>
+#include <cstdint> // NOLINT
 #include <mutex>
-#include <optional>
-#include <ranges>
-#include <string>
+#include <stdexcept>
 #include <vector>
 
 // Nebulite
-#include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Core/RenderObject.hpp"
 #include "Nebulite/Data/RenderObjectContainer.hpp"
 #include "Nebulite/Data/RendererProcessor.hpp"
-#include "Nebulite/Nebulite.hpp"
-#include "Nebulite/Utility/Coordination/WorkDispatcher.hpp"
-#include "Nebulite/Utility/Generate.hpp"
+#include "Nebulite/Utility/Coordination/TaskScheduler.hpp"
 
 //------------------------------------------
 namespace Nebulite::Data {
@@ -27,94 +23,60 @@ RendererProcessor& RendererProcessor::instance() {
     return instance;
 }
 
-RendererProcessor::RendererProcessor()
-    : batchWorkerPool(Utility::Generate::array<
-          std::optional<Utility::Coordination::WorkDispatcher<DispatcherWorkspace>>,
-          Constants::ThreadSettings::Maximum::rendererWorkerCount
-      >([](std::size_t) {
-          return std::nullopt;
-    })){
-    // Initialize worker pool
-    for (std::size_t i = 0; i < Constants::ThreadSettings::getRendererWorkerCount(); i++) {
-        batchWorkerPool[i].emplace(stopFlag, batchWorkerFunc);
-    }
-}
-
-RendererProcessor::~RendererProcessor() {
-    try {
-        // 1.) Notify all workers to stop
-        stopFlag = true;
-
-        // 2.) Optionally, start work to wake any waiting threads
-        for (auto& worker : batchWorkerPool | std::views::take(Constants::ThreadSettings::getRendererWorkerCount())) {
-            if (worker.has_value()) {
-                worker.value().startWork();  // wakes worker so it can check stopFlag
-            }
-            else {
-                throw std::exception();
-            }
-        }
-    } catch (std::exception const& e) {
-        // Log the exception if needed
-        Global::capture().error.println("Exception during RendererProcessor destruction: " + std::string(e.what()));
-    }
+void RendererProcessor::prepareForNewLayer(RenderObjectContainer* layer) {
+    reinsertionProcess = &layer->reinsertionProcess;
+    deletionProcess = &layer->deletionProcess;
 }
 
-void RendererProcessor::prepareForNewLayer(RenderObjectContainer* layer) {
-    for (auto& worker : batchWorkerPool | std::views::take(Constants::ThreadSettings::getRendererWorkerCount())) {
-        if (worker.has_value()) {
-            worker.value().workspace.reinsertionProcess = &layer->reinsertionProcess;
-            worker.value().workspace.deletionProcess = &layer->deletionProcess;
-        }
-        else {
-            throw std::exception();
-        }
+void RendererProcessor::addTile(Tile& tile, TileCoordinate const& pos, TilingInformation const& tilingInformation) {
+    std::uint64_t estimatedCost = 0;
+    for (auto const& batch : tile.getBatches()) {
+        estimatedCost += batch.estimatedCost;
     }
+    jobs.push_back(TileJob{
+        .work = &tile,
+        .tilingInformation = tilingInformation,
+        .pos = pos,
+        .estimatedCost = estimatedCost
+    });
 }
 
-void RendererProcessor::batchWorkerFunc(DispatcherWorkspace const& workspace){
+void RendererProcessor::batchWorkerFunc(TileJob const& job) const {
     // Process
     // We update each object and check if it needs to be moved or deleted
-    // Every batch worker has potential objects to move or delete
+    // Every tile has potential objects to move or delete
     std::vector<Core::RenderObject*> toMove;
     std::vector<Core::RenderObject*> toDelete;
 
-    workspace.work->update(toMove, toDelete, workspace.tilingInformation, workspace.pos);
+    job.work->update(toMove, toDelete, job.tilingInformation, job.pos);
 
     // All objects to move are collected in queue
-    for (auto* ptr : toMove) {
-        std::scoped_lock const lock(workspace.reinsertionProcess->reinsertMutex);
-        workspace.reinsertionProcess->queue.push_back(ptr);
+    if (!toMove.empty()) {
+        std::scoped_lock const lock(reinsertionProcess->reinsertMutex);
+        reinsertionProcess->queue.insert(reinsertionProcess->queue.end(), toMove.begin(), toMove.end());
     }
 
     // All objects to delete are collected in trash
-    for (auto* ptr : toDelete) {
-        std::scoped_lock const lock(workspace.deletionProcess->deleteMutex);
-        workspace.deletionProcess->trash.push_back(ptr);
+    if (!toDelete.empty()) {
+        std::scoped_lock const lock(deletionProcess->deleteMutex);
+        deletionProcess->trash.insert(deletionProcess->trash.end(), toDelete.begin(), toDelete.end());
     }
 }
 
 void RendererProcessor::processPool() {
-    processPool(Constants::ThreadSettings::getRendererWorkerCount());
-}
-
-void RendererProcessor::processPool(std::size_t const count) {
-    for (auto& worker : batchWorkerPool | std::views::take(count)) {
-        if (worker.has_value()) {
-            worker.value().startWork();
-        }
-        else {
-            throw std::exception();
-        }
+    if (jobs.empty()) {
+        return;
     }
-    for (auto& worker : batchWorkerPool | std::views::take(count)) {
-        if (worker.has_value()) {
-            worker.value().waitForWorkFinished();
-        }
-        else {
-            throw std::exception();
-        }
+    if (reinsertionProcess == nullptr || deletionProcess == nullptr) {
+        throw std::runtime_error("RendererProcessor: no layer prepared before processing tiles");
     }
+
+    // Longest jobs first: cheap tiles are left over at the end to fill up idle threads
+    std::ranges::sort(jobs, std::ranges::greater{}, &TileJob::estimatedCost);
+    Utility::Coordination::TaskScheduler::instance().parallelFor(jobs.size(), [this](std::size_t const idx) {
+        batchWorkerFunc(jobs[idx]);
+    });
+    jobs.clear();
 }
 
 } // namespace Nebulite::Data
@@ -0,0 +1,102 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <vector>
+
+// Nebulite
+#include "Nebulite/Data/SlabPool.hpp"
+
+//------------------------------------------
+namespace Nebulite::Data {
+
+namespace {
+/**
+ * @struct Registry
+ * @brief All existing pools, for stats.
+ */
+struct Registry {
+    std::vector<SlabPool const*> pools;
+    std::mutex mtx;
+};
+
+Registry& registry() {
+    // Never destroyed, pools may unregister during static destruction
+    static auto* const instance = new Registry();
+    return *instance;
+}
+} // namespace
+
+SlabPool::SlabPool(std::string_view const name, std::size_t const slotSize, std::size_t const slotAlignment)
+    : name(name),
+      // Round up, so every slot in a slab stays aligned
+      slotSize((std::max(slotSize, sizeof(void*)) + slotAlignment - 1) / slotAlignment * slotAlignment),
+      slotAlignment(slotAlignment) {
+    auto& [pools, mtx] = registry();
+    std::scoped_lock const lock(mtx);
+    pools.push_back(this);
+}
+
+SlabPool::~SlabPool() {
+    {
+        auto& [pools, mtx] = registry();
+        std::scoped_lock const lock(mtx);
+        std::erase(pools, this);
+    }
+    for (auto* slab : slabs) {
+        ::operator delete(slab, std::align_val_t(slotAlignment));
+    }
+}
+
+void* SlabPool::allocate() {
+    std::scoped_lock const lock(mtx);
+    if (freeSlots.empty()) {
+        auto* slab = static_cast<std::byte*>(::operator new(slotSize * slotsPerSlab, std::align_val_t(slotAlignment)));
+        slabs.push_back(slab);
+        stats.capacity += slotsPerSlab;
+
+        // Push in reverse, so slots are handed out in address order
+        freeSlots.reserve(freeSlots.size() + slotsPerSlab);
+        for (std::size_t i = slotsPerSlab; i > 0; i--) {
+            freeSlots.push_back(slab + (i - 1) * slotSize);
+        }
+    }
+    void* slot = freeSlots.back();
+    freeSlots.pop_back();
+    stats.allocations++;
+    stats.live++;
+    return slot;
+}
+
+void SlabPool::deallocate(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    std::scoped_lock const lock(mtx);
+    assert(stats.live > 0);
+    freeSlots.push_back(ptr);
+    stats.frees++;
+    stats.live--;
+}
+
+SlabPool::Stats SlabPool::getStats() const {
+    std::scoped_lock const lock(mtx);
+    return stats;
+}
+
+void SlabPool::forEach(std::function<void(SlabPool const&)> const& function) {
+    auto& [pools, mtx] = registry();
+    std::scoped_lock const lock(mtx);
+    for (auto const* pool : pools) {
+        function(*pool);
+    }
+}
+
+} // namespace Nebulite::Data
@@ -3,6 +3,7 @@
 
 // Standard library
 #include <cstdint> // NOLINT
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -24,15 +25,23 @@
 namespace Nebulite::Data {
 
 namespace {
-void resolveArgument(std::string& argStr, TaskQueueResult& fullResult, std::string_view const callbackName, Interaction::Context& ctx, Interaction::ContextScope& ctxScope) {
-    // Add binary name if missing
+void addCallbackName(std::string& argStr, std::string_view const callbackName) {
     if (argStr.size() < callbackName.size() + 1 || !argStr.starts_with(callbackName) || argStr[callbackName.size()] != ' ') {
         argStr.insert(0, " ");
         argStr.insert(0, callbackName);
     }
+}
 
-    // Parse
-    Constants::Event const currentResult = ctx.self.parseStr(argStr, ctx, ctxScope);
+void resolveArgument(std::string& argStr, TaskQueue::CompiledTask const* compiled, TaskQueueResult& fullResult, std::string_view const callbackName, Interaction::Context& ctx, Interaction::ContextScope& ctxScope) {
+    Constants::Event currentResult;
+    if (compiled != nullptr && ctx.self.owns(*compiled)) {
+        // Execute without parsing
+        currentResult = ctx.self.execute(*compiled, ctx, ctxScope);
+    } else {
+        // Add binary name if missing, then parse
+        addCallbackName(argStr, callbackName);
+        currentResult = ctx.self.parseStr(argStr, ctx, ctxScope);
+    }
 
     // Check result
     if (currentResult == Constants::Event::error) {
@@ -58,14 +67,14 @@ TaskQueueResult TaskQueue::resolve(Interaction::Context& ctx, Interaction::Conte
                 return fullResult;
 
             // Resolve and remove from list
-            auto argStr = std::move(tasks.list.front());
+            auto task = std::move(tasks.list.front());
             tasks.list.pop_front();
-            resolveArgument(argStr, fullResult, settings.callbackName, ctx, ctxScope);
+            resolveArgument(task.command, task.compiled.get(), fullResult, settings.callbackName, ctx, ctxScope);
         }
     }
     // 2.) Process without popping tasks
     else {
-        for (auto& argStr : tasks.list) {
+        for (auto& task : tasks.list) {
             // Check stop conditions on each iteration,
             // as they might have changed during parsing
             if (fullResult.encounteredCriticalResult && !recover)
@@ -73,8 +82,16 @@ TaskQueueResult TaskQueue::resolve(Interaction::Context& ctx, Interaction::Conte
             if (state.waitCounter > 0)
                 return fullResult;
 
+            // Kept tasks are resolved every time, compile them once
+            if (!task.compileAttempted) {
+                task.compileAttempted = true;
+                if (task.compiled == nullptr) {
+                    task.compiled = compile(task.command, ctx.self);
+                }
+            }
+
             // Resolve, keep in queue
-            resolveArgument(argStr, fullResult, settings.callbackName, ctx, ctxScope);
+            resolveArgument(task.command, task.compiled.get(), fullResult, settings.callbackName, ctx, ctxScope);
         }
     }
     return fullResult;
@@ -125,12 +142,17 @@ void TaskQueue::addScript(std::string_view const filename, Utility::Io::Capture&
 
 void TaskQueue::pushBack(std::string_view const task) {
     std::scoped_lock const lock(tasks.mutex);
-    tasks.list.emplace_back(task);
+    tasks.list.emplace_back(Task{.command = std::string(task)});
+}
+
+void TaskQueue::pushBack(std::string_view const task, std::shared_ptr<CompiledTask const> compiled) {
+    std::scoped_lock const lock(tasks.mutex);
+    tasks.list.emplace_back(Task{.command = std::string(task), .compiled = std::move(compiled)});
 }
 
 void TaskQueue::pushFront(std::string_view const task) {
     std::scoped_lock const lock(tasks.mutex);
-    tasks.list.emplace_front(task);
+    tasks.list.emplace_front(Task{.command = std::string(task)});
 }
 
 void TaskQueue::wait(std::uint64_t const frames) {
@@ -158,4 +180,13 @@ bool TaskQueue::isWaiting() const {
     return state.waitCounter > 0;
 }
 
+std::shared_ptr<TaskQueue::CompiledTask const> TaskQueue::compile(std::string_view const task, Interaction::Execution::Domain const& domain) const {
+    std::string command(task);
+    addCallbackName(command, settings.callbackName);
+    if (auto compiled = domain.compile(command); compiled.has_value()) {
+        return std::make_shared<CompiledTask const>(std::move(compiled.value()));
+    }
+    return nullptr;
+}
+
 } // namespace Nebulite::Data
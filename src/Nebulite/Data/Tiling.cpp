@@ -3,6 +3,7 @@
 
 // Standard library
 #include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
 #include <utility>
@@ -76,6 +77,29 @@ bool Tile::insertIfCostGoalMatches(Core::RenderObject* toAppend) {
     return false;
 }
 
+std::size_t Tile::extractMisplaced(std::vector<Core::RenderObject*>& toMove, TilingInformation const& tilingInfo, TileCoordinate const& coordinate) {
+    // The texture was sized and drawn for the previous tiling, even if no object leaves this tile
+    deleteTexture();
+
+    std::size_t checked = 0;
+    for (auto& batch : batches) {
+        checked += batch.objects.size();
+
+        // Keep the order of the remaining objects, move the misplaced ones to the back
+        auto const misplaced = std::ranges::stable_partition(batch.objects, [&](Core::RenderObject const* obj) {
+            return RenderObjectContainer::getTilePos(obj->getPosition(), tilingInfo) == coordinate;
+        });
+        if (misplaced.empty()) {
+            continue;
+        }
+        std::ranges::move(misplaced, std::back_inserter(toMove));
+        batch.objects.erase(misplaced.begin(), misplaced.end());
+        batch.updateCost();
+    }
+    std::erase_if(batches, [](Batch const& batch) { return batch.objects.empty(); });
+    return checked;
+}
+
 void Tile::update(std::vector<Core::RenderObject*>& toMove, std::vector<Core::RenderObject*>& toDelete, TilingInformation const& tilingInfo, TileCoordinate const& coordinate) {
     for (auto& batch : batches) {
         std::vector<Core::RenderObject*> toMoveLocal;
@@ -5,6 +5,7 @@
 #include <cfloat>
 #include <cmath>
 #include <cstdint> // NOLINT
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -27,6 +28,7 @@
 #include "Nebulite/Data/Document/KeyType.hpp"
 #include "Nebulite/Graphics/Drawcall.hpp"
 #include "Nebulite/Graphics/SdlPrimitive.hpp"
+#include "Nebulite/Graphics/TextCache.hpp"
 #include "Nebulite/Math/Equality.hpp"
 #include "Nebulite/Nebulite.hpp"
 #include "Nebulite/Utility/Coordination/IdGenerator.hpp"
@@ -374,28 +376,22 @@ void Drawcall::initializeText() {
         .a=static_cast<Uint8>(*refs.colorA),
     };
 
-    SDL_Surface* surf = TTF_RenderText_Blended_Wrapped(font, state.text.text.c_str(), 0, state.text.textColor, 0);
-    if (!surf) {
-        texture.capture.error.println("TTF_RenderText_Blended_Wrapped failed: ", SDL_GetError());
-        return;
-    }
-
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(sdl, surf);
-    SDL_DestroySurface(surf);
+    // Composed from cached glyphs, or shared with other drawcalls showing the same string
+    auto tex = Global::instance().getRenderer().getTextCache().render(sdl, font, state.text.text, state.text.textColor, state.text.texture);
     if (!tex) {
-        texture.capture.error.println("SDL_CreateTextureFromSurface failed: ", SDL_GetError());
+        texture.capture.error.println("Failed to render text: ", SDL_GetError());
         return;
     }
 
     float w = 0;
     float h = 0;
-    if (!SDL_GetTextureSize(tex, &w, &h)) {
+    if (!SDL_GetTextureSize(tex.get(), &w, &h)) {
         texture.capture.error.println("SDL_GetTextureSize failed: ", SDL_GetError());
-        SDL_DestroyTexture(tex);
         return;
     }
     setStandardTextRectsIfMissing(w, h, font);
-    texture.setInternalTexture(tex);
+    state.text.texture = std::move(tex);
+    texture.linkExternalTexture(state.text.texture.get());
 }
 
 void Drawcall::initializeCircle() {
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <string>
@@ -153,6 +154,7 @@ bool checkCompletionsForCommonPrefix(std::string_view const input, std::vector<s
 }
 
 void historyScrollingCallback(ImGuiInputTextCallbackData* data, ConsoleState* state) {
+    auto const historyLock = state->capture->lockHistory();
     auto const historySize = state->capture->getHistory().size();
     if (data->EventKey == ImGuiKey_UpArrow) {
         std::size_t newIndex = state->historyIndex;
@@ -420,6 +422,7 @@ void ImguiHelper::renderDomainConsole(Interaction::Context& ctx, Interaction::Co
     ImGui::BeginChild("ConsoleOutput", ImVec2(0, -ImGui::GetFrameHeightWithSpacing()), true);
 
     ImGui::PushTextWrapPos(0.0f); // wrap at window/child width
+    auto historyLock = capture.lockHistory();
     for (auto const& [content, type] : capture.getHistory()){
         std::string contentFull;
         switch (type) {
@@ -443,6 +446,7 @@ void ImguiHelper::renderDomainConsole(Interaction::Context& ctx, Interaction::Co
         ImGui::TextUnformatted(contentFull.c_str());
         ImGui::PopStyleColor();
     }
+    historyLock.unlock();
     ImGui::PopTextWrapPos();
 
     // Auto-scroll
@@ -4,6 +4,7 @@
 // External
 #include <absl/container/flat_hash_map.h>
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint> // NOLINT
 #include <functional>
@@ -309,7 +310,9 @@ void RmlInterface::processRmlUiEvent(SDL_Event const& event) const {
     }
 }
 
-void RmlInterface::update(int const mousePositionX, int const mousePositionY) const {
+void RmlInterface::update(int const mousePositionX, int const mousePositionY) {
+    auto const start = std::chrono::steady_clock::now();
+
     // Update SystemInterface
     systemInterface->update(mousePositionX, mousePositionY);
 
@@ -322,6 +325,12 @@ void RmlInterface::update(int const mousePositionX, int const mousePositionY) co
         module->update();
     }
     context->Update();
+
+    updateStats = {};
+    for (auto const& module : modules) {
+        module->addUpdateStats(updateStats);
+    }
+    updateStats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 }
 
 void RmlInterface::postRenderUpdate() const {
@@ -0,0 +1,344 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// External
+#include <SDL3/SDL_pixels.h>
+#include <SDL3/SDL_properties.h>
+#include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_render.h>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_surface.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+
+// Nebulite
+#include "Nebulite/Graphics/TextCache.hpp"
+
+//------------------------------------------
+namespace Nebulite::Graphics {
+
+namespace {
+TextCache::TexturePtr makeShared(SDL_Texture* texture) {
+    return {texture, SDL_DestroyTexture};
+}
+
+std::uint32_t packColor(SDL_Color const& color) {
+    return static_cast<std::uint32_t>(color.r) << 24 | static_cast<std::uint32_t>(color.g) << 16 | static_cast<std::uint32_t>(color.b) << 8 | color.a;
+}
+
+bool isTargetTexture(SDL_Texture* texture) {
+    return SDL_GetNumberProperty(SDL_GetTextureProperties(texture), SDL_PROP_TEXTURE_ACCESS_NUMBER, -1) == SDL_TEXTUREACCESS_TARGET;
+}
+} // namespace
+
+/**
+ * @class Nebulite::Graphics::TextCache::GlyphAtlas
+ * @brief Glyphs of a single font and size, shelf-packed into texture pages.
+ */
+class TextCache::GlyphAtlas {
+public:
+    /**
+     * @struct Glyph
+     * @brief Location and metrics of a rasterized glyph.
+     */
+    struct Glyph {
+        SDL_Texture* page = nullptr; // nullptr for glyphs without pixels, e.g. spaces
+        SDL_FRect src{};
+        int offsetX = 0; // Rendered glyphs start left of the pen for negative bearings
+        int advance = 0;
+    };
+
+    GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font, Stats& stats) : renderer(renderer), font(font), stats(stats) {}
+
+    ~GlyphAtlas() {
+        for (auto* page : pages) {
+            SDL_DestroyTexture(page);
+        }
+    }
+
+    GlyphAtlas(GlyphAtlas const&) = delete;
+    GlyphAtlas& operator=(GlyphAtlas const&) = delete;
+    GlyphAtlas(GlyphAtlas&&) = delete;
+    GlyphAtlas& operator=(GlyphAtlas&&) = delete;
+
+    /**
+     * @brief Gets a glyph, rasterizing it on first use.
+     * @return The glyph, or nullptr if it could not be added to the atlas.
+     */
+    Glyph const* get(Uint32 const codepoint) {
+        if (auto const it = glyphs.find(codepoint); it != glyphs.end()) [[likely]] {
+            return it->second ? &*it->second : nullptr;
+        }
+        auto const& glyph = glyphs.try_emplace(codepoint, rasterize(codepoint)).first->second;
+        return glyph ? &*glyph : nullptr;
+    }
+
+    /**
+     * @brief Applies the text color to all pages, before drawing glyphs from them.
+     */
+    void setColor(SDL_Color const& color) const {
+        for (auto* page : pages) {
+            SDL_SetTextureColorMod(page, color.r, color.g, color.b);
+            SDL_SetTextureAlphaMod(page, color.a);
+        }
+    }
+
+private:
+    std::optional<Glyph> rasterize(Uint32 const codepoint) {
+        Glyph glyph;
+        int minX = 0;
+        if (!TTF_GetGlyphMetrics(font, codepoint, &minX, nullptr, nullptr, nullptr, &glyph.advance)) {
+            return std::nullopt;
+        }
+        glyph.offsetX = std::min(minX, 0);
+
+        // Rendered in white, so the color can be applied as a color mod
+        SDL_Surface* rendered = TTF_RenderGlyph_Blended(font, codepoint, SDL_Color{.r=255,.g=255,.b=255,.a=255});
+        if (rendered == nullptr) {
+            return std::nullopt;
+        }
+        SDL_Surface* surface = rendered->format == SDL_PIXELFORMAT_ARGB8888 ? rendered : SDL_ConvertSurface(rendered, SDL_PIXELFORMAT_ARGB8888);
+        if (surface != rendered) {
+            SDL_DestroySurface(rendered);
+        }
+        if (surface == nullptr) {
+            return std::nullopt;
+        }
+        if (surface->w == 0 || surface->h == 0) {
+            SDL_DestroySurface(surface);
+            return glyph;
+        }
+        if (surface->w > atlasPageSize || surface->h > atlasPageSize || !reserve(surface->w, surface->h)) {
+            SDL_DestroySurface(surface);
+            return std::nullopt;
+        }
+
+        SDL_Rect const dst{.x=cursorX, .y=cursorY, .w=surface->w, .h=surface->h};
+        bool const uploaded = SDL_UpdateTexture(pages.back(), &dst, surface->pixels, surface->pitch);
+        SDL_DestroySurface(surface);
+        if (!uploaded) {
+            return std::nullopt;
+        }
+        glyph.page = pages.back();
+        glyph.src = {.x=static_cast<float>(dst.x), .y=static_cast<float>(dst.y), .w=static_cast<float>(dst.w), .h=static_cast<float>(dst.h)};
+
+        // One pixel of padding, so neighbours never bleed into each other
+        cursorX += dst.w + 1;
+        shelfHeight = std::max(shelfHeight, dst.h);
+        stats.glyphs++;
+        return glyph;
+    }
+
+    /**
+     * @brief Moves the cursor to a free area of the given size, opening a new shelf or page if needed.
+     */
+    bool reserve(int const w, int const h) {
+        if (!pages.empty() && cursorX + w > atlasPageSize) {
+            cursorX = 0;
+            cursorY += shelfHeight + 1;
+            shelfHeight = 0;
+        }
+        if (pages.empty() || cursorY + h > atlasPageSize) {
+            SDL_Texture* page = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, atlasPageSize, atlasPageSize);
+            if (page == nullptr) {
+                return false;
+            }
+            SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+            SDL_SetTextureScaleMode(page, SDL_SCALEMODE_NEAREST);
+            pages.push_back(page);
+            cursorX = 0;
+            cursorY = 0;
+            shelfHeight = 0;
+            stats.atlasPages++;
+        }
+        return true;
+    }
+
+    SDL_Renderer* renderer;
+    TTF_Font* font;
+    Stats& stats;
+
+    std::vector<SDL_Texture*> pages; // Only the last page has free space
+    int cursorX = 0;
+    int cursorY = 0;
+    int shelfHeight = 0;
+
+    absl::flat_hash_map<Uint32, std::optional<Glyph>> glyphs; // std::nullopt for glyphs that failed to rasterize
+};
+
+//------------------------------------------
+// Special member functions
+
+TextCache::TextCache() = default;
+
+TextCache::~TextCache() = default;
+
+//------------------------------------------
+// Public methods
+
+TextCache::TexturePtr TextCache::render(SDL_Renderer* renderer, TTF_Font* font, std::string_view const text, SDL_Color const color, TexturePtr const& previous) {
+    float const size = TTF_GetFontSize(font);
+    Key key{.font=font, .size=size, .color=packColor(color), .text=std::string(text)};
+    if (auto const it = lruIndex.find(key); it != lruIndex.end()) {
+        lru.splice(lru.begin(), lru, it->second);
+        stats.hits++;
+        return it->second->second;
+    }
+
+    auto texture = compose(renderer, atlasFor(renderer, font, size), font, text, color, previous);
+    if (texture == nullptr) {
+        texture = rasterize(renderer, font, text, color);
+    }
+    if (texture != nullptr && admit(key)) {
+        insert(std::move(key), texture);
+    }
+    return texture;
+}
+
+void TextCache::clear() {
+    lruIndex.clear();
+    lru.clear();
+    requestedOnce.clear();
+    atlases.clear();
+}
+
+//------------------------------------------
+// Private methods
+
+TextCache::TexturePtr TextCache::compose(SDL_Renderer* renderer, GlyphAtlas& atlas, TTF_Font* font, std::string_view const text, SDL_Color const color, TexturePtr const& previous) {
+    // Layout
+    layout.clear();
+    int const lineSkip = TTF_GetFontLineSkip(font);
+    float penX = 0.0f;
+    float penY = 0.0f;
+    float width = 0.0f;
+    Uint32 previousCodepoint = 0;
+    char const* cursor = text.data();
+    std::size_t remaining = text.size();
+    while (remaining > 0) {
+        Uint32 const codepoint = SDL_StepUTF8(&cursor, &remaining);
+        if (codepoint == '\n') {
+            penX = 0.0f;
+            penY += static_cast<float>(lineSkip);
+            previousCodepoint = 0;
+            continue;
+        }
+        if (int kerning = 0; previousCodepoint != 0 && TTF_GetGlyphKerning(font, previousCodepoint, codepoint, &kerning)) {
+            penX += static_cast<float>(kerning);
+        }
+        auto const* glyph = atlas.get(codepoint);
+        if (glyph == nullptr) {
+            return nullptr;
+        }
+        if (glyph->page != nullptr) {
+            float const x = penX + static_cast<float>(glyph->offsetX);
+            layout.push_back({.page=glyph->page, .src=glyph->src, .dst={.x=x, .y=penY, .w=glyph->src.w, .h=glyph->src.h}});
+            width = std::max(width, x + glyph->src.w);
+        }
+        penX += static_cast<float>(glyph->advance);
+        width = std::max(width, penX);
+        previousCodepoint = codepoint;
+    }
+    int const w = std::max(1, static_cast<int>(std::ceil(width)));
+    int const h = std::max(1, static_cast<int>(penY) + TTF_GetFontHeight(font));
+
+    // Draw into the previous texture if only the caller holds it
+    TexturePtr target;
+    if (previous != nullptr && previous.use_count() == 1 && isTargetTexture(previous.get())) {
+        float pw = 0.0f;
+        float ph = 0.0f;
+        if (SDL_GetTextureSize(previous.get(), &pw, &ph) && static_cast<int>(pw) == w && static_cast<int>(ph) == h) {
+            target = previous;
+            stats.reused++;
+        }
+    }
+    if (target == nullptr) {
+        SDL_Texture* created = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, w, h);
+        if (created == nullptr) {
+            return nullptr;
+        }
+        // Glyphs are blended onto a transparent target, so its content is premultiplied
+        SDL_SetTextureBlendMode(created, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        target = makeShared(created);
+    }
+
+    // Draw
+    auto* const currentTarget = SDL_GetRenderTarget(renderer);
+    Uint8 r = 0;
+    Uint8 g = 0;
+    Uint8 b = 0;
+    Uint8 a = 0;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    if (!SDL_SetRenderTarget(renderer, target.get())) {
+        return nullptr;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    atlas.setColor(color);
+    for (auto const& [page, src, dst] : layout) {
+        SDL_RenderTexture(renderer, page, &src, &dst);
+    }
+    SDL_SetRenderTarget(renderer, currentTarget);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    stats.composed++;
+    return target;
+}
+
+TextCache::TexturePtr TextCache::rasterize(SDL_Renderer* renderer, TTF_Font* font, std::string_view const text, SDL_Color const color) {
+    SDL_Surface* surface = TTF_RenderText_Blended_Wrapped(font, text.data(), text.size(), color, 0);
+    if (surface == nullptr) {
+        return nullptr;
+    }
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    if (texture == nullptr) {
+        return nullptr;
+    }
+    stats.rasterized++;
+    return makeShared(texture);
+}
+
+TextCache::GlyphAtlas& TextCache::atlasFor(SDL_Renderer* renderer, TTF_Font* font, float const size) {
+    auto& atlas = atlases[std::pair(font, size)];
+    if (atlas == nullptr) [[unlikely]] {
+        atlas = std::make_unique<GlyphAtlas>(renderer, font, stats);
+    }
+    return *atlas;
+}
+
+bool TextCache::admit(Key const& key) {
+    auto const hash = absl::Hash<Key>{}(key);
+    if (requestedOnce.erase(hash) > 0) {
+        return true;
+    }
+    // Bounded, labels changing every update would otherwise grow it forever
+    if (requestedOnce.size() >= 4 * lruCapacity) {
+        requestedOnce.clear();
+    }
+    requestedOnce.insert(hash);
+    return false;
+}
+
+void TextCache::insert(Key&& key, TexturePtr const& texture) {
+    if (lru.size() >= lruCapacity) {
+        lruIndex.erase(lru.back().first);
+        lru.pop_back();
+    }
+    lru.emplace_front(std::move(key), texture);
+    lruIndex.emplace(lru.front().first, lru.begin());
+}
+
+} // namespace Nebulite::Graphics
@@ -146,6 +146,14 @@ Constants::Event Domain::parse(std::vector<std::string> const& args, Context& ct
     return funcTree->parse(args, ctx, ctxScope);
 }
 
+std::optional<DomainTree::CompiledCommand> Domain::compile(std::string_view const cmd) const {
+    return funcTree->compile(cmd);
+}
+
+Constants::Event Domain::execute(DomainTree::CompiledCommand const& compiled, Context& ctx, ContextScope& ctxScope) const {
+    return funcTree->execute(compiled, ctx, ctxScope);
+}
+
 std::unique_lock<std::recursive_mutex> Domain::lockDocument() const {
     return domainScope.lock();
 }
@@ -166,7 +174,22 @@ std::vector<std::string> Domain::stringToDeserializeTokens(std::string_view cons
     return tokens;
 }
 
+namespace {
+/**
+ * @brief Checks if a command argument is parsed as-is, without whitespace or quotes to be handled by the FuncTree.
+ * @param arg The argument to check.
+ * @return True if the argument is non-empty and plain, false otherwise.
+ */
+bool isPlainArgument(std::string_view const arg) {
+    return !arg.empty() && arg.find_first_of(" \t\r\n\"'") == std::string_view::npos;
+}
+} // namespace
+
 void Domain::baseDeserialization(std::string const& serialOrLinkWithCommands) {
+    applyDeserializeCommands(deserializeDocument(serialOrLinkWithCommands));
+}
+
+std::vector<std::string> Domain::deserializeDocument(std::string const& serialOrLinkWithCommands) {
     std::vector<std::string> tokens;
 
     //------------------------------------------
@@ -202,7 +225,7 @@ void Domain::baseDeserialization(std::string const& serialOrLinkWithCommands) {
         // Split the input into tokens
         tokens = stringToDeserializeTokens(serialOrLinkWithCommands);
         if (tokens.empty()) {
-            return;
+            return tokens;
         }
 
         //------------------------------------------
@@ -210,11 +233,17 @@ void Domain::baseDeserialization(std::string const& serialOrLinkWithCommands) {
 
         // Pass only the serial/link part to deserialize
         // Argument parsing happens at the higher level
+        // Linked files are copied from their parsed form in the document cache
         auto const& serialOrLink = tokens[0];
-        domainScope.deserialize(serialOrLink);
+        if (Data::Json::isJsonOrJsonc(serialOrLink) || !Global::instance().getDocCache().copyDocInto(serialOrLink, domainScope)) {
+            domainScope.deserialize(serialOrLink);
+        }
         tokens.erase(tokens.begin()); // Remove the first token (path or serialized JSON)
     }
+    return tokens;
+}
 
+void Domain::applyDeserializeCommands(std::vector<std::string> const& tokens) {
     //------------------------------------------
     // Domain-Serialization-Piping
     for (auto const& token : tokens) {
@@ -224,10 +253,18 @@ void Domain::baseDeserialization(std::string const& serialOrLinkWithCommands) {
         // Legacy: Handle key=value pairs
         std::string callStr;
         if (auto const pos = token.find('='); pos != std::string::npos) {
+            // Plain values are set directly, equivalent to the set command
+            std::string_view const key(token.data(), pos);
+            std::string_view const value = std::string_view(token).substr(pos + 1);
+            if (isPlainArgument(key) && isPlainArgument(value)) {
+                auto lock = domainScope.lock();
+                domainScope.set(domainScope.getRootScope().addMember(key), std::string(value));
+                continue;
+            }
+
             // Handle transformation (key=value)
             auto keyAndValue = std::string(token);
-            if (pos != std::string::npos)
-                keyAndValue[pos] = ' ';
+            keyAndValue[pos] = ' ';
 
             // New implementation through functioncall
             callStr = std::string(__FUNCTION__) + " set " + keyAndValue;
@@ -7,6 +7,7 @@
 #include <memory>
 #include <ranges>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 // Nebulite
@@ -48,6 +49,14 @@ void Tasks::addTask(std::string_view const name, std::string_view const queueNam
     tasks[queueName]->pushBack(name);
 }
 
+void Tasks::addTask(std::string_view const name, std::shared_ptr<Data::TaskQueue::CompiledTask const> compiled, std::string_view const queueName) {
+    tasks[queueName]->pushBack(name, std::move(compiled));
+}
+
+std::shared_ptr<Data::TaskQueue::CompiledTask const> Tasks::compileTask(std::string_view const name, Domain const& domain, std::string_view const queueName) {
+    return tasks[queueName]->compile(name, domain);
+}
+
 void Tasks::addScript(std::string_view const filename, Utility::Io::Capture& capture) {
     tasks[StandardTasks::script]->addScript(filename, capture);
 }
@@ -11,6 +11,7 @@
 #include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Interaction/Invoke.hpp"
 #include "Nebulite/Interaction/Rules/Ruleset.hpp"
+#include "Nebulite/Utility/Coordination/TaskScheduler.hpp"
 #include "Nebulite/Utility/Generate.hpp"
 
 //------------------------------------------
@@ -21,18 +22,11 @@ namespace Nebulite::Interaction {
 
 Invoke::Invoke()
     : worker(Utility::Generate::array<ContainerType, Constants::ThreadSettings::Maximum::invokeWorkerCount>([&](std::size_t const threadIndex) {
-        return ContainerType(stopFlag, threadIndex, activeWorkerCount);
+        return ContainerType(threadIndex, activeWorkerCount);
     }))
     , activeWorkers(worker | std::views::take(activeWorkerCount))
-    , stopFlag(false)
 {}
 
-Invoke::~Invoke() {
-    // Signal threads to stop and finish
-    // Stopping is handled in BroadCastListenPairs destructor
-    stopFlag = true;
-}
-
 //------------------------------------------
 // Interactions
 
@@ -45,11 +39,12 @@ void Invoke::broadcast(std::shared_ptr<Rules::Ruleset>&& entry) {
 }
 
 void Invoke::listen(std::shared_ptr<Rules::Listener> const& listener) {
-    // Listening happens on all threads
-    for (auto& w : activeWorkers) {
-        auto listenerCopy{listener}; // Copy the shared_ptr for each thread to ensure proper reference counting
-        w.listen(std::move(listenerCopy));
-    }
+    // Listeners are shared by all threads
+    subscriptions.listenOnce(listener);
+}
+
+void Invoke::subscribe(std::shared_ptr<Rules::Listener> const& listener) {
+    subscriptions.subscribe(listener);
 }
 
 //------------------------------------------
@@ -58,15 +53,13 @@ void Invoke::listen(std::shared_ptr<Rules::Listener> const& listener) {
 void Invoke::update() {
     activeWorkers = worker | std::views::take(activeWorkerCount);
 
-    // Signal all worker threads to start processing
-    for (auto& w : activeWorkers) {
-        w.startWork();
-    }
+    // Gather listeners activated since the last update, read-only while processing
+    subscriptions.prepare();
 
-    // Wait for all threads to finish processing
-    for (auto& w : activeWorkers) {
-        w.waitForWorkFinished();
-    }
+    // Each container is a job of the shared scheduler, idle threads steal containers that are left over
+    Utility::Coordination::TaskScheduler::instance().parallelFor(activeWorkerCount, [this](std::size_t const idx) {
+        worker[idx].process(subscriptions);
+    });
 
     // Prepare work for the next frame
     for (auto& w : activeWorkers) {
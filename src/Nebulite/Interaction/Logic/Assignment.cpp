@@ -83,6 +83,19 @@ bool Assignment::parse(std::string_view const str) {
     return true;
 }
 
+Assignment Assignment::clone() const {
+    Assignment copy;
+    copy.onType = onType;
+    copy.operation = operation;
+    if (key != nullptr) {
+        copy.key = std::make_unique<Expression>(key->clone());
+    }
+    if (expression != nullptr) {
+        copy.expression = std::make_unique<Expression>(expression->clone());
+    }
+    return copy;
+}
+
 void Assignment::optimize(ContextScope const& contextScope){
     // Supported operations for optimizations
      std::array constexpr numericOperations = {
@@ -0,0 +1,465 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+// External
+#include <tinyexpr.h>
+
+// Nebulite
+#include "Nebulite/Interaction/Logic/Bytecode.hpp"
+#include "Nebulite/Math/ExpressionPrimitives.hpp"
+
+//------------------------------------------
+namespace Nebulite::Interaction::Logic {
+
+namespace {
+
+//------------------------------------------
+// tinyexpr internals, see tinyexpr.c
+
+int constexpr teConstant = 1;
+
+int typeMask(int const type) {
+    return type & 0x1F;
+}
+
+int arity(int const type) {
+    return (type & (TE_FUNCTION0 | TE_CLOSURE0)) != 0 ? type & 0x07 : 0;
+}
+
+bool isPure(int const type) {
+    return (type & TE_FLAG_PURE) != 0;
+}
+
+te_expr const* parameter(te_expr const* expression, int const index) {
+    return static_cast<te_expr const*>(expression->parameters[index]); // NOLINT
+}
+
+/**
+ * @brief Pointers to the operator functions of tinyexpr.
+ * @details Those are internal to tinyexpr, so they are recovered by compiling small probe expressions.
+ */
+struct TinyExprOperators {
+    void const* add = nullptr;
+    void const* subtract = nullptr;
+    void const* multiply = nullptr;
+    void const* divide = nullptr;
+    void const* modulo = nullptr;
+    void const* power = nullptr;
+    void const* negate = nullptr;
+    void const* comma = nullptr;
+
+    TinyExprOperators() {
+        static double a = 0.0;
+        static double b = 0.0;
+        std::array<te_variable, 2> const variables = {{
+            {.name = "a", .address = &a, .type = TE_VARIABLE, .context = nullptr},
+            {.name = "b", .address = &b, .type = TE_VARIABLE, .context = nullptr},
+        }};
+        auto probe = [&](char const* expression) -> void const* {
+            int error = 0;
+            te_expr* compiled = te_compile(expression, variables.data(), static_cast<int>(variables.size()), &error);
+            void const* function = compiled != nullptr && typeMask(compiled->type) >= TE_FUNCTION0 ? compiled->function : nullptr;
+            te_free(compiled);
+            return function;
+        };
+        add = probe("a+b");
+        subtract = probe("a-b");
+        multiply = probe("a*b");
+        divide = probe("a/b");
+        modulo = probe("a%b");
+        power = probe("a^b");
+        negate = probe("-a");
+        comma = probe("a,b");
+    }
+
+    static TinyExprOperators const& instance() {
+        static TinyExprOperators const operators;
+        return operators;
+    }
+};
+
+bool isTruthy(double const value) {
+    return std::fabs(value) > std::numeric_limits<double>::epsilon();
+}
+
+using Function0 = double (*)();
+using Function1 = double (*)(double);
+using Function2 = double (*)(double, double);
+using Function3 = double (*)(double, double, double);
+using Function4 = double (*)(double, double, double, double);
+using Function5 = double (*)(double, double, double, double, double);
+using Function6 = double (*)(double, double, double, double, double, double);
+using Function7 = double (*)(double, double, double, double, double, double, double);
+
+template<typename Function>
+Function as(void const* function) {
+    return reinterpret_cast<Function>(const_cast<void*>(function)); // NOLINT
+}
+
+} // namespace
+
+//------------------------------------------
+// Compiler
+
+/**
+ * @brief Converts a te_expr tree into an intermediate tree, simplifies it, then emits instructions.
+ */
+class Bytecode::Compiler {
+public:
+    explicit Compiler(std::span<double const> const& s) : slots(s) {}
+
+    std::optional<Bytecode> compile(te_expr const* expression) {
+        auto const root = convert(expression);
+        if (!root.has_value()) {
+            return std::nullopt;
+        }
+        simplify(*root);
+
+        Bytecode bytecode;
+        if (!emit(*root, 0, bytecode.instructions)) {
+            return std::nullopt;
+        }
+        return bytecode;
+    }
+
+private:
+    static std::uint32_t constexpr noSlot = std::numeric_limits<std::uint32_t>::max();
+
+    struct Node {
+        OpCode op = OpCode::constant;
+        bool pure = true;
+        double constant = 0.0;
+        double const* address = nullptr;
+        std::uint32_t slot = noSlot;
+        void const* function = nullptr;
+        std::vector<std::size_t> arguments;
+    };
+
+    std::span<double const> slots;
+
+    std::vector<Node> nodes;
+
+    std::size_t addConstant(double const value) {
+        nodes.push_back(Node{.op = OpCode::constant, .constant = value});
+        return nodes.size() - 1;
+    }
+
+    [[nodiscard]] bool isConstant(std::size_t const node) const {
+        return nodes[node].op == OpCode::constant;
+    }
+
+    [[nodiscard]] bool isConstantTruthy(std::size_t const node, bool const truthy) const {
+        return isConstant(node) && isTruthy(nodes[node].constant) == truthy;
+    }
+
+    //------------------------------------------
+    // Conversion
+
+    [[nodiscard]] OpCode operationOf(void const* function, int const argumentCount) const {
+        auto const& operators = TinyExprOperators::instance();
+        if (argumentCount == 1) {
+            if (function == operators.negate) return OpCode::negate;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::logicalNot)) return OpCode::logicalNot;
+        }
+        if (argumentCount == 2) {
+            if (function == operators.add) return OpCode::add;
+            if (function == operators.subtract) return OpCode::subtract;
+            if (function == operators.multiply) return OpCode::multiply;
+            if (function == operators.divide) return OpCode::divide;
+            if (function == operators.modulo) return OpCode::modulo;
+            if (function == operators.power) return OpCode::power;
+            if (function == operators.comma) return OpCode::comma;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::gt)) return OpCode::greater;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::lt)) return OpCode::less;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::geq)) return OpCode::greaterEqual;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::leq)) return OpCode::lessEqual;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::eq)) return OpCode::equal;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::neq)) return OpCode::notEqual;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::logicalAnd)) return OpCode::logicalAnd;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::logicalOr)) return OpCode::logicalOr;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::min)) return OpCode::minimum;
+            if (function == reinterpret_cast<void const*>(&Math::ExpressionPrimitives::max)) return OpCode::maximum;
+        }
+        return static_cast<OpCode>(static_cast<std::uint8_t>(OpCode::call0) + argumentCount);
+    }
+
+    std::optional<std::size_t> convert(te_expr const* expression) {
+        int const type = typeMask(expression->type);
+        if (type == teConstant) {
+            return addConstant(expression->value);
+        }
+        if (type == TE_VARIABLE) {
+            Node node{.op = OpCode::address, .address = expression->bound};
+            if (!slots.empty() && expression->bound >= slots.data() && expression->bound < slots.data() + slots.size()) {
+                node.op = OpCode::variable;
+                node.slot = static_cast<std::uint32_t>(expression->bound - slots.data());
+            }
+            nodes.push_back(node);
+            return nodes.size() - 1;
+        }
+        if (type >= TE_CLOSURE0) {
+            return std::nullopt; // Not used by Nebulite, left to tinyexpr
+        }
+
+        Node node{
+            .op = operationOf(expression->function, arity(expression->type)),
+            .pure = isPure(expression->type),
+            .function = expression->function,
+        };
+        for (int i = 0; i < arity(expression->type); i++) {
+            auto const argument = convert(parameter(expression, i));
+            if (!argument.has_value()) {
+                return std::nullopt;
+            }
+            node.arguments.push_back(*argument);
+        }
+        nodes.push_back(std::move(node));
+        return nodes.size() - 1;
+    }
+
+    //------------------------------------------
+    // Simplification
+
+    /**
+     * @brief Checks if a subtree can be removed or evaluated early without changing any observable behavior.
+     */
+    [[nodiscard]] bool isPureTree(std::size_t const node) const {
+        return nodes[node].pure && std::ranges::all_of(nodes[node].arguments, [this](std::size_t const argument) {
+            return isPureTree(argument);
+        });
+    }
+
+    void replace(std::size_t const node, std::size_t const with) {
+        nodes[node] = nodes[with];
+    }
+
+    void simplify(std::size_t const node) {
+        for (std::size_t const argument : nodes[node].arguments) {
+            simplify(argument);
+        }
+        Node const& current = nodes[node];
+        if (current.op == OpCode::constant || current.op == OpCode::variable || current.op == OpCode::address) {
+            return;
+        }
+
+        // Constant folding, using the same code path as on evaluation
+        if (current.pure && std::ranges::all_of(current.arguments, [this](std::size_t const argument) { return isConstant(argument); })) {
+            Bytecode folded;
+            if (emit(node, 0, folded.instructions)) {
+                double const value = folded.evaluate();
+                nodes[node] = Node{.op = OpCode::constant, .constant = value};
+            }
+            return;
+        }
+
+        // Dead branches: operands that cannot affect the result
+        if (current.arguments.size() != 2) {
+            return;
+        }
+        std::size_t const lhs = current.arguments[0];
+        std::size_t const rhs = current.arguments[1];
+        switch (current.op) {
+        case OpCode::logicalAnd:
+            if ((isConstantTruthy(lhs, false) && isPureTree(rhs)) || (isConstantTruthy(rhs, false) && isPureTree(lhs))) {
+                nodes[node] = Node{.op = OpCode::constant, .constant = 0.0};
+            }
+            break;
+        case OpCode::logicalOr:
+            if ((isConstantTruthy(lhs, true) && isPureTree(rhs)) || (isConstantTruthy(rhs, true) && isPureTree(lhs))) {
+                nodes[node] = Node{.op = OpCode::constant, .constant = 1.0};
+            }
+            break;
+        case OpCode::comma:
+            if (isPureTree(lhs)) {
+                replace(node, rhs);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    //------------------------------------------
+    // Emission
+
+    /**
+     * @brief Emits the instructions computing a node into the given register.
+     * @details Registers above the target are used for intermediate results.
+     * @return false if the register file is too small.
+     */
+    bool emit(std::size_t const node, std::size_t const target, std::vector<Instruction>& instructions) const {
+        if (target >= maxRegisters) {
+            return false;
+        }
+        Node const& current = nodes[node];
+        Instruction instruction{
+            .op = current.op,
+            .dst = static_cast<std::uint8_t>(target),
+            .lhs = static_cast<std::uint8_t>(target),
+            .rhs = static_cast<std::uint8_t>(std::min(target + 1, maxRegisters - 1)),
+            .slot = current.slot,
+            .constant = current.constant,
+        };
+        switch (current.op) {
+        case OpCode::constant:
+            break;
+        case OpCode::variable:
+        case OpCode::address:
+            instruction.address = current.address;
+            break;
+        default:
+            instruction.function = current.function;
+            for (std::size_t i = 0; i < current.arguments.size(); i++) {
+                if (!emit(current.arguments[i], target + i, instructions)) {
+                    return false;
+                }
+            }
+            break;
+        }
+        instructions.push_back(instruction);
+        return true;
+    }
+};
+
+//------------------------------------------
+// Bytecode
+
+std::optional<Bytecode> Bytecode::compile(te_expr const* expression, std::span<double const> const slots) {
+    if (expression == nullptr) {
+        return std::nullopt;
+    }
+    return Compiler(slots).compile(expression);
+}
+
+Bytecode Bytecode::rebind(std::span<double const> const slots) const {
+    Bytecode bytecode = *this;
+    for (auto& instruction : bytecode.instructions) {
+        if (instruction.op == OpCode::variable) {
+            instruction.address = slots.data() + instruction.slot;
+        }
+    }
+    return bytecode;
+}
+
+double Bytecode::evaluate() const noexcept {
+    return run<false>(nullptr);
+}
+
+double Bytecode::evaluate(std::span<double const* const> const slots) const noexcept {
+    return run<true>(slots.data());
+}
+
+void Bytecode::evaluateLanes(std::span<double const* const> const slots, std::size_t const slotCount, std::span<double, laneCount> const results) const noexcept {
+    using Lanes = std::array<double, laneCount>;
+    alignas(sizeof(Lanes)) std::array<Lanes, maxRegisters> r; // NOLINT: every register is written before it is read
+
+    // Applies an operation to all lanes, kept as a plain loop to be vectorized
+    auto const lanes = [](auto const& operation) {
+        for (std::size_t l = 0; l < laneCount; l++) {
+            operation(l);
+        }
+    };
+
+    for (auto const& in : instructions) {
+        Lanes& d = r[in.dst];
+        Lanes const& a = r[in.lhs];
+        Lanes const& b = r[in.rhs];
+        switch (in.op) {
+        case OpCode::constant:     lanes([&](std::size_t const l) { d[l] = in.constant; }); break;
+        case OpCode::variable:     lanes([&](std::size_t const l) { d[l] = *slots[l * slotCount + in.slot]; }); break;
+        case OpCode::address:      lanes([&](std::size_t const l) { d[l] = *in.address; }); break;
+        case OpCode::add:          lanes([&](std::size_t const l) { d[l] = a[l] + b[l]; }); break;
+        case OpCode::subtract:     lanes([&](std::size_t const l) { d[l] = a[l] - b[l]; }); break;
+        case OpCode::multiply:     lanes([&](std::size_t const l) { d[l] = a[l] * b[l]; }); break;
+        case OpCode::divide:       lanes([&](std::size_t const l) { d[l] = a[l] / b[l]; }); break;
+        case OpCode::modulo:       lanes([&](std::size_t const l) { d[l] = std::fmod(a[l], b[l]); }); break;
+        case OpCode::power:        lanes([&](std::size_t const l) { d[l] = std::pow(a[l], b[l]); }); break;
+        case OpCode::negate:       lanes([&](std::size_t const l) { d[l] = -a[l]; }); break;
+        case OpCode::comma:        lanes([&](std::size_t const l) { d[l] = b[l]; }); break;
+        case OpCode::greater:      lanes([&](std::size_t const l) { d[l] = a[l] > b[l]; }); break;
+        case OpCode::less:         lanes([&](std::size_t const l) { d[l] = a[l] < b[l]; }); break;
+        case OpCode::greaterEqual: lanes([&](std::size_t const l) { d[l] = a[l] >= b[l]; }); break;
+        case OpCode::lessEqual:    lanes([&](std::size_t const l) { d[l] = a[l] <= b[l]; }); break;
+        case OpCode::equal:        lanes([&](std::size_t const l) { d[l] = std::fabs(a[l] - b[l]) < std::numeric_limits<double>::epsilon(); }); break;
+        case OpCode::notEqual:     lanes([&](std::size_t const l) { d[l] = std::fabs(a[l] - b[l]) > std::numeric_limits<double>::epsilon(); }); break;
+        case OpCode::logicalNot:   lanes([&](std::size_t const l) { d[l] = !isTruthy(a[l]); }); break;
+        case OpCode::logicalAnd:   lanes([&](std::size_t const l) { d[l] = isTruthy(a[l]) & isTruthy(b[l]); }); break;
+        case OpCode::logicalOr:    lanes([&](std::size_t const l) { d[l] = isTruthy(a[l]) | isTruthy(b[l]); }); break;
+        case OpCode::minimum:      lanes([&](std::size_t const l) { d[l] = std::min(a[l], b[l]); }); break;
+        case OpCode::maximum:      lanes([&](std::size_t const l) { d[l] = std::max(a[l], b[l]); }); break;
+        case OpCode::call0: lanes([&](std::size_t const l) { d[l] = as<Function0>(in.function)(); }); break;
+        case OpCode::call1: lanes([&](std::size_t const l) { d[l] = as<Function1>(in.function)(a[l]); }); break;
+        case OpCode::call2: lanes([&](std::size_t const l) { d[l] = as<Function2>(in.function)(a[l], r[in.lhs + 1][l]); }); break;
+        case OpCode::call3: lanes([&](std::size_t const l) { d[l] = as<Function3>(in.function)(a[l], r[in.lhs + 1][l], r[in.lhs + 2][l]); }); break;
+        case OpCode::call4: lanes([&](std::size_t const l) { d[l] = as<Function4>(in.function)(a[l], r[in.lhs + 1][l], r[in.lhs + 2][l], r[in.lhs + 3][l]); }); break;
+        case OpCode::call5: lanes([&](std::size_t const l) { d[l] = as<Function5>(in.function)(a[l], r[in.lhs + 1][l], r[in.lhs + 2][l], r[in.lhs + 3][l], r[in.lhs + 4][l]); }); break;
+        case OpCode::call6: lanes([&](std::size_t const l) { d[l] = as<Function6>(in.function)(a[l], r[in.lhs + 1][l], r[in.lhs + 2][l], r[in.lhs + 3][l], r[in.lhs + 4][l], r[in.lhs + 5][l]); }); break;
+        case OpCode::call7: lanes([&](std::size_t const l) { d[l] = as<Function7>(in.function)(a[l], r[in.lhs + 1][l], r[in.lhs + 2][l], r[in.lhs + 3][l], r[in.lhs + 4][l], r[in.lhs + 5][l], r[in.lhs + 6][l]); }); break;
+        }
+    }
+    std::ranges::copy(r[0], results.begin());
+}
+
+bool Bytecode::isConstant() const noexcept {
+    return instructions.size() == 1 && instructions[0].op == OpCode::constant;
+}
+
+template<bool useSlots>
+double Bytecode::run(double const* const* slots) const noexcept {
+    std::array<double, maxRegisters> r; // NOLINT: every register is written before it is read
+    for (auto const& in : instructions) {
+        switch (in.op) {
+        case OpCode::constant:     r[in.dst] = in.constant; break;
+        case OpCode::variable:
+            if constexpr (useSlots) {
+                r[in.dst] = *slots[in.slot];
+            } else {
+                r[in.dst] = *in.address;
+            }
+            break;
+        case OpCode::address:      r[in.dst] = *in.address; break;
+        case OpCode::add:          r[in.dst] = r[in.lhs] + r[in.rhs]; break;
+        case OpCode::subtract:     r[in.dst] = r[in.lhs] - r[in.rhs]; break;
+        case OpCode::multiply:     r[in.dst] = r[in.lhs] * r[in.rhs]; break;
+        case OpCode::divide:       r[in.dst] = r[in.lhs] / r[in.rhs]; break;
+        case OpCode::modulo:       r[in.dst] = std::fmod(r[in.lhs], r[in.rhs]); break;
+        case OpCode::power:        r[in.dst] = std::pow(r[in.lhs], r[in.rhs]); break;
+        case OpCode::negate:       r[in.dst] = -r[in.lhs]; break;
+        case OpCode::comma:        r[in.dst] = r[in.rhs]; break;
+        case OpCode::greater:      r[in.dst] = r[in.lhs] > r[in.rhs]; break;
+        case OpCode::less:         r[in.dst] = r[in.lhs] < r[in.rhs]; break;
+        case OpCode::greaterEqual: r[in.dst] = r[in.lhs] >= r[in.rhs]; break;
+        case OpCode::lessEqual:    r[in.dst] = r[in.lhs] <= r[in.rhs]; break;
+        case OpCode::equal:        r[in.dst] = std::fabs(r[in.lhs] - r[in.rhs]) < std::numeric_limits<double>::epsilon(); break;
+        case OpCode::notEqual:     r[in.dst] = std::fabs(r[in.lhs] - r[in.rhs]) > std::numeric_limits<double>::epsilon(); break;
+        case OpCode::logicalNot:   r[in.dst] = !isTruthy(r[in.lhs]); break;
+        case OpCode::logicalAnd:   r[in.dst] = isTruthy(r[in.lhs]) && isTruthy(r[in.rhs]); break;
+        case OpCode::logicalOr:    r[in.dst] = isTruthy(r[in.lhs]) || isTruthy(r[in.rhs]); break;
+        case OpCode::minimum:      r[in.dst] = std::min(r[in.lhs], r[in.rhs]); break;
+        case OpCode::maximum:      r[in.dst] = std::max(r[in.lhs], r[in.rhs]); break;
+        case OpCode::call0: r[in.dst] = as<Function0>(in.function)(); break;
+        case OpCode::call1: r[in.dst] = as<Function1>(in.function)(r[in.lhs]); break;
+        case OpCode::call2: r[in.dst] = as<Function2>(in.function)(r[in.lhs], r[in.lhs + 1]); break;
+        case OpCode::call3: r[in.dst] = as<Function3>(in.function)(r[in.lhs], r[in.lhs + 1], r[in.lhs + 2]); break;
+        case OpCode::call4: r[in.dst] = as<Function4>(in.function)(r[in.lhs], r[in.lhs + 1], r[in.lhs + 2], r[in.lhs + 3]); break;
+        case OpCode::call5: r[in.dst] = as<Function5>(in.function)(r[in.lhs], r[in.lhs + 1], r[in.lhs + 2], r[in.lhs + 3], r[in.lhs + 4]); break;
+        case OpCode::call6: r[in.dst] = as<Function6>(in.function)(r[in.lhs], r[in.lhs + 1], r[in.lhs + 2], r[in.lhs + 3], r[in.lhs + 4], r[in.lhs + 5]); break;
+        case OpCode::call7: r[in.dst] = as<Function7>(in.function)(r[in.lhs], r[in.lhs + 1], r[in.lhs + 2], r[in.lhs + 3], r[in.lhs + 4], r[in.lhs + 5], r[in.lhs + 6]); break;
+        }
+    }
+    return r[0];
+}
+
+} // namespace Nebulite::Interaction::Logic
@@ -3,13 +3,16 @@
 
 // Standard library
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint> // NOLINT
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -24,6 +27,7 @@
 #include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Data/MappedOrderedCacheList.hpp"
 #include "Nebulite/Interaction/Context.hpp"
+#include "Nebulite/Interaction/Logic/Bytecode.hpp"
 #include "Nebulite/Interaction/Logic/Expression.hpp"
 #include "Nebulite/Interaction/Logic/ExpressionComponent.hpp"
 #include "Nebulite/Interaction/Logic/LinkedNumericValue.hpp"
@@ -171,6 +175,57 @@ Expression::Expression(std::string_view const expr){
     cacheId.global = Data::MappedOrderedCacheList::generateUniqueId(std::string("global:") + std::string(expr));
 }
 
+Expression Expression::clone() const {
+    Expression copy;
+    copy.evaluationInfo = evaluationInfo;
+    copy.cacheId = cacheId;
+    copy.cache = cache;
+    copy.fullExpression = fullExpression;
+
+    std::span<double const> const from = cache.values;
+    std::span<double const> const to = copy.cache.values;
+    auto indexOf = [&from](void const* address) -> std::optional<std::size_t> {
+        auto const* value = static_cast<double const*>(address);
+        if (value < from.data() || value >= from.data() + from.size()) {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(value - from.data());
+    };
+
+    copy.components.reserve(components.size());
+    for (auto const& component : components) {
+        copy.components.push_back(component.rebind(from, to));
+    }
+
+    // Cached variables are registered by their short name, which is part of the cache as well
+    copy.teVariables = teVariables;
+    for (auto& variable : copy.teVariables) {
+        if (auto const index = indexOf(variable.address); index.has_value()) {
+            variable.address = &copy.cache.values[index.value()];
+            variable.name = copy.cache.teNames[index.value()].data.data();
+        }
+    }
+
+    auto copyList = [&](LinkedNumericValueLists::LnvList const& source, LinkedNumericValueLists::LnvList& target) {
+        target.reserve(source.size());
+        for (auto const& lnv : source) {
+            target.push_back(std::make_unique<LinkedNumericValue>(lnv->getKey(), copy.cache.values[indexOf(lnv->getReference()).value()]));
+        }
+    };
+    auto const& [stable, unstable] = linkedNumericValues;
+    copyList(stable.self, copy.linkedNumericValues.stable.self);
+    copyList(stable.other, copy.linkedNumericValues.stable.other);
+    copyList(stable.global, copy.linkedNumericValues.stable.global);
+    copyList(unstable.self, copy.linkedNumericValues.unstable.self);
+    copyList(unstable.other, copy.linkedNumericValues.unstable.other);
+    copyList(unstable.local, copy.linkedNumericValues.unstable.local);
+    copyList(unstable.global, copy.linkedNumericValues.unstable.global);
+    copyList(unstable.full, copy.linkedNumericValues.unstable.full);
+    copyList(unstable.resource, copy.linkedNumericValues.unstable.resource);
+    copyList(unstable.none, copy.linkedNumericValues.unstable.none);
+    return copy;
+}
+
 //------------------------------------------
 // Actual evaluation functions
 
@@ -221,12 +276,12 @@ Data::Json Expression::evalAsJson(ContextScope const& context, std::size_t const
 
 double Expression::evalAsDouble(ContextScope const& context, Utility::Promise<&Expression::isReturnableAsDouble> /*promise*/) const {
     assert(isReturnableAsDouble() && "Expression is not returnable as double! Promise not fulfilled.");
-    return components[0].evalAsDouble([&]{updateCaches(context);});
+    return evalSimpleExpression(context);
 }
 
 int64_t Expression::evalAsInt(ContextScope const& context, Utility::Promise<&Expression::isReturnableAsInt> /*promise*/) const {
     assert(isReturnableAsInt() && "Expression is not returnable as int! Promise not fulfilled.");
-    return static_cast<int64_t>(components[0].evalAsDouble([&]{updateCaches(context);}));
+    return static_cast<int64_t>(evalSimpleExpression(context));
 }
 
 bool Expression::evalAsBool(ContextScope const& context, Utility::Promise<&Expression::isReturnableAsBool> /*promise*/) const {
@@ -239,6 +294,43 @@ bool Expression::evalAsBool(ContextScope const& context, Utility::Promise<&Expre
     return !Math::isZero(result);
 }
 
+void Expression::evalAsBoolBatch(Data::JsonScope& self, std::span<Data::JsonScope* const> const others, Data::JsonScope& global, std::vector<bool>& results, Utility::Promise<&Expression::isBatchable> /*promise*/) const {
+    assert(isBatchable() && "Expression is not batchable! Promise not fulfilled.");
+    std::size_t constexpr laneCount = Bytecode::laneCount;
+    std::size_t const slotCount = cache.values.size();
+    results.assign(others.size(), false);
+
+    // Self and global are shared by all lanes, only the slots of other differ
+    thread_local std::vector<double const*> slots;
+    slots.resize(laneCount * slotCount);
+    auto const lane = [&](std::size_t const l) { return std::span(slots).subspan(l * slotCount, slotCount); };
+    resolveStableSlots(self, linkedNumericValues.stable.self, cacheId.self, lane(0));
+    resolveStableSlots(global, linkedNumericValues.stable.global, cacheId.global, lane(0));
+    for (std::size_t l = 1; l < laneCount; l++) {
+        std::ranges::copy(lane(0), lane(l).begin());
+    }
+
+    std::array<double, laneCount> values{};
+    for (std::size_t first = 0; first < others.size(); first += laneCount) {
+        std::size_t const count = std::min(laneCount, others.size() - first);
+        // Unused lanes of the last batch repeat the first other, their results are discarded
+        for (std::size_t l = 0; l < laneCount; l++) {
+            resolveStableSlots(*others[first + (l < count ? l : 0)], linkedNumericValues.stable.other, cacheId.other, lane(l));
+        }
+        components[0].evalAsDoubleLanes(slots, slotCount, values);
+        for (std::size_t l = 0; l < count; l++) {
+            // We consider NaN as false
+            results[first + l] = !std::isnan(values[l]) && !Math::isZero(values[l]);
+        }
+    }
+}
+
+double Expression::evalAsDoubleWithTinyExpr(ContextScope const& context, Utility::Promise<&Expression::isReturnableAsDouble> /*promise*/) const {
+    assert(isReturnableAsDouble() && "Expression is not returnable as double! Promise not fulfilled.");
+    updateCaches(context);
+    return components[0].evalAsDoubleWithTinyExpr();
+}
+
 //------------------------------------------
 // Static functions for one-time evaluation
 
@@ -259,6 +351,35 @@ std::string const& Expression::getFullExpression() const noexcept {
     return fullExpression;
 }
 
+//------------------------------------------
+// Dependencies
+
+std::optional<std::vector<Expression::Dependency>> Expression::getDependencies() const {
+    if (!linkedNumericValues.hasOnlyStableValues() || std::ranges::any_of(components, &ExpressionComponent::hasDynamicKey)) {
+        return std::nullopt;
+    }
+
+    std::vector<Dependency> dependencies;
+    for (auto const& component : components) {
+        if (auto const variable = component.getStaticVariable(); variable.has_value()) {
+            auto const& [context, key] = variable.value();
+            if (context != ContextDeriver::TargetType::self && context != ContextDeriver::TargetType::other && context != ContextDeriver::TargetType::global) {
+                return std::nullopt;
+            }
+            dependencies.push_back({.context = context, .key = Data::ScopedKeyView(key), .numeric = false});
+        }
+    }
+    auto addNumeric = [&](ContextDeriver::TargetType const context, LinkedNumericValueLists::LnvList const& lnvList) {
+        for (auto const& lnv : lnvList) {
+            dependencies.push_back({.context = context, .key = lnv->getScopedKey(), .numeric = true});
+        }
+    };
+    addNumeric(ContextDeriver::TargetType::self, linkedNumericValues.stable.self);
+    addNumeric(ContextDeriver::TargetType::other, linkedNumericValues.stable.other);
+    addNumeric(ContextDeriver::TargetType::global, linkedNumericValues.stable.global);
+    return dependencies;
+}
+
 //------------------------------------------
 // Evaluation info
 
@@ -268,6 +389,8 @@ void Expression::recalculateEvaluationInfo() noexcept {
         .simpleExpressionWithIntCast = components.size() == 1 && components[0].isSimpleExpressionWithIntCast(),
         .returnableAsString = components.size() != 1 || components[0].isReturnableAsString(),
         .alwaysTrue = calculateIsAlwaysTrue(),
+        .batchable = components.size() == 1 && components[0].isSimpleExpression() && components[0].hasBytecode() && linkedNumericValues.hasOnlyStableValues(),
+        .plainText = std::ranges::all_of(components, &ExpressionComponent::isText),
     };
 }
 
@@ -282,6 +405,11 @@ bool Expression::calculateIsAlwaysTrue() const {
 //------------------------------------------
 // Caching
 
+bool Expression::LinkedNumericValueLists::hasOnlyStableValues() const noexcept {
+    return unstable.self.empty() && unstable.other.empty() && unstable.local.empty() && unstable.global.empty()
+        && unstable.full.empty() && unstable.resource.empty() && unstable.none.empty();
+}
+
 void Expression::LinkedNumericValueLists::registerLnv(ContextDeriver::TargetType const contextType, std::string_view const key, double& v){
     auto vd = std::make_unique<LinkedNumericValue>(key, v);
     switch (contextType) {
@@ -398,6 +526,42 @@ void Expression::updateUnstableValues(ContextScope const& context) const {
     }
 }
 
+std::span<double const* const> Expression::resolveSlots(ContextScope const& context) const {
+    // Bytecode evaluation never calls back into expressions, so a single table per thread suffices
+    thread_local std::vector<double const*> slots;
+    slots.resize(cache.values.size());
+    for (std::size_t i = 0; i < cache.values.size(); i++) {
+        slots[i] = &cache.values[i];
+    }
+    resolveStableSlots(context.self, linkedNumericValues.stable.self, cacheId.self, slots);
+    resolveStableSlots(context.other, linkedNumericValues.stable.other, cacheId.other, slots);
+    resolveStableSlots(context.global, linkedNumericValues.stable.global, cacheId.global, slots);
+    return slots;
+}
+
+void Expression::resolveStableSlots(Data::JsonScope& scope, LinkedNumericValueLists::LnvList const& lnvList, std::uint64_t const id, std::span<double const*> const slots) const {
+    if (lnvList.empty()) {
+        return;
+    }
+    auto* v = scope.ensureOrderedCacheList(
+        id,
+        lnvList | std::views::transform([](auto const& vde) { return vde->getScopedKey(); })
+    );
+    for (auto [i, vde] : lnvList | Utility::Ranges::enumerate) {
+        slots[static_cast<std::size_t>(vde->getReference() - cache.values.data())] = v[i];
+    }
+}
+
+double Expression::evalSimpleExpression(ContextScope const& context) const {
+    auto const& component = components[0];
+    if (!component.hasBytecode()) {
+        return component.evalAsDouble([&]{updateCaches(context);});
+    }
+    // Unstable values may evaluate other expressions, so they are resolved before the slot table is built
+    updateUnstableValues(context);
+    return component.evalAsDouble(resolveSlots(context));
+}
+
 //------------------------------------------
 // Core Helper functions
 
@@ -436,7 +600,7 @@ void Expression::parse(std::string_view const expr) {
     fullExpression = expr;
     parseIntoComponents();
     for (auto& component : components) {
-        component.compile(teVariables);
+        component.compile(teVariables, cache.values);
     }
     recalculateEvaluationInfo();
 }
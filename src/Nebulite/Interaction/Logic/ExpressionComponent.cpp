@@ -4,9 +4,13 @@
 // Standard library
 #include <cassert>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <expected>
 #include <functional>
+#include <new>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -17,9 +21,11 @@
 
 // Nebulite
 #include "Nebulite/Core/GlobalSpace.hpp"
+#include "Nebulite/Data/Document/Json.hpp"
 #include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Data/Document/SimpleValueError.hpp"
 #include "Nebulite/Interaction/Context.hpp"
+#include "Nebulite/Interaction/Logic/Bytecode.hpp"
 #include "Nebulite/Interaction/Logic/Expression.hpp"
 #include "Nebulite/Interaction/Logic/ExpressionComponent.hpp"
 #include "Nebulite/Interaction/Logic/VariableNameGenerator.hpp"
@@ -221,8 +227,9 @@ void setToken(Data::Json& token, std::string const& evaluatedKey, ContextScope c
 /**
  * @brief Compiles a component, if its of type Expression
  * @param teVariables The vector of TinyExpr variables
+ * @param slots The cached values the variables are bound to
  */
-int ExpressionComponent::compile(std::vector<te_variable> const& teVariables) {
+int ExpressionComponent::compile(std::vector<te_variable> const& teVariables, std::span<double const> const slots) {
     int error{};
     if (type == Type::eval) {
         expression = te_compile(stringRepresentation.c_str(), teVariables.data(), static_cast<int>(teVariables.size()), &error);
@@ -230,10 +237,69 @@ int ExpressionComponent::compile(std::vector<te_variable> const& teVariables) {
             te_free(expression);
             expression = te_compile("abs(0/0)", teVariables.data(), static_cast<int>(teVariables.size()), &error);
         }
+        // Unsupported expressions stay on the tinyexpr path
+        if (expression != nullptr) {
+            bytecode = Bytecode::compile(expression, slots);
+        }
     }
     return error;
 }
 
+namespace {
+
+//------------------------------------------
+// tinyexpr internals, see tinyexpr.c
+
+int arity(int const type) {
+    return (type & (TE_FUNCTION0 | TE_CLOSURE0)) != 0 ? type & 0x07 : 0;
+}
+
+bool isClosure(int const type) {
+    return (type & TE_CLOSURE0) != 0;
+}
+
+/**
+ * @brief Copies a compiled tinyexpr tree, moving variables bound to one array of values to another.
+ * @details Nodes are allocated with the layout of tinyexpr, so the copy is released by te_free.
+ *          The context of closures is shared, as tinyexpr does not own it.
+ */
+te_expr* copyTree(te_expr const* node, std::span<double const> const from, std::span<double const> const to) {
+    if (node == nullptr) {
+        return nullptr;
+    }
+    auto const parameters = static_cast<std::size_t>(arity(node->type)) + (isClosure(node->type) ? 1 : 0);
+    std::size_t const size = sizeof(te_expr) - sizeof(void*) + parameters * sizeof(void*);
+    auto* copy = static_cast<te_expr*>(std::malloc(size)); // NOLINT: released by te_free
+    if (copy == nullptr) {
+        throw std::bad_alloc();
+    }
+    std::memcpy(copy, node, size);
+    if (node->type == TE_VARIABLE && node->bound >= from.data() && node->bound < from.data() + from.size()) {
+        copy->bound = to.data() + (node->bound - from.data());
+    }
+    for (int i = 0; i < arity(node->type); i++) {
+        copy->parameters[i] = copyTree(static_cast<te_expr const*>(node->parameters[i]), from, to); // NOLINT
+    }
+    return copy;
+}
+
+} // namespace
+
+ExpressionComponent ExpressionComponent::rebind(std::span<double const> const from, std::span<double const> const to) const {
+    ExpressionComponent component;
+    component.type = type;
+    component.contextType = contextType;
+    component.formatter = formatter;
+    component.stringRepresentation = stringRepresentation;
+    component.key = key;
+    component.evaluationWait = evaluationWait;
+    component.expression = copyTree(expression, from, to);
+    if (bytecode.has_value()) {
+        component.bytecode = bytecode->rebind(to);
+    }
+    return component;
+}
+
 //------------------------------------------
 // Getter
 
@@ -241,6 +307,22 @@ std::string const& ExpressionComponent::getStringRepresentation() const {
     return stringRepresentation;
 }
 
+//------------------------------------------
+// Dependencies
+
+bool ExpressionComponent::hasDynamicKey() const noexcept {
+    return type == Type::variable
+        && evaluationWait == 0
+        && (stringRepresentation.contains('$') || stringRepresentation.contains('{') || key.contains(Data::Json::SpecialCharacter::transformationPipe));
+}
+
+std::optional<std::pair<ContextDeriver::TargetType, std::string_view>> ExpressionComponent::getStaticVariable() const noexcept {
+    if (type != Type::variable || evaluationWait > 0 || hasDynamicKey()) {
+        return std::nullopt;
+    }
+    return std::make_pair(contextType, std::string_view(key));
+}
+
 //------------------------------------------
 // Returnability
 
@@ -284,6 +366,15 @@ void ExpressionComponent::eval(std::string& result, ContextScope const& context,
 }
 
 double ExpressionComponent::evalAsDoubleImpl() const {
+    assert(isSimpleExpression() || isSimpleExpressionWithIntCast());
+    assert(expression != nullptr);
+    if (bytecode.has_value()) {
+        return bytecode->evaluate();
+    }
+    return te_eval(expression);
+}
+
+double ExpressionComponent::evalAsDoubleWithTinyExpr() const {
     assert(isSimpleExpression() || isSimpleExpressionWithIntCast());
     assert(expression != nullptr);
     return te_eval(expression);
@@ -293,7 +384,7 @@ Data::Json ExpressionComponent::evalAsJsonImpl(ContextScope const& context, std:
     Data::Json jsonResult;
     if (type == Type::eval) {
         if (formatter.cast == Formatter::CastType::none) {
-            jsonResult.set<double>("", te_eval(expression));
+            jsonResult.set<double>("", bytecode.has_value() ? bytecode->evaluate() : te_eval(expression));
         }
         else {
             std::string result;
@@ -357,7 +448,7 @@ bool ExpressionComponent::evalComponentTypeVariable(Data::Json& token, ContextSc
 }
 
 void ExpressionComponent::evalComponentTypeEval(std::string& token) const {
-    token = formatter.format(te_eval(expression));
+    token = formatter.format(bytecode.has_value() ? bytecode->evaluate() : te_eval(expression));
 }
 
 std::expected<std::string, ExpressionComponent::KeyEvaluationInfo> ExpressionComponent::evaluateKey(ContextScope const& context, std::size_t const recursionDepth) const {
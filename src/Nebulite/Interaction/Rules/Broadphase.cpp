@@ -0,0 +1,24 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <cstddef>
+
+// Nebulite
+#include "Nebulite/Data/MappedOrderedCacheList.hpp"
+#include "Nebulite/Interaction/Execution/Domain.hpp"
+#include "Nebulite/Interaction/Rules/Broadphase.hpp"
+
+//------------------------------------------
+namespace Nebulite::Interaction::Rules {
+
+double** Broadphase::ensureBounds(Execution::Domain const& domain) {
+    static std::size_t const id = Data::MappedOrderedCacheList::generateUniqueId("::broadphase::bounds");
+    try {
+        return domain.ensureOrderedCacheList(id, boundsKeys);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+} // namespace Nebulite::Interaction::Rules
@@ -2,7 +2,11 @@
 // Includes
 
 // Standard library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <string>
@@ -11,6 +15,9 @@
 #include <variant>
 #include <vector>
 
+// External
+#include <absl/container/flat_hash_map.h>
+
 // Nebulite
 #include "Nebulite/Constants/KeyNames.hpp"
 #include "Nebulite/Core/GlobalSpace.hpp"
@@ -20,6 +27,7 @@
 #include "Nebulite/Interaction/Execution/Domain.hpp"
 #include "Nebulite/Interaction/Logic/Assignment.hpp"
 #include "Nebulite/Interaction/Logic/Expression.hpp"
+#include "Nebulite/Interaction/Rules/Broadphase.hpp"
 #include "Nebulite/Interaction/Rules/Construction/RulesetCompiler.hpp"
 #include "Nebulite/Interaction/Rules/Ruleset.hpp"
 #include "Nebulite/Interaction/Rules/StaticRulesetMap.hpp"
@@ -30,31 +38,143 @@
 //------------------------------------------
 namespace Nebulite::Interaction::Rules::Construction {
 
-void RulesetCompiler::getFunctionCalls(Data::JsonScope const& entryDoc, JsonRuleset& ruleset) {
-    auto getCalls = [&entryDoc](Data::ScopedKeyView const& key, std::vector<Logic::Expression>& target) {
-        if (entryDoc.memberType(key) == Data::KeyType::array) {
-            for (auto const& indexKey : entryDoc.arrayKeys(key)) {
-                target.emplace_back(entryDoc.get<std::string>(indexKey).value_or(""));
-            }
+struct RulesetCompiler::CompiledRuleset {
+    explicit CompiledRuleset(std::string_view const conditionSource) : condition(conditionSource) {}
+
+    std::string topic;
+    Logic::Expression condition; // Stripped and encapsulated in an evaluation
+    std::optional<double> interactionRadius;
+    std::vector<Logic::Assignment> assignments; // Only those that could be parsed
+    std::vector<Logic::Expression> functioncallsGlobal;
+    std::vector<Logic::Expression> functioncallsSelf;
+    std::vector<Logic::Expression> functioncallsOther;
+};
+
+struct RulesetCompiler::CompiledRulesetCache {
+    /**
+     * @brief Maximum number of cached sources, the least recently used one is evicted once exceeded.
+     * @details Guards against unbounded growth from generated inline rulesets.
+     */
+    static std::size_t constexpr capacity = 1024;
+
+    struct Entry {
+        std::shared_ptr<CompiledRuleset const> ruleset;
+        std::uint64_t lastUse = 0;
+    };
+
+    absl::flat_hash_map<std::string, Entry> entries;
+    std::uint64_t uses = 0;
+    std::mutex mtx;
+};
+
+RulesetCompiler::CompiledRulesetCache& RulesetCompiler::compiledRulesetCache() {
+    static CompiledRulesetCache cache;
+    return cache;
+}
+
+std::shared_ptr<RulesetCompiler::CompiledRuleset const> RulesetCompiler::getCompiledRuleset(std::string const& serial) {
+    auto& cache = compiledRulesetCache();
+    {
+        std::scoped_lock const lock(cache.mtx);
+        if (auto const it = cache.entries.find(serial); it != cache.entries.end()) {
+            it->second.lastUse = ++cache.uses;
+            return it->second.ruleset;
+        }
+    }
+
+    // Compile outside the lock, concurrent first uses of the same source may compile twice
+    Data::JsonScope entry;
+    entry.deserialize(serial);
+    auto compiled = compileEntry(entry);
+
+    std::scoped_lock const lock(cache.mtx);
+    if (cache.entries.size() >= CompiledRulesetCache::capacity && !cache.entries.contains(serial)) {
+        auto const oldest = std::ranges::min_element(cache.entries, {}, [](auto const& pair) { return pair.second.lastUse; });
+        cache.entries.erase(oldest);
+    }
+    auto& cached = cache.entries[serial];
+    cached = {.ruleset = std::move(compiled), .lastUse = ++cache.uses};
+    return cached.ruleset;
+}
+
+void RulesetCompiler::clearCompiledRulesets() {
+    auto& cache = compiledRulesetCache();
+    std::scoped_lock const lock(cache.mtx);
+    cache.entries.clear();
+}
+
+std::shared_ptr<RulesetCompiler::CompiledRuleset const> RulesetCompiler::compileEntry(Data::JsonScope const& entry) {
+    std::string const logicalArgStr = getCondition(entry);
+    std::string_view lsa = logicalArgStr;
+    Utility::StringHandler::strip(lsa);
+    auto compiled = std::make_shared<CompiledRuleset>(lsa);
+
+    // Remove whitespaces at start and end from topic
+    std::string const topic = entry.get<std::string>(Constants::KeyNames::Ruleset::topic).value_or("all");
+    std::string_view top = topic;
+    Utility::StringHandler::strip(top);
+    compiled->topic = top;
+
+    // Optional opt-in to the spatial broad-phase
+    if (entry.memberType(Constants::KeyNames::Ruleset::interactionRadius) == Data::KeyType::value) {
+        compiled->interactionRadius = entry.get<double>(Constants::KeyNames::Ruleset::interactionRadius).value_or(0.0);
+    }
+
+    for (auto const& str : getStrings(entry, Constants::KeyNames::Ruleset::assignments)) {
+        if (Logic::Assignment assignment; assignment.parse(str)) {
+            compiled->assignments.emplace_back(std::move(assignment));
+        }
+    }
+    auto compileCalls = [&entry](Data::ScopedKeyView const& key, std::vector<Logic::Expression>& target) {
+        for (auto const& call : getStrings(entry, key)) {
+            target.emplace_back(call);
         }
     };
-    getCalls(Constants::KeyNames::Ruleset::parseOnGlobal, ruleset.functioncallsGlobal);
-    getCalls(Constants::KeyNames::Ruleset::parseOnSelf, ruleset.functioncallsSelf);
-    getCalls(Constants::KeyNames::Ruleset::parseOnOther, ruleset.functioncallsOther);
+    compileCalls(Constants::KeyNames::Ruleset::parseOnGlobal, compiled->functioncallsGlobal);
+    compileCalls(Constants::KeyNames::Ruleset::parseOnSelf, compiled->functioncallsSelf);
+    compileCalls(Constants::KeyNames::Ruleset::parseOnOther, compiled->functioncallsOther);
+    return compiled;
 }
 
-bool RulesetCompiler::getAssignments(std::shared_ptr<JsonRuleset> const& ruleset, Data::JsonScope const& entry) {
-    if (entry.memberType(Constants::KeyNames::Ruleset::assignments) == Data::KeyType::array) {
-        for (auto const& key : entry.arrayKeys(Constants::KeyNames::Ruleset::assignments)) {
-            if (Logic::Assignment assignment; assignment.parse(entry.get<std::string>(key).value_or(""))) {
-                ruleset->assignments.emplace_back(std::move(assignment));
-            }
+std::vector<std::string> RulesetCompiler::getStrings(Data::JsonScope const& entry, Data::ScopedKeyView const& key) {
+    std::vector<std::string> strings;
+    if (entry.memberType(key) == Data::KeyType::array) {
+        for (auto const& indexKey : entry.arrayKeys(key)) {
+            strings.push_back(entry.get<std::string>(indexKey).value_or(""));
         }
-    } else {
-        // No expressions
-        return false;
     }
-    return true;
+    return strings;
+}
+
+void RulesetCompiler::getFunctionCalls(CompiledRuleset const& compiled, JsonRuleset& ruleset) {
+    auto getCalls = [](std::vector<Logic::Expression> const& source, std::vector<JsonRuleset::FunctionCall>& target) {
+        target.reserve(source.size());
+        for (auto const& call : source) {
+            target.push_back({.expression = call.clone()});
+        }
+    };
+    getCalls(compiled.functioncallsGlobal, ruleset.functioncallsGlobal);
+    getCalls(compiled.functioncallsSelf, ruleset.functioncallsSelf);
+    getCalls(compiled.functioncallsOther, ruleset.functioncallsOther);
+
+    // Plain text calls on known domains are compiled once, so they are not parsed on every application
+    ContextScope const context{ruleset.self.domainScope, ruleset.self.domainScope, Global::instance().domainScope};
+    auto compileCalls = [&context](std::vector<JsonRuleset::FunctionCall>& calls, Execution::Domain& domain) {
+        for (auto& call : calls) {
+            if (!call.expression.isPlainText()) continue;
+            call.command = call.expression.eval(context);
+            call.compiled = domain.tasks.compileTask(call.command, domain);
+        }
+    };
+    compileCalls(ruleset.functioncallsGlobal, Global::instance());
+    compileCalls(ruleset.functioncallsSelf, ruleset.self);
+}
+
+void RulesetCompiler::getAssignments(CompiledRuleset const& compiled, JsonRuleset& ruleset) {
+    ruleset.assignments.reserve(compiled.assignments.size());
+    for (auto const& assignment : compiled.assignments) {
+        ruleset.assignments.emplace_back(assignment.clone());
+    }
 }
 
 std::string RulesetCompiler::getCondition(Data::JsonScope const& entry) {
@@ -80,23 +200,31 @@ std::string RulesetCompiler::getCondition(Data::JsonScope const& entry) {
     return logicalArg;
 }
 
-bool RulesetCompiler::getJsonRuleset(Data::JsonScope const& doc, Data::JsonScope& entry, Data::ScopedKeyView const& key) {
+std::optional<std::string> RulesetCompiler::getSerializedRuleset(Data::JsonScope const& doc, Data::ScopedKeyView const& key) {
     if (doc.memberType(key) == Data::KeyType::object) {
-        std::string const& serial = doc.serialize(key);
-        entry.deserialize(serial);
-    } else {
-        // Is perhaps link to document
-        auto const potentialLink = doc.get<std::string>(key).value_or("");
-        if (potentialLink.starts_with("::")) {
-            return false; // Is a static ruleset
-        }
-        std::string const file = Global::instance().getDocCache().getDocString(potentialLink);
-        if (file.empty()) {
-            return false;
-        }
-        entry.deserialize(file);
+        return doc.serialize(key);
+    }
+    // Is perhaps link to document
+    auto const potentialLink = doc.get<std::string>(key).value_or("");
+    if (potentialLink.starts_with("::")) {
+        return std::nullopt; // Is a static ruleset
     }
-    return true;
+    std::string file = Global::instance().getDocCache().getDocString(potentialLink);
+    if (file.empty()) {
+        return std::nullopt;
+    }
+    return file;
+}
+
+void RulesetCompiler::setInteractionRadius(Ruleset& ruleset, std::optional<double> const& interactionRadius, Execution::Domain const& self) {
+    if (!interactionRadius.has_value() || !ruleset.isGlobal()) {
+        return;
+    }
+    ruleset.bounds = Broadphase::ensureBounds(self);
+    if (ruleset.bounds == nullptr) {
+        return; // No bounding box available, the ruleset is paired with every listener
+    }
+    ruleset.interactionRadius = std::max(0.0, interactionRadius.value());
 }
 
 void RulesetCompiler::setMetaData(RulesetVector const& rulesets) {
@@ -163,8 +291,8 @@ void RulesetCompiler::optimize(std::shared_ptr<JsonRuleset> const& entry, Data::
 }
 
 RulesetCompiler::AnyRuleset RulesetCompiler::getRuleset(Data::JsonScope const& doc, Data::ScopedKeyView const& key, Execution::Domain& self) {
-    Data::JsonScope entry;
-    if (!getJsonRuleset(doc, entry, key)) {
+    auto const serial = getSerializedRuleset(doc, key);
+    if (!serial.has_value()) {
         // See if it's a static ruleset
         auto const staticFunctionName = doc.get<std::string>(key).value_or("");
 
@@ -182,6 +310,7 @@ RulesetCompiler::AnyRuleset RulesetCompiler::getRuleset(Data::JsonScope const& d
             ruleset->staticFunction = staticRulesetEntry.function;
             ruleset->baseListFunction = staticRulesetEntry.baseListFunc;
             ruleset->slf = staticRulesetEntry.baseListFunc(self);
+            setInteractionRadius(*ruleset, staticRulesetEntry.interactionRadius, self);
             return ruleset;
         }
         // Skip this entry if it cannot be parsed
@@ -189,29 +318,26 @@ RulesetCompiler::AnyRuleset RulesetCompiler::getRuleset(Data::JsonScope const& d
         Global::capture().error.println("Could not parse Ruleset entry with string '", staticFunctionName, "'. Skipping entry.");
         return std::monostate{};
     }
-    // Is a valid JSON-defined ruleset
-    auto ruleset = std::make_shared<JsonRuleset>(self);
-    ruleset->topic = entry.get<std::string>(Constants::KeyNames::Ruleset::topic).value_or("all");
-
-    std::string const logicalArgStr = getCondition(entry);
-    std::string_view lsa = logicalArgStr;
-    Utility::StringHandler::strip(lsa);
-    ruleset->logicalArg = std::make_unique<Logic::Expression>(lsa);
-    if (!ruleset->logicalArg->isReturnableAsBool()) {
-        Global::capture().error.println("Ruleset entry with logical arg '", lsa, "' cannot be evaluated as a boolean. Skipping entry.");
+    // Is a valid JSON-defined ruleset, compiled once per source
+    auto const compiled = getCompiledRuleset(serial.value());
+    if (!compiled->condition.isReturnableAsBool()) {
+        Global::capture().error.println("Ruleset entry with logical arg '", compiled->condition.getFullExpression(), "' cannot be evaluated as a boolean. Skipping entry.");
         return std::monostate{};
     }
 
-    // Remove whitespaces at start and end from topic:
-    std::string_view top = ruleset->topic;
-    Utility::StringHandler::strip(top);
-    ruleset->topic = top;
+    // Only the cached values of the expressions are created per domain
+    auto ruleset = std::make_shared<JsonRuleset>(self);
+    ruleset->topic = compiled->topic;
+    ruleset->logicalArg = std::make_unique<Logic::Expression>(compiled->condition.clone());
+
+    // Optional opt-in to the spatial broad-phase
+    setInteractionRadius(*ruleset, compiled->interactionRadius, self);
 
-    // Get and parse all assignments
-    getAssignments(ruleset, entry);
+    // Get all assignments
+    getAssignments(*compiled, *ruleset);
 
-    // Parse all function calls
-    getFunctionCalls(entry, *ruleset);
+    // Get all function calls
+    getFunctionCalls(*compiled, *ruleset);
 
     // Push into vector
     return ruleset;
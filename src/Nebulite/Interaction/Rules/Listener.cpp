@@ -2,10 +2,12 @@
 // Includes
 
 // Standard library
+#include <mutex>
 #include <string>
 #include <string_view>
 
 // Nebulite
+#include "Nebulite/Interaction/Rules/Broadphase.hpp"
 #include "Nebulite/Interaction/Rules/Listener.hpp"
 #include "Nebulite/Interaction/Rules/Ruleset.hpp"
 #include "Nebulite/Interaction/Rules/StaticRulesetMap.hpp"
@@ -21,4 +23,11 @@ Listener::Listener(Execution::Domain& d, std::string_view const t) : domain(d),
     // JSON ruleset or unknown static ruleset, no list required
 }
 
+double** Listener::getBounds() {
+    std::call_once(boundsInitialized, [this] {
+        bounds = Broadphase::ensureBounds(domain);
+    });
+    return bounds;
+}
+
 } // namespace Nebulite::Interaction::Rules
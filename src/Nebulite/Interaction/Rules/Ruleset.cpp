@@ -2,9 +2,12 @@
 // Includes
 
 // Standard library
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 // Nebulite
 #include "Nebulite/Interaction/Context.hpp"
@@ -27,6 +30,10 @@ bool Ruleset::evaluateConditionGlobally(Execution::Domain& /*self*/, Execution::
     return false;
 }
 
+bool Ruleset::evaluateConditionBatch(std::span<std::shared_ptr<Listener> const> const /*listeners*/, Execution::Domain& /*global*/, std::vector<bool>& /*matches*/) {
+    return false;
+}
+
 bool Ruleset::evaluateConditionLocally(Execution::Domain& global) {
     return evaluateConditionGlobally(self, global);
 }
@@ -79,6 +86,14 @@ void sendTask(Execution::Domain& domain, std::string const& task) {
 }
 } // namespace
 
+void JsonRuleset::sendFunctionCall(Execution::Domain& domain, FunctionCall const& call, ContextScope const& contextScope) {
+    if (call.compiled != nullptr && domain.owns(*call.compiled)) {
+        domain.tasks.addTask(call.command, call.compiled);
+        return;
+    }
+    sendTask(domain, call.expression.eval(contextScope));
+}
+
 //------------------------------------------
 // Derived Class Methods: JsonRuleset
 
@@ -93,6 +108,27 @@ bool JsonRuleset::evaluateConditionGlobally(Execution::Domain& other, Execution:
     return logicalArg->evalAsBool(contextScope, Utility::Promise<&Logic::Expression::isReturnableAsBool>{});
 }
 
+bool JsonRuleset::evaluateConditionBatch(std::span<std::shared_ptr<Listener> const> const listeners, Execution::Domain& global, std::vector<bool>& matches) {
+    if (logicalArg->isAlwaysTrue()) {
+        matches.assign(listeners.size(), true);
+        return true;
+    }
+
+    // Evaluating all conditions before applying is only equivalent if applying cannot change the operands of other listeners
+    bool const onlyModifiesOther = std::ranges::all_of(assignments, [](auto const& assignment) { return assignment.targetsOther(); });
+    if (!logicalArg->isBatchable() || !onlyModifiesOther) {
+        return false;
+    }
+
+    thread_local std::vector<Data::JsonScope*> others;
+    others.clear();
+    for (auto const& listener : listeners) {
+        others.push_back(&listener->domain.domainScope);
+    }
+    logicalArg->evalAsBoolBatch(self.domainScope, others, global.domainScope, matches, Utility::Promise<&Logic::Expression::isBatchable>{});
+    return true;
+}
+
 void JsonRuleset::applyContext(Context& context, ContextScope& contextScope){
     // 1.) Assignments
     for (auto& assignment : assignments) {
@@ -100,14 +136,14 @@ void JsonRuleset::applyContext(Context& context, ContextScope& contextScope){
     }
 
     // 2.) Function calls
-    for (auto& entry : functioncallsGlobal) {
-        sendTask(context.global, entry.eval(contextScope));
+    for (auto const& entry : functioncallsGlobal) {
+        sendFunctionCall(context.global, entry, contextScope);
     }
-    for (auto& entry : functioncallsSelf) {
-        sendTask(context.self, entry.eval(contextScope));
+    for (auto const& entry : functioncallsSelf) {
+        sendFunctionCall(context.self, entry, contextScope);
     }
-    for (auto& entry : functioncallsOther) {
-        sendTask(context.other, entry.eval(contextScope));
+    for (auto const& entry : functioncallsOther) {
+        sendFunctionCall(context.other, entry, contextScope);
     }
 }
 
@@ -127,14 +163,14 @@ void JsonRuleset::applyDomain(Execution::Domain& global) {
     }
 
     // 2.) Function calls
-    for (auto& entry : functioncallsGlobal) {
-        sendTask(ctx.global, entry.eval(ctxScope));
+    for (auto const& entry : functioncallsGlobal) {
+        sendFunctionCall(ctx.global, entry, ctxScope);
     }
-    for (auto& entry : functioncallsSelf) {
-        sendTask(ctx.self, entry.eval(ctxScope));
+    for (auto const& entry : functioncallsSelf) {
+        sendFunctionCall(ctx.self, entry, ctxScope);
     }
-    for (auto& entry : functioncallsOther) {
-        sendTask(ctx.other, entry.eval(ctxScope));
+    for (auto const& entry : functioncallsOther) {
+        sendFunctionCall(ctx.other, entry, ctxScope);
     }
 }
 
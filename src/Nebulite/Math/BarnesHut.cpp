@@ -0,0 +1,167 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <limits>
+#include <span>
+
+// Nebulite
+#include "Nebulite/Math/BarnesHut.hpp"
+#include "Nebulite/Math/Equality.hpp"
+
+//------------------------------------------
+namespace Nebulite::Math {
+
+void BarnesHut::build(std::span<Body const> const input) {
+    nodes.clear();
+    bodies.clear();
+
+    // Filter bodies without any contribution, find the bounding square of the rest
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double maxY = std::numeric_limits<double>::lowest();
+    for (auto const& body : input) {
+        if (isZero(body.mass) || !std::isfinite(body.mass) || !std::isfinite(body.x) || !std::isfinite(body.y)) {
+            continue;
+        }
+        bodies.push_back(body);
+        minX = std::min(minX, body.x);
+        minY = std::min(minY, body.y);
+        maxX = std::max(maxX, body.x);
+        maxY = std::max(maxY, body.y);
+    }
+    if (bodies.empty() || bodies.size() >= none) {
+        bodies.clear();
+        return;
+    }
+
+    // Root node, with a small margin so that bodies on the boundary stay inside
+    nodes.push_back(Node{
+        .centerX = 0.5 * (minX + maxX),
+        .centerY = 0.5 * (minY + maxY),
+        .halfSize = 0.5 * std::max(maxX - minX, maxY - minY) + 1.0,
+    });
+    for (std::uint32_t idx = 0; idx < bodies.size(); idx++) {
+        insert(idx);
+    }
+
+    // Turn the mass-weighted position sums into centers of mass
+    for (auto& node : nodes) {
+        if (isZero(node.mass)) {
+            // Masses cancelled out, no meaningful center
+            node.massX = node.centerX;
+            node.massY = node.centerY;
+        } else {
+            node.massX /= node.mass;
+            node.massY /= node.mass;
+        }
+    }
+}
+
+BarnesHut::Vector BarnesHut::field(double const x, double const y, double const theta, double const softening) const {
+    Vector result{.x = 0.0, .y = 0.0};
+    if (nodes.empty()) {
+        return result;
+    }
+
+    // Each opened node replaces itself with 4 children, so the stack never exceeds 3 entries per level
+    std::array<std::uint32_t, 3 * maxDepth + 4> stack{};
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    double const theta2 = theta * theta;
+    while (stackSize > 0) {
+        Node const& node = nodes[stack[--stackSize]];
+        if (isZero(node.mass)) continue;
+
+        double const dx = node.massX - x;
+        double const dy = node.massY - y;
+        double const d2 = dx*dx + dy*dy;
+        double const size = 2.0 * node.halfSize;
+
+        if (node.firstChild == none || size * size < theta2 * d2) {
+            // Leaf or far enough away: treat as a single body
+            double const invR = 1.0 / std::sqrt(d2 + softening);
+            double const coeff = node.mass * invR * invR * invR;
+            result.x += dx * coeff;
+            result.y += dy * coeff;
+        } else {
+            for (std::uint32_t child = 0; child < 4; child++) {
+                stack[stackSize++] = node.firstChild + child;
+            }
+        }
+    }
+    return result;
+}
+
+void BarnesHut::insert(std::uint32_t const index) {
+    Body const& body = bodies[index];
+    std::uint32_t node = 0;
+    for (std::uint32_t depth = 0;; depth++) {
+        accumulate(nodes[node], body);
+
+        // Descend until a leaf is reached
+        if (nodes[node].firstChild != none) {
+            node = childOf(node, body.x, body.y);
+            continue;
+        }
+
+        // Empty leaf
+        if (nodes[node].body == none) {
+            nodes[node].body = index;
+            return;
+        }
+
+        // Bodies at (nearly) the same position: share the leaf, its center of mass stays exact
+        if (depth >= maxDepth) {
+            return;
+        }
+
+        // Occupied leaf: move its body one level down, then continue with the new body
+        std::uint32_t const previous = nodes[node].body;
+        nodes[node].body = none;
+        subdivide(node);
+        std::uint32_t const child = childOf(node, bodies[previous].x, bodies[previous].y);
+        accumulate(nodes[child], bodies[previous]);
+        nodes[child].body = previous;
+        node = childOf(node, body.x, body.y);
+    }
+}
+
+void BarnesHut::subdivide(std::uint32_t const node) {
+    auto const firstChild = static_cast<std::uint32_t>(nodes.size());
+    double const quarter = 0.5 * nodes[node].halfSize;
+    double const centerX = nodes[node].centerX;
+    double const centerY = nodes[node].centerY;
+
+    // Child order matches childOf: bit 0 for the right half, bit 1 for the lower half
+    for (std::uint32_t child = 0; child < 4; child++) {
+        nodes.push_back(Node{
+            .centerX = (child & 1U) != 0 ? centerX + quarter : centerX - quarter,
+            .centerY = (child & 2U) != 0 ? centerY + quarter : centerY - quarter,
+            .halfSize = quarter,
+        });
+    }
+    nodes[node].firstChild = firstChild;
+}
+
+std::uint32_t BarnesHut::childOf(std::uint32_t const node, double const x, double const y) const {
+    Node const& parent = nodes[node];
+    std::uint32_t const right = x >= parent.centerX ? 1U : 0U;
+    std::uint32_t const lower = y >= parent.centerY ? 2U : 0U;
+    return parent.firstChild + (right | lower);
+}
+
+void BarnesHut::accumulate(Node& node, Body const& body) {
+    node.mass += body.mass;
+    node.massX += body.mass * body.x;
+    node.massY += body.mass * body.y;
+}
+
+} // namespace Nebulite::Math
@@ -252,52 +252,54 @@ void ExpressionPrimitives::help(std::span<std::string_view const> const& args) {
 // Private
 
 std::vector<ExpressionPrimitives::FunctionInfo> const& ExpressionPrimitives::availableFunctions() {
+    // All functions are deterministic, including the seeded rng functions.
+    // Registering them as pure allows calls with constant arguments to be folded on compilation.
     static std::vector<FunctionInfo> const functions = {
         // Logical comparison functions
-        {.name=gtName, .description=gtDesc, .pointer=reinterpret_cast<void*>(gt), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=ltName, .description=ltDesc, .pointer=reinterpret_cast<void*>(lt), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=geqName, .description=geqDesc, .pointer=reinterpret_cast<void*>(geq), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=leqName, .description=leqDesc, .pointer=reinterpret_cast<void*>(leq), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=eqName, .description=eqDesc, .pointer=reinterpret_cast<void*>(eq), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=neqName, .description=neqDesc, .pointer=reinterpret_cast<void*>(neq), .type=TE_FUNCTION2, .context=nullptr},
+        {.name=gtName, .description=gtDesc, .pointer=reinterpret_cast<void*>(gt), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=ltName, .description=ltDesc, .pointer=reinterpret_cast<void*>(lt), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=geqName, .description=geqDesc, .pointer=reinterpret_cast<void*>(geq), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=leqName, .description=leqDesc, .pointer=reinterpret_cast<void*>(leq), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=eqName, .description=eqDesc, .pointer=reinterpret_cast<void*>(eq), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=neqName, .description=neqDesc, .pointer=reinterpret_cast<void*>(neq), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
 
         // Logical gate functions
-        {.name=logicalNotName, .description=logicalNotDesc, .pointer=reinterpret_cast<void*>(logicalNot), .type=TE_FUNCTION1, .context=nullptr},
-        {.name=logicalAndName, .description=logicalAndDesc, .pointer=reinterpret_cast<void*>(logicalAnd), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=logicalOrName, .description=logicalOrDesc, .pointer=reinterpret_cast<void*>(logicalOr), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=logicalXorName, .description=logicalXorDesc, .pointer=reinterpret_cast<void*>(logicalXor), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=logicalNandName, .description=logicalNandDesc, .pointer=reinterpret_cast<void*>(logicalNand), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=logicalNorName, .description=logicalNorDesc, .pointer=reinterpret_cast<void*>(logicalNor), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=logicalXnorName, .description=logicalXnorDesc, .pointer=reinterpret_cast<void*>(logicalXnor), .type=TE_FUNCTION2, .context=nullptr},
+        {.name=logicalNotName, .description=logicalNotDesc, .pointer=reinterpret_cast<void*>(logicalNot), .type=TE_FUNCTION1 | TE_FLAG_PURE, .context=nullptr},
+        {.name=logicalAndName, .description=logicalAndDesc, .pointer=reinterpret_cast<void*>(logicalAnd), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=logicalOrName, .description=logicalOrDesc, .pointer=reinterpret_cast<void*>(logicalOr), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=logicalXorName, .description=logicalXorDesc, .pointer=reinterpret_cast<void*>(logicalXor), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=logicalNandName, .description=logicalNandDesc, .pointer=reinterpret_cast<void*>(logicalNand), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=logicalNorName, .description=logicalNorDesc, .pointer=reinterpret_cast<void*>(logicalNor), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=logicalXnorName, .description=logicalXnorDesc, .pointer=reinterpret_cast<void*>(logicalXnor), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
 
         // Other logical functions
-        {.name=toBipolarName, .description=toBipolarDesc, .pointer=reinterpret_cast<void*>(toBipolar), .type=TE_FUNCTION1, .context=nullptr},
+        {.name=toBipolarName, .description=toBipolarDesc, .pointer=reinterpret_cast<void*>(toBipolar), .type=TE_FUNCTION1 | TE_FLAG_PURE, .context=nullptr},
 
         // Mapping functions
-        {.name=mapName, .description=mapDesc, .pointer=reinterpret_cast<void*>(map), .type=TE_FUNCTION5, .context=nullptr},
-        {.name=constrainName, .description=constrainDesc, .pointer=reinterpret_cast<void*>(constrain), .type=TE_FUNCTION3, .context=nullptr},
+        {.name=mapName, .description=mapDesc, .pointer=reinterpret_cast<void*>(map), .type=TE_FUNCTION5 | TE_FLAG_PURE, .context=nullptr},
+        {.name=constrainName, .description=constrainDesc, .pointer=reinterpret_cast<void*>(constrain), .type=TE_FUNCTION3 | TE_FLAG_PURE, .context=nullptr},
 
         // Maximum and Minimum functions
-        {.name=maxName, .description=maxDesc, .pointer=reinterpret_cast<void*>(max), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=minName, .description=minDesc, .pointer=reinterpret_cast<void*>(min), .type=TE_FUNCTION2, .context=nullptr},
+        {.name=maxName, .description=maxDesc, .pointer=reinterpret_cast<void*>(max), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=minName, .description=minDesc, .pointer=reinterpret_cast<void*>(min), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
 
         // Rounding
-        {.name=roundName, .description=roundDesc, .pointer=reinterpret_cast<void*>(round), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=roundUpName, .description=roundUpDesc, .pointer=reinterpret_cast<void*>(roundUp), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=roundDownName, .description=roundDownDesc, .pointer=reinterpret_cast<void*>(roundDown), .type=TE_FUNCTION2, .context=nullptr},
+        {.name=roundName, .description=roundDesc, .pointer=reinterpret_cast<void*>(round), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=roundUpName, .description=roundUpDesc, .pointer=reinterpret_cast<void*>(roundUp), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=roundDownName, .description=roundDownDesc, .pointer=reinterpret_cast<void*>(roundDown), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
 
         // Frequency
-        {.name=triangleName, .description=triangleDesc, .pointer=reinterpret_cast<void*>(triangle), .type=TE_FUNCTION1, .context=nullptr},
-        {.name=squareName, .description=squareDesc, .pointer=reinterpret_cast<void*>(square), .type=TE_FUNCTION1, .context=nullptr},
+        {.name=triangleName, .description=triangleDesc, .pointer=reinterpret_cast<void*>(triangle), .type=TE_FUNCTION1 | TE_FLAG_PURE, .context=nullptr},
+        {.name=squareName, .description=squareDesc, .pointer=reinterpret_cast<void*>(square), .type=TE_FUNCTION1 | TE_FLAG_PURE, .context=nullptr},
 
         // More mathematical functions
-        {.name=sgnName, .description=sgnDesc, .pointer=reinterpret_cast<void*>(sgn), .type=TE_FUNCTION1, .context=nullptr},
+        {.name=sgnName, .description=sgnDesc, .pointer=reinterpret_cast<void*>(sgn), .type=TE_FUNCTION1 | TE_FLAG_PURE, .context=nullptr},
 
         // RNG functions
-        {.name=rng2ArgName,.description=rng2ArgDesc,.pointer=reinterpret_cast<void*>(rng2Arg), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=rng3ArgName,.description=rng3ArgDesc,.pointer=reinterpret_cast<void*>(rng3Arg), .type=TE_FUNCTION3, .context=nullptr},
-        {.name=rng2ArgInt16Name,.description=rng2ArgInt16Desc,.pointer=reinterpret_cast<void*>(rng2ArgInt16), .type=TE_FUNCTION2, .context=nullptr},
-        {.name=rng3ArgInt16Name,.description=rng3ArgInt16Desc,.pointer=reinterpret_cast<void*>(rng3ArgInt16), .type=TE_FUNCTION3, .context=nullptr},
+        {.name=rng2ArgName,.description=rng2ArgDesc,.pointer=reinterpret_cast<void*>(rng2Arg), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=rng3ArgName,.description=rng3ArgDesc,.pointer=reinterpret_cast<void*>(rng3Arg), .type=TE_FUNCTION3 | TE_FLAG_PURE, .context=nullptr},
+        {.name=rng2ArgInt16Name,.description=rng2ArgInt16Desc,.pointer=reinterpret_cast<void*>(rng2ArgInt16), .type=TE_FUNCTION2 | TE_FLAG_PURE, .context=nullptr},
+        {.name=rng3ArgInt16Name,.description=rng3ArgInt16Desc,.pointer=reinterpret_cast<void*>(rng3ArgInt16), .type=TE_FUNCTION3 | TE_FLAG_PURE, .context=nullptr},
     };
     return functions;
 }
@@ -3,115 +3,456 @@
 
 // Standard library
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint> // NOLINT
+#include <memory>
+#include <mutex>
 #include <numbers>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
+// External
+#include <absl/container/flat_hash_map.h>
+
 // Nebulite
 #include "Nebulite/Math/Equality.hpp"
 #include "Nebulite/Math/FFT.hpp"
 #include "Nebulite/Utility/Convert/Bits.hpp"
-#include "Nebulite/Utility/Generate.hpp"
-#include "Nebulite/Utility/Ranges.hpp"
 
 //------------------------------------------
 namespace Nebulite::Math {
 
 namespace {
 
-struct BitReversalPermutation {
-    struct Closure : std::ranges::range_adaptor_closure<Closure> {
-        std::size_t n;
-
-        template<std::ranges::input_range R>
-        auto operator()(R&& r) const {
-            auto const bitCount = static_cast<std::size_t>(std::bit_width(n - 1));
-            assert(r.size() == n);
-            assert(std::has_single_bit(n)); // n must be a power of two
-            for (auto const i : Utility::Generate::indices(n)) {
-                if (auto const b = Utility::Convert::Bits::reverse(i, bitCount); i < b) {
-                    std::swap(r[i], r[b]);
+/**
+ * @brief Largest prime factor transformed with the mixed-radix algorithm, lengths with larger ones use Bluestein's algorithm.
+ */
+std::size_t constexpr maxMixedRadix = 31;
+
+/**
+ * @struct Plan
+ * @brief Precomputed tables for transforms of a single length.
+ */
+struct Plan {
+    enum class Kind {
+        trivial,    // Length 0 or 1, nothing to do
+        radix2,     // Power of two: iterative radix-2
+        mixedRadix, // Only prime factors up to maxMixedRadix: recursive mixed-radix
+        bluestein   // Any other length: convolution with a chirp, using a power-of-two transform
+    };
+
+    std::size_t n = 0;
+    Kind kind = Kind::trivial;
+
+    // radix2: index pairs swapped by the bit-reversal permutation
+    std::vector<std::pair<std::size_t, std::size_t>> swaps;
+
+    // radix2: twiddles of each stage, stored contiguously so butterflies vectorize.
+    // The stage with half size h uses W_2h^j for j < h, starting at index h - 1.
+    std::vector<std::complex<double>> stageTwiddles;
+
+    // mixedRadix: prime factors of n, applied from the outermost split inwards
+    std::vector<std::size_t> factors;
+
+    // mixedRadix: W_n^k for k < n
+    std::vector<std::complex<double>> twiddles;
+
+    // bluestein: chirp w_k = exp(-i*pi*k^2/n) for k < n
+    std::vector<std::complex<double>> chirp;
+
+    // bluestein: spectrum of the conjugate chirp, zero-padded and scaled by the inverse length of the inner transform
+    std::vector<std::complex<double>> chirpSpectrum;
+
+    // bluestein: power-of-two transform used for the convolution
+    std::shared_ptr<Plan const> inner;
+
+    // Real transforms of length 2n packed into this plan: W_2n^k for k < n
+    std::vector<std::complex<double>> realTwiddles;
+};
+
+std::complex<double> twiddle(std::size_t const k, std::size_t const n) {
+    return std::polar(1.0, -2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(n));
+}
+
+/**
+ * @brief Complex multiplication without the handling of infinities of std::complex, which prevents vectorization.
+ */
+std::complex<double> multiply(std::complex<double> const a, std::complex<double> const b) {
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+}
+
+std::shared_ptr<Plan const> planFor(std::size_t n);
+
+void forward(Plan const& plan, std::span<std::complex<double>> data);
+
+//------------------------------------------
+// Radix-2
+
+void radix2Butterflies(std::span<std::complex<double>> const data, std::complex<double> const* stageTwiddles, std::size_t const half) {
+    for (std::size_t i = 0; i < data.size(); i += 2 * half) {
+        auto* const a = data.data() + i;
+        auto* const b = a + half;
+        for (std::size_t j = 0; j < half; j++) {
+            auto const u = a[j];
+            auto const v = multiply(b[j], stageTwiddles[j]);
+            a[j] = u + v;
+            b[j] = u - v;
+        }
+    }
+}
+
+/**
+ * @brief Two consecutive radix-2 stages with half sizes h and 2h in a single pass, halving the passes over the data.
+ * @details Computes the same operations as two calls of radix2Butterflies.
+ */
+void radix2ButterfliesFused(std::span<std::complex<double>> const data, std::complex<double> const* stageTwiddles, std::complex<double> const* nextStageTwiddles, std::size_t const half) {
+    for (std::size_t i = 0; i < data.size(); i += 4 * half) {
+        auto* const a0 = data.data() + i;
+        auto* const a1 = a0 + half;
+        auto* const a2 = a1 + half;
+        auto* const a3 = a2 + half;
+        for (std::size_t j = 0; j < half; j++) {
+            auto const v1 = multiply(a1[j], stageTwiddles[j]);
+            auto const v3 = multiply(a3[j], stageTwiddles[j]);
+            auto const b0 = a0[j] + v1;
+            auto const b1 = a0[j] - v1;
+            auto const b2 = multiply(a2[j] + v3, nextStageTwiddles[j]);
+            auto const b3 = multiply(a2[j] - v3, nextStageTwiddles[j + half]);
+            a0[j] = b0 + b2;
+            a2[j] = b0 - b2;
+            a1[j] = b1 + b3;
+            a3[j] = b1 - b3;
+        }
+    }
+}
+
+void radix2(Plan const& plan, std::span<std::complex<double>> const data) {
+    for (auto const& [i, j] : plan.swaps) {
+        std::swap(data[i], data[j]);
+    }
+    // First stage has a twiddle of 1 only
+    for (std::size_t i = 0; i < plan.n; i += 2) {
+        auto const u = data[i];
+        auto const v = data[i + 1];
+        data[i] = u + v;
+        data[i + 1] = u - v;
+    }
+    std::size_t half = 2;
+    for (; 2 * half < plan.n; half *= 4) {
+        radix2ButterfliesFused(data, plan.stageTwiddles.data() + half - 1, plan.stageTwiddles.data() + 2 * half - 1, half);
+    }
+    if (half < plan.n) {
+        radix2Butterflies(data, plan.stageTwiddles.data() + half - 1, half);
+    }
+}
+
+//------------------------------------------
+// Mixed-radix
+
+/**
+ * @brief Decimation in time: transforms the n values of in, spaced by stride, into out.
+ */
+void mixedRadix(Plan const& plan, std::complex<double> const* in, std::complex<double>* out, std::size_t const n, std::size_t const stride, std::size_t const factorIndex) {
+    if (n == 1) {
+        out[0] = in[0];
+        return;
+    }
+    auto const p = plan.factors[factorIndex];
+    auto const m = n / p;
+    for (std::size_t r = 0; r < p; r++) {
+        mixedRadix(plan, in + r * stride, out + r * m, m, stride * p, factorIndex + 1);
+    }
+
+    // Combine the p sub-transforms of length m, W_n^x is W_N^(x*step)
+    auto const step = plan.n / n;
+    if (p == 2) {
+        for (std::size_t k = 0; k < m; k++) {
+            auto const u = out[k];
+            auto const v = multiply(out[m + k], plan.twiddles[k * step]);
+            out[k] = u + v;
+            out[m + k] = u - v;
+        }
+        return;
+    }
+    // Roots of unity W_p^q of the length-p transform
+    std::array<std::complex<double>, maxMixedRadix> roots;
+    for (std::size_t q = 0; q < p; q++) {
+        roots[q] = plan.twiddles[q * (plan.n / p)];
+    }
+    std::array<std::complex<double>, maxMixedRadix> t;
+    for (std::size_t k = 0; k < m; k++) {
+        for (std::size_t r = 0; r < p; r++) {
+            t[r] = multiply(out[r * m + k], plan.twiddles[r * k * step]);
+        }
+        for (std::size_t s = 0; s < p; s++) {
+            std::complex<double> sum = t[0];
+            std::size_t q = 0; // r * s mod p
+            for (std::size_t r = 1; r < p; r++) {
+                q += s;
+                if (q >= p) {
+                    q -= p;
                 }
+                sum += multiply(t[r], roots[q]);
             }
-            return std::forward<R>(r);
+            out[k + m * s] = sum;
         }
-    };
+    }
+}
+
+//------------------------------------------
+// Bluestein
+
+void bluestein(Plan const& plan, std::span<std::complex<double>> const data) {
+    thread_local std::vector<std::complex<double>> scratch;
+    auto const m = plan.inner->n;
+    scratch.assign(m, std::complex<double>(0.0));
+    for (std::size_t k = 0; k < plan.n; k++) {
+        scratch[k] = multiply(data[k], plan.chirp[k]);
+    }
 
-    auto operator()(std::size_t const n) const {
-        return Closure{
-            {}, // NOLINT
-            n,
-        };
+    // Convolution with the conjugate chirp, the inverse transform is done through conjugation
+    forward(*plan.inner, scratch);
+    for (std::size_t k = 0; k < m; k++) {
+        scratch[k] = std::conj(multiply(scratch[k], plan.chirpSpectrum[k]));
     }
-} constexpr bitReversalPermutation;
+    forward(*plan.inner, scratch);
 
-struct ApplyStages {
-    struct Closure : std::ranges::range_adaptor_closure<Closure> {
-        std::size_t const n;
-        double const fullAngle;
+    for (std::size_t k = 0; k < plan.n; k++) {
+        data[k] = multiply(std::conj(scratch[k]), plan.chirp[k]);
+    }
+}
 
-        template<std::ranges::input_range R>
-        static void applyStage(R& r, std::complex<double> const stageTwiddle, std::size_t const stageSize, std::size_t const n) {
-            auto const halfStageSize = stageSize / 2;
+//------------------------------------------
+// Planning
 
-            for (auto const i : Utility::Generate::indices(n) | std::views::stride(stageSize)) {
-                std::complex w(1.0);
+std::vector<std::size_t> primeFactors(std::size_t n) {
+    std::vector<std::size_t> factors;
+    for (std::size_t p = 2; p * p <= n; p++) {
+        while (n % p == 0) {
+            factors.push_back(p);
+            n /= p;
+        }
+    }
+    if (n > 1) {
+        factors.push_back(n);
+    }
+    return factors;
+}
 
-                for (auto const j : Utility::Generate::indices(halfStageSize)) {
-                    auto const u = r[i + j];
-                    auto const v = r[i + j + halfStageSize] * w;
+std::shared_ptr<Plan const> createPlan(std::size_t const n) {
+    auto plan = std::make_shared<Plan>();
+    plan->n = n;
 
-                    r[i + j] = u + v;
-                    r[i + j + halfStageSize] = u - v;
+    plan->realTwiddles.resize(n);
+    for (std::size_t k = 0; k < n; k++) {
+        plan->realTwiddles[k] = twiddle(k, 2 * n);
+    }
 
-                    w *= stageTwiddle;
-                }
+    if (n <= 1) {
+        plan->kind = Plan::Kind::trivial;
+        return plan;
+    }
+
+    if (std::has_single_bit(n)) {
+        plan->kind = Plan::Kind::radix2;
+        auto const bitCount = static_cast<std::size_t>(std::bit_width(n - 1));
+        for (std::size_t i = 0; i < n; i++) {
+            if (auto const b = Utility::Convert::Bits::reverse(i, bitCount); i < b) {
+                plan->swaps.emplace_back(i, b);
             }
         }
-
-        template<std::ranges::input_range R>
-        auto operator()(R&& r) const {
-            for (auto const stageSize : Utility::Generate::powersOfTwo(n)) {
-                double const ang = fullAngle / static_cast<double>(stageSize);
-                std::complex const stageTwiddle(std::cos(ang), std::sin(ang));
-                applyStage(r, stageTwiddle, stageSize, n);
+        plan->stageTwiddles.resize(n - 1);
+        for (std::size_t half = 1; half < n; half *= 2) {
+            for (std::size_t j = 0; j < half; j++) {
+                plan->stageTwiddles[half - 1 + j] = twiddle(j, 2 * half);
             }
-            return std::forward<R>(r);
         }
-    };
+        return plan;
+    }
 
-    double fullAngle;
+    if (auto factors = primeFactors(n); factors.back() <= maxMixedRadix) {
+        plan->kind = Plan::Kind::mixedRadix;
+        plan->factors = std::move(factors);
+        plan->twiddles.resize(n);
+        for (std::size_t k = 0; k < n; k++) {
+            plan->twiddles[k] = twiddle(k, n);
+        }
+        return plan;
+    }
 
-    auto operator()(std::size_t const n) const {
-        return Closure{
-            {}, // NOLINT
-            n,
-            fullAngle,
-        };
+    plan->kind = Plan::Kind::bluestein;
+    plan->chirp.resize(n);
+    for (std::size_t k = 0; k < n; k++) {
+        // k^2 mod 2n keeps the angle small and exact
+        auto const k2 = k * k % (2 * n);
+        plan->chirp[k] = twiddle(k2, 2 * n);
+    }
+    auto const m = std::bit_ceil(2 * n - 1);
+    plan->inner = planFor(m);
+    plan->chirpSpectrum.assign(m, std::complex<double>(0.0));
+    plan->chirpSpectrum[0] = std::conj(plan->chirp[0]);
+    for (std::size_t k = 1; k < n; k++) {
+        plan->chirpSpectrum[k] = plan->chirpSpectrum[m - k] = std::conj(plan->chirp[k]);
     }
+    forward(*plan->inner, plan->chirpSpectrum);
+    for (auto& c : plan->chirpSpectrum) {
+        c /= static_cast<double>(m);
+    }
+    return plan;
+}
+
+/**
+ * @struct PlanCache
+ * @brief Plans of all lengths transformed recently, shared by all threads.
+ */
+struct PlanCache {
+    /**
+     * @brief Maximum number of cached plans, the least recently used one is evicted once exceeded.
+     * @details Guards against unbounded growth from arrays of many different lengths.
+     *          Plans in use are kept alive by their users, including the inner plans of Bluestein plans.
+     */
+    static std::size_t constexpr capacity = 64;
+
+    struct Entry {
+        std::shared_ptr<Plan const> plan;
+        std::uint64_t lastUse = 0;
+    };
+
+    absl::flat_hash_map<std::size_t, Entry> entries;
+    std::uint64_t uses = 0;
+    std::mutex mtx;
 };
 
-inline constexpr ApplyStages applyStagesForward{ -2.0 * std::numbers::pi };
-inline constexpr ApplyStages applyStagesInverse{ 2.0 * std::numbers::pi };
+/**
+ * @brief Gets the plan of a length, creating it on first use.
+ */
+std::shared_ptr<Plan const> planFor(std::size_t const n) {
+    // The last plan of each thread is kept, as the same length is usually transformed repeatedly
+    thread_local std::shared_ptr<Plan const> last;
+    if (last != nullptr && last->n == n) {
+        return last;
+    }
+
+    static PlanCache cache;
+    {
+        std::scoped_lock const lock(cache.mtx);
+        if (auto const it = cache.entries.find(n); it != cache.entries.end()) {
+            it->second.lastUse = ++cache.uses;
+            last = it->second.plan;
+            return last;
+        }
+    }
+
+    // Create outside the lock, Bluestein plans depend on another plan
+    auto plan = createPlan(n);
+    std::scoped_lock const lock(cache.mtx);
+    if (cache.entries.size() >= PlanCache::capacity && !cache.entries.contains(n)) {
+        auto const oldest = std::ranges::min_element(cache.entries, {}, [](auto const& pair) { return pair.second.lastUse; });
+        cache.entries.erase(oldest);
+    }
+    auto& cached = cache.entries[n];
+    cached = {.plan = std::move(plan), .lastUse = ++cache.uses};
+    last = cached.plan;
+    return last;
+}
+
+void forward(Plan const& plan, std::span<std::complex<double>> const data) {
+    assert(data.size() == plan.n);
+    switch (plan.kind) {
+        case Plan::Kind::trivial:
+            break;
+        case Plan::Kind::radix2:
+            radix2(plan, data);
+            break;
+        case Plan::Kind::mixedRadix: {
+            thread_local std::vector<std::complex<double>> scratch;
+            scratch.assign(data.begin(), data.end());
+            mixedRadix(plan, scratch.data(), data.data(), plan.n, 1, 0);
+            break;
+        }
+        case Plan::Kind::bluestein:
+            bluestein(plan, data);
+            break;
+        default:
+            std::unreachable();
+    }
+}
 
 } // namespace
 
+void Fft::transform(std::span<std::complex<double>> const data) {
+    auto const plan = planFor(data.size());
+    forward(*plan, data);
+}
+
+void Fft::transformInverse(std::span<std::complex<double>> const data) {
+    // The inverse transform is the conjugate of the forward transform of the conjugate
+    for (auto& c : data) {
+        c = std::conj(c);
+    }
+    transform(data);
+    auto const scale = 1.0 / static_cast<double>(data.size());
+    for (auto& c : data) {
+        c = std::conj(c) * scale;
+    }
+}
+
+std::vector<std::complex<double>> Fft::transformReal(std::span<double const> const data) {
+    auto const n = data.size();
+    if (n == 0) {
+        return {};
+    }
+    if (n % 2 != 0) {
+        // Odd lengths cannot be packed, use a complex transform
+        std::vector<std::complex<double>> a(data.begin(), data.end());
+        transform(a);
+        a.resize(n / 2 + 1);
+        return a;
+    }
+
+    // Pack even and odd samples into the real and imaginary parts of a transform of half the length
+    auto const h = n / 2;
+    std::vector<std::complex<double>> z(h);
+    for (std::size_t k = 0; k < h; k++) {
+        z[k] = std::complex(data[2 * k], data[2 * k + 1]);
+    }
+    auto const plan = planFor(h);
+    forward(*plan, z);
+
+    // Separate the spectra of even and odd samples, then combine them
+    std::vector<std::complex<double>> result(h + 1);
+    for (std::size_t k = 0; k <= h; k++) {
+        auto const zk = z[k % h];
+        auto const zc = std::conj(z[(h - k) % h]);
+        auto const even = (zk + zc) * 0.5;
+        auto const odd = multiply(zk - zc, std::complex(0.0, -0.5));
+        auto const w = k < h ? plan->realTwiddles[k] : std::complex(-1.0, 0.0);
+        result[k] = even + multiply(w, odd);
+    }
+    return result;
+}
+
 std::vector<std::complex<double>> Fft::fft(std::vector<double> const& data) {
     if (data.empty()) return {};
     auto const n = std::bit_ceil(data.size()); // next power of two
-    std::vector<std::complex<double>> a(n); // Initialized to 0.0
-    std::copy_n(data.begin(), data.size(), a.begin());
-    return a
-        | bitReversalPermutation(n)
-        | applyStagesForward(n)
-        | std::ranges::to<std::vector<std::complex<double>>>();
+    std::vector<double> padded(n); // Initialized to 0.0
+    std::ranges::copy(data, padded.begin());
+
+    // Spectrum of real data is conjugate-symmetric, the upper half mirrors the lower half
+    auto a = transformReal(padded);
+    a.resize(n);
+    for (std::size_t k = n / 2 + 1; k < n; k++) {
+        a[k] = std::conj(a[n - k]);
+    }
+    return a;
 }
 
 std::vector<std::complex<double>> Fft::fftInverse(std::vector<std::complex<double>> const& xValues) {
@@ -119,11 +460,8 @@ std::vector<std::complex<double>> Fft::fftInverse(std::vector<std::complex<doubl
     if (n == 0) return {};
     std::vector<std::complex<double>> a = xValues;
     a.resize(n);
-    return a
-        | bitReversalPermutation(n)
-        | applyStagesInverse(n)
-        | Utility::Ranges::normalize(n)
-        | std::ranges::to<std::vector<std::complex<double>>>();
+    transformInverse(a);
+    return a;
 }
 
 namespace {
@@ -22,6 +22,8 @@ void RmlUiModule::update() {}
 
 void RmlUiModule::postRenderUpdate() {}
 
+void RmlUiModule::addUpdateStats(Graphics::RmlInterface::UpdateStats& /*stats*/) const {}
+
 void RmlUiModule::processRmlUiEvent(SDL_Event const& /*event*/, int const /*keyModifiers*/, Rml::Element* /*focusElement*/) {}
 
 } // namespace Nebulite::Module::Base
@@ -34,11 +34,12 @@ Constants::Event Ruleset::updateHook() {
             Key const scopedKey(moduleScope);
             auto mtx = moduleScope.lock();
             Interaction::Rules::Construction::RulesetCompiler::parse(rulesetsGlobal, rulesetsLocal, domain, moduleScope.shareScope(scopedKey.broadcast));
-            listeners.clear();
+            unsubscribeAll();
             for (std::size_t idx = 0; idx < subscriptionSize; idx++) {
                 auto const key = scopedKey.listen.addIndex(idx);
                 auto const subscription = moduleScope.get<std::string>(key).value_or("");
                 auto listener = std::make_shared<Interaction::Rules::Listener>(domain, subscription);
+                Global::instance().subscribe(listener);
                 listeners.push_back(listener);
             }
 
@@ -79,9 +80,9 @@ Constants::Event Ruleset::updateHook() {
             }
         }
 
-        // Listen to broadcasts from subscribed topics
+        // Listen to broadcasts from subscribed topics, registered persistently on reload
         for (auto const& listener : listeners) {
-            Global::instance().listen(listener);
+            listener->activate();
         }
 
         // Broadcast global rulesets
@@ -96,6 +97,10 @@ Constants::Event Ruleset::updateHook() {
     return Constants::Event::success;
 }
 
+Ruleset::~Ruleset() {
+    unsubscribeAll();
+}
+
 void Ruleset::reinit() {
     std::scoped_lock const lock(initializeMutex);
     Key const scopedKey(moduleScope);
@@ -157,4 +162,14 @@ Constants::Event Ruleset::listen(std::span<std::string_view const> const& args)
     return Constants::Event::success;
 }
 
+//------------------------------------------
+// Private methods
+
+void Ruleset::unsubscribeAll() {
+    for (auto const& listener : listeners) {
+        listener->unsubscribe();
+    }
+    listeners.clear();
+}
+
 } // namespace Nebulite::Module::Domain::Common
@@ -12,7 +12,9 @@
 // Nebulite
 #include "Nebulite/Constants/Event.hpp"
 #include "Nebulite/Core/Environment.hpp"
+#include "Nebulite/Core/RenderObject.hpp"
 #include "Nebulite/Data/Batch.hpp"
+#include "Nebulite/Data/Document/DocumentMemoryUsage.hpp"
 #include "Nebulite/Data/Tiling.hpp"
 #include "Nebulite/Module/Domain/Environment/Debug.hpp"
 #include "Nebulite/Utility/Ranges.hpp"
@@ -23,14 +25,23 @@ namespace Nebulite::Module::Domain::Environment {
 Constants::Event Debug::updateHook() {
     std::size_t containerTotalTiles = 0;
     std::size_t containerTotalCost = 0;
+    double reinsertionDurationMs = 0.0;
+    std::size_t reinsertionCheckedObjects = 0;
+    std::size_t reinsertionMovedObjects = 0;
     for (auto const& layer : domain.getAllLayers()) {
         // NOLINTNEXTLINE
         auto const& info = layer.getContainerInfo();
         containerTotalTiles += info.containerTotalTiles;
         containerTotalCost += info.containerTotalCost;
+        reinsertionDurationMs += info.reinsertionDurationMs;
+        reinsertionCheckedObjects += info.reinsertionCheckedObjects;
+        reinsertionMovedObjects += info.reinsertionMovedObjects;
     }
     moduleScope.set<size_t>(Key::containerTotalTiles, containerTotalTiles);
     moduleScope.set<size_t>(Key::containerTotalCost, containerTotalCost);
+    moduleScope.set<double>(Key::reinsertionDurationMs, reinsertionDurationMs);
+    moduleScope.set<size_t>(Key::reinsertionCheckedObjects, reinsertionCheckedObjects);
+    moduleScope.set<size_t>(Key::reinsertionMovedObjects, reinsertionMovedObjects);
     return Constants::Event::success;
 }
 
@@ -65,4 +76,31 @@ Constants::Event Debug::fetchContainer() const {
     return Constants::Event::success;
 }
 
+Constants::Event Debug::fetchMemory() const {
+    std::size_t objectCount = 0;
+    Data::DocumentMemoryUsage documentUsage;
+    domain.containerIteration([&](Data::TileCoordinate const& /*tileCoordinate*/, Core::Environment::Layer const /*layer*/, Data::Tile const& tile) {
+        for (auto const& batch : tile.getBatches()) {
+            for (auto const* obj : batch.objects) {
+                documentUsage += obj->getDocumentMemoryUsage();
+                objectCount++;
+            }
+        }
+    });
+
+    // Average over all objects
+    auto const perObject = [objectCount](std::size_t const bytes) {
+        return objectCount == 0 ? 0.0 : static_cast<double>(bytes) / static_cast<double>(objectCount);
+    };
+    std::size_t const objectBytes = objectCount * sizeof(Core::RenderObject);
+    moduleScope.set<size_t>(Key::memoryObjectCount, objectCount);
+    moduleScope.set<double>(Key::memoryBytesPerObject.addMember("object"), perObject(objectBytes));
+    moduleScope.set<double>(Key::memoryBytesPerObject.addMember("document"), perObject(documentUsage.document));
+    moduleScope.set<double>(Key::memoryBytesPerObject.addMember("cache"), perObject(documentUsage.cache));
+    moduleScope.set<double>(Key::memoryBytesPerObject.addMember("cacheLine"), perObject(documentUsage.cacheLine));
+    moduleScope.set<double>(Key::memoryBytesPerObject.addMember("orderedCacheLists"), perObject(documentUsage.orderedCacheLists));
+    moduleScope.set<double>(Key::memoryBytesPerObject.addMember("total"), perObject(objectBytes + documentUsage.total()));
+    return Constants::Event::success;
+}
+
 } // namespace Nebulite::Module::Domain::Environment
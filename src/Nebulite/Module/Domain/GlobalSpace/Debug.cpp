@@ -2,8 +2,11 @@
 // Includes
 
 // Standard library
+#include <algorithm>
+#include <chrono>
 #include <csignal>
 #include <cstddef>
+#include <cstdint> // NOLINT
 #include <cstdlib>
 #include <exception>
 #include <ios>
@@ -12,6 +15,12 @@
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// External
+#include <absl/container/flat_hash_map.h>
 
 // Nebulite
 #include "Nebulite/Constants/Event.hpp"
@@ -19,12 +28,16 @@
 #include "Nebulite/Constants/ThreadSettings.hpp"
 #include "Nebulite/Core/GlobalSpace.hpp"
 #include "Nebulite/Core/RenderObject.hpp"
+#include "Nebulite/Data/SlabPool.hpp"
 #include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Math/ExpressionPrimitives.hpp"
 #include "Nebulite/Module/Domain/Common/General.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/Debug.hpp"
+#include "Nebulite/Module/Domain/GlobalSpace/Settings.hpp"
 #include "Nebulite/Nebulite.hpp"
 #include "Nebulite/Utility/Coordination/TimedRoutine.hpp"
+#include "Nebulite/Utility/Io/AsyncLog.hpp"
+#include "Nebulite/Utility/Io/Capture.hpp"
 #include "Nebulite/Utility/Io/FileManagement.hpp"
 
 //------------------------------------------
@@ -171,6 +184,40 @@ Constants::Event Debug::logState(int const argc, char const** argv) const {
     return Constants::Event::success;
 }
 
+Constants::Event Debug::logAsync(std::span<std::string_view const> const& args) {
+    if (args.size() < 2) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(Global::capture());
+    }
+    if (args.size() > 2) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(Global::capture());
+    }
+    if (args[1] == "on") {
+        Utility::Io::AsyncLog::enable();
+    } else if (args[1] == "off") {
+        Utility::Io::AsyncLog::disable();
+    } else {
+        Global::capture().warning.println("Unknown argument '", args[1], "', expected 'on' or 'off'.");
+        return Constants::Event::warning;
+    }
+    return Constants::Event::success;
+}
+
+Constants::Event Debug::logHistoryLimit(std::span<std::string_view const> const& args) {
+    if (args.size() < 2) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(Global::capture());
+    }
+    if (args.size() > 2) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(Global::capture());
+    }
+    try {
+        Utility::Io::Capture::setHistoryLimit(std::stoull(std::string(args[1])));
+    } catch (std::exception const&) {
+        Global::capture().warning.println("Invalid line count: ", args[1]);
+        return Constants::Event::warning;
+    }
+    return Constants::Event::success;
+}
+
 Constants::Event Debug::standardFileRenderObject(std::span<std::string_view const> const& /*args*/) const {
     if (Core::RenderObject const ro(domain.capture); !Utility::Io::FileManagement::writeFile("./Resources/Renderobjects/standard.jsonc", ro.serialize())) {
         return Constants::StandardCapture::Error::File::couldNotWriteFile(domain.capture);
@@ -185,6 +232,8 @@ Constants::Event Debug::errorLog(std::span<std::string_view const> const& args,
     }
 
     if (args.size() == 2) {
+        // Pending output belongs to the current error stream
+        Utility::Io::AsyncLog::flush();
         if (args[1] == "on") {
             if (!errorLogStatus) {
                 if (!safeOpenLog(errorFile)) {
@@ -318,6 +367,54 @@ void Debug::addRoutines() {
         )
     );
 
+    // Pool allocation monitoring routine
+    addRoutine<RoutineUpdateMode::beforeUpdateHook>(
+        Utility::Coordination::TimedRoutine(
+            [this, previous = absl::flat_hash_map<std::string, Data::SlabPool::Stats>(), lastTime = std::chrono::steady_clock::now()]() mutable {
+                // store allocation stats of all pools in global document
+                auto const now = std::chrono::steady_clock::now();
+                double const seconds = std::max(std::chrono::duration<double>(now - lastTime).count(), 1e-3);
+                lastTime = now;
+                // Copy the stats first, setting values may allocate while the pool registry is locked
+                std::vector<std::pair<std::string_view, Data::SlabPool::Stats>> pools;
+                Data::SlabPool::forEach([&pools](Data::SlabPool const& pool) {
+                    pools.emplace_back(pool.getName(), pool.getStats());
+                });
+                for (auto const& [name, stats] : pools) {
+                    auto& last = previous[name];
+                    auto const key = Key::memoryPools.addMember(name);
+                    moduleScope.set<size_t>(key.addMember("live"), stats.live);
+                    moduleScope.set<size_t>(key.addMember("capacity"), stats.capacity);
+                    moduleScope.set<size_t>(key.addMember("allocations"), stats.allocations);
+                    moduleScope.set<size_t>(key.addMember("frees"), stats.frees);
+                    moduleScope.set<double>(key.addMember("allocationsPerSecond"), static_cast<double>(stats.allocations - last.allocations) / seconds);
+                    moduleScope.set<double>(key.addMember("freesPerSecond"), static_cast<double>(stats.frees - last.frees) / seconds);
+                    last = stats;
+                }
+            },
+            1000 /*ms*/, // Call every second
+            Utility::Coordination::TimedRoutine::ConstructionMode::startImmediately
+        )
+    );
+
+    // Text cache monitoring routine
+    addRoutine<RoutineUpdateMode::beforeUpdateHook>(
+        Utility::Coordination::TimedRoutine(
+            [this] {
+                // store text cache counters in global document, strings not served from the LRU were composed or rasterized
+                auto const stats = domain.getRenderer().getTextCache().getStats();
+                moduleScope.set<size_t>(Key::textCacheHits, stats.hits);
+                moduleScope.set<size_t>(Key::textCacheComposed, stats.composed);
+                moduleScope.set<size_t>(Key::textCacheReused, stats.reused);
+                moduleScope.set<size_t>(Key::textCacheRasterized, stats.rasterized);
+                moduleScope.set<size_t>(Key::textCacheGlyphs, stats.glyphs);
+                moduleScope.set<size_t>(Key::textCacheAtlasPages, stats.atlasPages);
+            },
+            1000 /*ms*/, // Call every second
+            Utility::Coordination::TimedRoutine::ConstructionMode::startImmediately
+        )
+    );
+
     addRoutine<RoutineUpdateMode::beforeUpdateHook>(
         Utility::Coordination::TimedRoutine(
             [this] {
@@ -381,4 +478,13 @@ void Debug::setupDebugInfo() const {
     }
 }
 
+void Debug::setupLogging() const {
+    using SettingsKey = Settings::Key;
+    auto const& settings = Global::settings();
+    Utility::Io::Capture::setHistoryLimit(settings.get<uint32_t>(SettingsKey::logHistoryLimit).value_or(static_cast<uint32_t>(Utility::Io::Capture::defaultHistoryLimit)));
+    if (settings.get<bool>(SettingsKey::logAsync).value_or(false)) {
+        Utility::Io::AsyncLog::enable();
+    }
+}
+
 } // namespace Nebulite::Module::Domain::GlobalSpace
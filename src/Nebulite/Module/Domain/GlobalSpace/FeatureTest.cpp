@@ -2,21 +2,46 @@
 // Includes
 
 // Standard library
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint> // NOLINT
+#include <exception>
+#include <numbers>
+#include <optional>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <ranges>
 #include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 // Nebulite
+#include "Nebulite/Audio/Mixer.hpp"
 #include "Nebulite/Constants/Event.hpp"
 #include "Nebulite/Constants/StandardCapture.hpp"
 #include "Nebulite/Core/GlobalSpace.hpp"
+#include "Nebulite/Core/RenderObject.hpp"
+#include "Nebulite/Data/ComponentPool.hpp"
 #include "Nebulite/Data/Document/Json.hpp"
+#include "Nebulite/Data/Document/JsonScope.hpp"
+#include "Nebulite/Data/Document/JsonTransformer.hpp"
 #include "Nebulite/Data/Document/ScopedKey.hpp"
+#include "Nebulite/Data/RenderObjectContainer.hpp"
+#include "Nebulite/Data/Tiling.hpp"
+#include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Interaction/Logic/Expression.hpp"
+#include "Nebulite/Interaction/Rules/Construction/RulesetCompiler.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/FeatureTest.hpp"
 #include "Nebulite/Utility/Args/FuncTree.hpp"
+#include "Nebulite/Utility/Promise.hpp"
 #include "Nebulite/Utility/StringHandler.hpp"
 
 //------------------------------------------
@@ -31,6 +56,10 @@ Constants::Event FeatureTest::updateHook() {
 namespace {
 class MathModifier {
 public:
+    static double identity(std::span<std::string_view const> const& /*args*/, double const input) {
+        return input;
+    }
+
     static double add(std::span<std::string_view const> const& args, double const input) {
         double sum = input;
         // Add all arguments but the first (which is the function name)
@@ -44,6 +73,11 @@ public:
         }
         return sum;
     }
+
+    template <int value>
+    static double constant(std::span<std::string_view const> const& /*args*/, double const /*input*/) {
+        return value;
+    }
 };
 } // namespace
 
@@ -92,6 +126,690 @@ Constants::Event FeatureTest::selfOtherGlobalEvaluation() const {
     return Constants::Event::success;
 }
 
+Constants::Event FeatureTest::dispatchBenchmark(std::span<std::string_view const> const& args) const {
+    if (args.size() < 2) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
+    if (args.size() > 2) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(domain.capture);
+    }
+    std::size_t iterations = 0;
+    try {
+        iterations = std::stoull(std::string(args[1]));
+    } catch (std::exception const&) {
+        domain.capture.warning.println("Invalid iteration count: ", args[1]);
+        return Constants::Event::warning;
+    }
+
+    // Chain of trees, ordered from the deepest inherited tree to the tree commands are parsed in
+    using Tree = Utility::Args::FuncTree<double, double>;
+    std::size_t constexpr functionsPerTree = 32;
+    std::vector<std::shared_ptr<Tree>> trees;
+    std::vector<std::string> commandNames;
+    for (std::string_view const treeName : {"RenderObject", "Environment", "Renderer", "GlobalSpace"}) {
+        auto& tree = trees.emplace_back(std::make_shared<Tree>(treeName, 0.0, std::numeric_limits<double>::quiet_NaN(), domain.capture));
+        for (std::size_t i = 0; i < functionsPerTree; i++) {
+            auto const name = std::string(treeName) + "-function-" + std::to_string(i);
+            bindFunctionStatic(tree.get(), &MathModifier::identity, name, "Returns the input.");
+            if (trees.size() == 1) {
+                commandNames.push_back(name);
+            }
+        }
+        if (trees.size() > 1) {
+            tree->inherit(trees[trees.size() - 2]);
+        }
+    }
+    auto& root = *trees.back();
+    auto& owner = *trees.front();
+
+    // Commands resolved in the deepest tree, the worst case for resolving tree by tree
+    std::vector<std::vector<std::string_view>> commands;
+    commands.reserve(commandNames.size());
+    for (auto const& name : commandNames) {
+        commands.push_back({"<benchmark>", name});
+    }
+
+    auto measure = [iterations, &commands](auto const& parse) {
+        double checksum = 0.0;
+        auto const start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (auto const& command : commands) {
+                checksum += parse(command, static_cast<double>(i));
+            }
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::pair(std::chrono::duration<double, std::milli>(end - start).count(), checksum);
+    };
+
+    // Resolving tree by tree, as before the dispatch table existed
+    auto const [walkMs, walkSum] = measure([&root](std::vector<std::string_view> const& command, double const input) {
+        return root.parseStepwise(command, input);
+    });
+    auto const [tableMs, tableSum] = measure([&root](std::vector<std::string_view> const& command, double const input) {
+        return root.parse(command, input);
+    });
+    auto const [directMs, directSum] = measure([&owner](std::vector<std::string_view> const& command, double const input) {
+        return owner.parse(command, input);
+    });
+
+    if (walkSum != tableSum || walkSum != directSum) {
+        domain.capture.error.println("Dispatch results differ: ", walkSum, " ", tableSum, " ", directSum);
+        return Constants::Event::error;
+    }
+    auto const calls = static_cast<double>(iterations * commands.size());
+    domain.capture.log.println("Trees: ", trees.size(), ", functions per tree: ", functionsPerTree, ", calls: ", iterations * commands.size());
+    domain.capture.log.println("Tree walk:      ", walkMs, " ms (", calls > 0.0 ? walkMs * 1e6 / calls : 0.0, " ns/call)");
+    domain.capture.log.println("Dispatch table: ", tableMs, " ms (", calls > 0.0 ? tableMs * 1e6 / calls : 0.0, " ns/call)");
+    domain.capture.log.println("Owning tree:    ", directMs, " ms (", calls > 0.0 ? directMs * 1e6 / calls : 0.0, " ns/call)");
+    return Constants::Event::success;
+}
+
+Constants::Event FeatureTest::dispatchPrecedence() const {
+    // Same chain as the dispatch benchmark, each tree returns its position in the chain
+    using Tree = Utility::Args::FuncTree<double, double>;
+    auto renderObject = std::make_shared<Tree>("RenderObject", 0.0, std::numeric_limits<double>::quiet_NaN(), domain.capture);
+    auto environment = std::make_shared<Tree>("Environment", 0.0, std::numeric_limits<double>::quiet_NaN(), domain.capture);
+    auto renderer = std::make_shared<Tree>("Renderer", 0.0, std::numeric_limits<double>::quiet_NaN(), domain.capture);
+    auto globalSpace = std::make_shared<Tree>("GlobalSpace", 0.0, std::numeric_limits<double>::quiet_NaN(), domain.capture);
+
+    // Bound before inheriting, inheriting trees may not bind names of their inherited trees
+    bindFunctionStatic(renderObject.get(), &MathModifier::constant<1>, "shared", "Returns 1.");
+    bindFunctionStatic(environment.get(), &MathModifier::constant<2>, "shared", "Returns 2.");
+    bindFunctionStatic(renderer.get(), &MathModifier::constant<3>, "shared", "Returns 3.");
+    bindFunctionStatic(globalSpace.get(), &MathModifier::constant<4>, "shared", "Returns 4.");
+    bindFunctionStatic(renderObject.get(), &MathModifier::constant<1>, "partial", "Returns 1.");
+    bindFunctionStatic(environment.get(), &MathModifier::constant<2>, "partial", "Returns 2.");
+    bindFunctionStatic(renderObject.get(), &MathModifier::constant<1>, "deep", "Returns 1.");
+    renderer->bindCategory("category", "Category shadowing a function of an inherited tree.");
+    bindFunctionStatic(renderer.get(), &MathModifier::constant<3>, "category function", "Returns 3.");
+    bindFunctionStatic(renderObject.get(), &MathModifier::constant<1>, "category", "Returns 1.");
+
+    environment->inherit(renderObject);
+    renderer->inherit(environment);
+    globalSpace->inherit(renderer);
+
+    std::size_t mismatches = 0;
+    auto compare = [&](std::string_view const treeName, Tree& tree, std::string_view const command) {
+        auto args = Utility::StringHandler::split(command, ' ');
+        args.insert(args.begin(), "<test>");
+        std::vector<std::string_view> const argsView(args.begin(), args.end());
+        double const table = tree.parse(argsView, 0.0);
+        double const stepwise = tree.parseStepwise(argsView, 0.0);
+        if (table != stepwise) {
+            domain.capture.error.println(treeName, " ", command, ": dispatch table ", table, " differs from stepwise lookup ", stepwise);
+            mismatches++;
+        }
+        domain.capture.log.println(treeName, " ", command, ": ", table);
+    };
+    for (auto const& [treeName, tree] : {std::pair{"GlobalSpace", globalSpace}, std::pair{"Renderer", renderer}}) {
+        for (std::string_view const command : {"shared", "partial", "deep", "category function"}) {
+            compare(treeName, *tree, command);
+        }
+    }
+
+    // Binding after the tables were built must invalidate them
+    bindFunctionStatic(environment.get(), &MathModifier::constant<2>, "late", "Returns 2.");
+    bindFunctionStatic(renderObject.get(), &MathModifier::constant<1>, "late", "Returns 1.");
+    compare("GlobalSpace", *globalSpace, "late");
+    return mismatches == 0 ? Constants::Event::success : Constants::Event::error;
+}
+
+// Expressions
+
+Constants::Event FeatureTest::expressionBenchmark(std::span<std::string_view const> const& args, Interaction::Context const& /*ctx*/, Interaction::ContextScope const& ctxScope) const {
+    if (args.size() < 3) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
+    std::size_t iterations = 0;
+    try {
+        iterations = std::stoull(std::string(args[1]));
+    } catch (std::exception const&) {
+        domain.capture.warning.println("Invalid iteration count: ", args[1]);
+        return Constants::Event::warning;
+    }
+
+    Interaction::Logic::Expression const expr(Utility::StringHandler::recombineArgs(args.subspan(2)));
+    if (!expr.isReturnableAsDouble()) {
+        domain.capture.warning.println("Expression is not returnable as double: ", expr.getFullExpression());
+        return Constants::Event::warning;
+    }
+    Utility::Promise<&Interaction::Logic::Expression::isReturnableAsDouble> constexpr promise{};
+
+    // Both paths must agree, NaN results included
+    double const reference = expr.evalAsDoubleWithTinyExpr(ctxScope, promise);
+    double const result = expr.evalAsDouble(ctxScope, promise);
+    if (result != reference && !(std::isnan(result) && std::isnan(reference))) {
+        domain.capture.error.println("Bytecode result ", result, " differs from TinyExpr result ", reference);
+        return Constants::Event::error;
+    }
+
+    auto measure = [&](auto const& evaluate) {
+        double sum = 0.0;
+        auto const start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; i++) {
+            sum += evaluate();
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::pair{std::chrono::duration<double, std::milli>(end - start).count(), sum};
+    };
+    auto const [tinyExprMs, tinyExprSum] = measure([&]{ return expr.evalAsDoubleWithTinyExpr(ctxScope, promise); });
+    auto const [bytecodeMs, bytecodeSum] = measure([&]{ return expr.evalAsDouble(ctxScope, promise); });
+
+    domain.capture.log.println("Result: ", result);
+    domain.capture.log.println("TinyExpr: ", tinyExprMs, " ms (checksum ", tinyExprSum, ")");
+    domain.capture.log.println("Bytecode: ", bytecodeMs, " ms (checksum ", bytecodeSum, ")");
+    domain.capture.log.println("Speedup:  ", bytecodeMs > 0.0 ? tinyExprMs / bytecodeMs : 0.0, "x");
+    return Constants::Event::success;
+}
+
+// Documents
+
+Constants::Event FeatureTest::jsonCacheBenchmark(std::span<std::string_view const> const& args) const {
+    if (args.size() < 2) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
+    if (args.size() > 2) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(domain.capture);
+    }
+    std::size_t iterations = 0;
+    try {
+        iterations = std::stoull(std::string(args[1]));
+    } catch (std::exception const&) {
+        domain.capture.warning.println("Invalid iteration count: ", args[1]);
+        return Constants::Event::warning;
+    }
+    if (iterations == 0) {
+        domain.capture.warning.println("Iteration count must be positive");
+        return Constants::Event::warning;
+    }
+
+    for (std::size_t const keyCount : {10UZ, 100UZ, 1000UZ}) {
+        // Fill the cache, the accessed key has no children
+        Data::Json doc;
+        for (std::size_t i = 0; i < keyCount; i++) {
+            doc.set<double>("values.key" + std::to_string(i), static_cast<double>(i));
+        }
+        std::string const key = "values.key" + std::to_string(keyCount / 2);
+
+        auto measure = [iterations](auto const& access) {
+            auto const start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < iterations; i++) {
+                access(i);
+            }
+            auto const end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+        };
+        double checksum = 0.0;
+        double const getNs = measure([&](std::size_t) { checksum += doc.get<double>(key).value_or(0.0); });
+        double const setNs = measure([&](std::size_t const i) { doc.set<double>(key, static_cast<double>(i)); });
+
+        // Every read returns the initial value, the last write must be visible
+        auto const expectedSum = static_cast<double>(iterations) * static_cast<double>(keyCount / 2);
+        if (checksum != expectedSum || doc.get<double>(key).value_or(-1.0) != static_cast<double>(iterations - 1)) {
+            domain.capture.error.println("Unexpected values for ", keyCount, " keys: checksum ", checksum, ", expected ", expectedSum);
+            return Constants::Event::error;
+        }
+        domain.capture.log.println(keyCount, " keys: get ", getNs, " ns, set ", setNs, " ns (checksum ", checksum, ")");
+    }
+    return Constants::Event::success;
+}
+
+Constants::Event FeatureTest::transformationMemo() const {
+    std::string_view constexpr key = "arr|sort numerically|first";
+
+    Data::Json docA;
+    Data::Json docB;
+    std::array constexpr valuesA = {3, 1, 2};
+    std::array constexpr valuesB = {9, 8, 7};
+    for (std::size_t i = 0; i < valuesA.size(); i++) {
+        docA.set<int>("arr[" + std::to_string(i) + "]", valuesA[i]);
+        docB.set<int>("arr[" + std::to_string(i) + "]", valuesB[i]);
+    }
+
+    auto retrieve = [&](std::string_view const name, Data::Json const& doc) {
+        auto const result = doc.get<int>(key);
+        auto& memo = doc.getPipelineMemo();
+        std::scoped_lock const lock(memo.mutex);
+        domain.capture.log.println(name, ": ", result.value_or(-1), ", hits: ", memo.hits, ", misses: ", memo.misses);
+    };
+
+    retrieve("A", docA); // Computed
+    retrieve("A", docA); // Memoized
+    retrieve("B", docB); // Computed, B has its own memo
+    retrieve("A", docA); // Still memoized, B did not evict it
+    docA.set<int>("arr[0]", 0);
+    retrieve("A", docA); // Input changed, computed again
+    retrieve("A", docA); // Memoized
+    return Constants::Event::success;
+}
+
+// Objects
+
+Constants::Event FeatureTest::objectLookupBenchmark(std::span<std::string_view const> const& args) const {
+    if (args.size() < 2) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
+    if (args.size() > 2) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(domain.capture);
+    }
+    std::size_t objectCount = 0;
+    try {
+        objectCount = std::stoull(std::string(args[1]));
+    } catch (std::exception const&) {
+        domain.capture.warning.println("Invalid object count: ", args[1]);
+        return Constants::Event::warning;
+    }
+
+    // Standalone container, not part of the renderer
+    Data::RenderObjectContainer container;
+    Data::TilingInformation const tilingInformation(static_cast<std::uint16_t>(128), static_cast<std::uint16_t>(128));
+    std::vector<std::size_t> ids;
+    ids.reserve(objectCount);
+    for (std::size_t i = 0; i < objectCount; i++) {
+        auto* ro = new Core::RenderObject(domain.capture);
+        ids.push_back(ro->getId());
+        container.append(ro, tilingInformation);
+    }
+
+    // Reference: walk all tiles and batches, as done before objects were indexed
+    auto linearLookup = [&container](std::size_t const domainId) {
+        Core::RenderObject* found = nullptr;
+        container.containerIteration<std::size_t>([&found](Data::TileCoordinate const&, std::size_t const& searchId, Data::Tile const& tile) {
+            for (auto const& objects : tile.getBatchedObjects()) {
+                for (auto* const object : objects) {
+                    if (object->getId() == searchId) {
+                        found = object;
+                    }
+                }
+            }
+        }, domainId);
+        return found;
+    };
+
+    auto measure = [](std::span<std::size_t const> const lookupIds, auto const& lookup) {
+        std::size_t misses = 0;
+        auto const start = std::chrono::steady_clock::now();
+        for (auto const id : lookupIds) {
+            if (auto const* object = lookup(id); object == nullptr || object->getId() != id) {
+                misses++;
+            }
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::pair{std::chrono::duration<double, std::milli>(end - start).count(), misses};
+    };
+    std::span<std::size_t const> const allIds(ids);
+    auto const [indexedMs, indexedMisses] = measure(allIds, [&container](std::size_t const id) { return container.getObjectFromId(id); });
+    auto const linearIds = allIds.first(std::min<std::size_t>(allIds.size(), 1000));
+    auto const [linearMs, linearMisses] = measure(linearIds, linearLookup);
+
+    // Cleanup, objects are owned by the container
+    container.purgeObjects();
+    for (auto const* object : container.deletionProcess.trash) {
+        delete object;
+    }
+    container.deletionProcess.trash.clear();
+
+    if (indexedMisses != 0 || linearMisses != 0) {
+        domain.capture.error.println("Lookup failed for ", indexedMisses, " indexed and ", linearMisses, " linear lookups");
+        return Constants::Event::error;
+    }
+    auto perLookupNs = [](double const ms, std::size_t const lookups) {
+        return lookups > 0 ? ms * 1e6 / static_cast<double>(lookups) : 0.0;
+    };
+    domain.capture.log.println("Objects: ", objectCount);
+    domain.capture.log.println("Indexed: ", indexedMs, " ms for ", allIds.size(), " lookups (", perLookupNs(indexedMs, allIds.size()), " ns each)");
+    domain.capture.log.println("Linear:  ", linearMs, " ms for ", linearIds.size(), " lookups (", perLookupNs(linearMs, linearIds.size()), " ns each)");
+    return Constants::Event::success;
+}
+
+Constants::Event FeatureTest::componentPoolBenchmark(std::span<std::string_view const> const& args) const {
+    if (args.size() < 3) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
+    if (args.size() > 3) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(domain.capture);
+    }
+    std::size_t objectCount = 0;
+    std::size_t iterations = 0;
+    try {
+        objectCount = std::stoull(std::string(args[1]));
+        iterations = std::stoull(std::string(args[2]));
+    } catch (std::exception const&) {
+        domain.capture.warning.println("Invalid object count or iteration count: ", args[1], " ", args[2]);
+        return Constants::Event::warning;
+    }
+
+    using Component = Data::ComponentPool::Component;
+    auto const& posXKey = Data::ComponentPool::keys()[static_cast<std::size_t>(Component::posX)];
+    auto const& vXKey = Data::ComponentPool::keys()[static_cast<std::size_t>(Component::physics_vX)];
+    double constexpr dt = 1.0 / 60.0;
+
+    // Two identical sets of documents, one of them bound to a standalone pool
+    Data::ComponentPool pool;
+    std::vector<std::unique_ptr<Data::JsonScope>> cached;
+    std::vector<std::unique_ptr<Data::JsonScope>> pooled;
+    std::vector<std::pair<double*, double*>> cachedRefs;
+    cached.reserve(objectCount);
+    pooled.reserve(objectCount);
+    cachedRefs.reserve(objectCount);
+    for (std::size_t i = 0; i < objectCount; i++) {
+        auto const velocity = static_cast<double>(i % 100);
+        auto& cachedScope = *cached.emplace_back(std::make_unique<Data::JsonScope>());
+        auto& pooledScope = *pooled.emplace_back(std::make_unique<Data::JsonScope>());
+        pool.bind(pooledScope, pool.acquire());
+        for (auto* scope : {&cachedScope, &pooledScope}) {
+            scope->set(posXKey, 0.0);
+            scope->set(vXKey, velocity);
+        }
+        cachedRefs.emplace_back(cachedScope.getStableDoublePointer(posXKey), cachedScope.getStableDoublePointer(vXKey));
+    }
+
+    auto measure = [iterations](auto const& step) {
+        auto const start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; i++) {
+            step();
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+    double const cachedMs = measure([&cachedRefs] {
+        for (auto const& [posX, vX] : cachedRefs) {
+            *posX += *vX * dt;
+        }
+    });
+    double const pooledMs = measure([&pool] {
+        pool.forEachBlock([](Data::ComponentPool::Block& block, std::size_t const count) {
+            auto const posX = block.column(Component::posX);
+            auto const vX = block.column(Component::physics_vX);
+            for (std::size_t i = 0; i < count; i++) {
+                posX[i] += vX[i] * dt;
+            }
+        });
+    });
+
+    // Values written through the pool must be visible through the documents
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < objectCount; i++) {
+        if (cached[i]->get<double>(posXKey).value_or(0.0) != pooled[i]->get<double>(posXKey).value_or(0.0)) {
+            mismatches++;
+        }
+    }
+    if (mismatches != 0) {
+        domain.capture.error.println("Pooled values differ from cached values for ", mismatches, " objects");
+        return Constants::Event::error;
+    }
+    domain.capture.log.println("Objects: ", objectCount, ", iterations: ", iterations);
+    domain.capture.log.println("Cached: ", cachedMs, " ms");
+    domain.capture.log.println("Pooled: ", pooledMs, " ms");
+    domain.capture.log.println("Speedup: ", pooledMs > 0.0 ? cachedMs / pooledMs : 0.0, "x");
+    return Constants::Event::success;
+}
+
+Constants::Event FeatureTest::rulesetSpawnBenchmark(std::span<std::string_view const> const& args) const {
+    if (args.size() < 3) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
+    if (args.size() > 3) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(domain.capture);
+    }
+    std::size_t objectCount = 0;
+    try {
+        objectCount = std::stoull(std::string(args[1]));
+    } catch (std::exception const&) {
+        domain.capture.warning.println("Invalid object count: ", args[1]);
+        return Constants::Event::warning;
+    }
+
+    // The ruleset array of each spawned object, holding a single linked ruleset
+    Data::JsonScope rulesetArray;
+    rulesetArray.deserialize("[\"" + std::string(args[2]) + "\"]");
+
+    // Standalone objects, not part of the renderer
+    std::vector<std::unique_ptr<Core::RenderObject>> objects;
+    objects.reserve(objectCount);
+    for (std::size_t i = 0; i < objectCount; i++) {
+        objects.push_back(std::make_unique<Core::RenderObject>(domain.capture));
+    }
+
+    using Interaction::Rules::Construction::RulesetCompiler;
+    auto measure = [&](bool const compileEach) {
+        RulesetCompiler::clearCompiledRulesets();
+        std::size_t parsed = 0;
+        auto const start = std::chrono::steady_clock::now();
+        for (auto const& object : objects) {
+            if (compileEach) {
+                RulesetCompiler::clearCompiledRulesets();
+            }
+            RulesetCompiler::RulesetVector global;
+            RulesetCompiler::RulesetVector local;
+            RulesetCompiler::parse(global, local, *object, rulesetArray);
+            parsed += global.size() + local.size();
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::pair{std::chrono::duration<double, std::milli>(end - start).count(), parsed};
+    };
+
+    // Reference: compiling all expressions of the ruleset for each object, as done before they were shared
+    auto const [compiledMs, compiledCount] = measure(true);
+    auto const [sharedMs, sharedCount] = measure(false);
+    if (compiledCount != objectCount || sharedCount != objectCount) {
+        domain.capture.error.println("Failed to parse ruleset ", args[2], " for ", objectCount - std::min(compiledCount, sharedCount), " objects");
+        return Constants::Event::error;
+    }
+    auto perSpawnUs = [objectCount](double const ms) {
+        return objectCount > 0 ? ms * 1e3 / static_cast<double>(objectCount) : 0.0;
+    };
+    domain.capture.log.println("Objects: ", objectCount, ", ruleset: ", args[2]);
+    domain.capture.log.println("Compiled per spawn: ", compiledMs, " ms (", perSpawnUs(compiledMs), " us each)");
+    domain.capture.log.println("Shared:             ", sharedMs, " ms (", perSpawnUs(sharedMs), " us each)");
+    domain.capture.log.println("Speedup: ", sharedMs > 0.0 ? compiledMs / sharedMs : 0.0, "x");
+    return Constants::Event::success;
+}
+
+// Audio
+
+namespace {
+/**
+ * @brief Mixes a single voice of an odd-length sound and compares its left channel to a plain linear interpolation.
+ * @details Covers the frames around the end of the sound, where the resampling must neither read past the
+ *          last frame nor skip it.
+ * @return The largest absolute difference to the reference, infinity if a sample is not finite.
+ */
+float resamplingError(std::size_t const channels, float const pitch, bool const loop) {
+    std::size_t constexpr length = 101;
+    std::size_t constexpr frames = 1000;
+    auto sound = std::make_shared<Audio::Sound>();
+    sound->channels = channels;
+    sound->samples.resize(length * channels);
+    for (std::size_t i = 0; i < sound->samples.size(); i++) {
+        sound->samples[i] = 0.5f * static_cast<float>(std::sin(0.1 * static_cast<double>(i / channels)));
+    }
+
+    Audio::Mixer mixer(1);
+    std::ignore = mixer.play(sound, {.pitch = pitch, .loop = loop});
+    std::vector<float> output(frames * Audio::Mixer::outputChannels);
+    mixer.mix(output);
+
+    // Stereo sources are panned as a balance, mono sources with equal power
+    float const gain = channels > 1 ? 1.0f : static_cast<float>(std::cos(std::numbers::pi / 4.0));
+    float error = 0.0f;
+    for (std::size_t i = 0; i < frames; i++) {
+        double position = static_cast<double>(i) * static_cast<double>(pitch);
+        float expected = 0.0f;
+        if (loop || position < static_cast<double>(length)) {
+            position = std::fmod(position, static_cast<double>(length));
+            auto const index = static_cast<std::size_t>(position);
+            auto const next = index + 1 < length ? index + 1 : loop ? 0 : index;
+            auto const fraction = static_cast<float>(position - static_cast<double>(index));
+            float const current = sound->samples[index * channels];
+            expected = gain * (current + (sound->samples[next * channels] - current) * fraction);
+        }
+        float const sample = output[i * Audio::Mixer::outputChannels];
+        if (!std::isfinite(sample)) {
+            return std::numeric_limits<float>::infinity();
+        }
+        error = std::max(error, std::abs(sample - expected));
+    }
+    return error;
+}
+} // namespace
+
+Constants::Event FeatureTest::audioMixer() const {
+    using Audio::Mixer;
+    auto result = Constants::Event::success;
+
+    // Resampling at the end of odd-length sounds
+    for (std::size_t const channels : {1, 2}) {
+        for (float const pitch : {0.5f, 2.0f}) {
+            for (bool const loop : {false, true}) {
+                float const error = resamplingError(channels, pitch, loop);
+                if (!(error <= 1e-5f)) {
+                    domain.capture.error.println("Resampling ", channels, " channels at pitch ", pitch, loop ? " looping" : "", " differs by ", error);
+                    result = Constants::Event::error;
+                }
+                domain.capture.log.println("Resampling ", channels > 1 ? "stereo" : "mono", " at pitch ", pitch, loop ? " looping" : "", ": ", error <= 1e-5f ? "matches" : "differs");
+            }
+        }
+    }
+
+    // Constant mono sounds, so sample values are known exactly
+    auto constantSound = [](std::size_t const frames, float const value) {
+        auto sound = std::make_shared<Audio::Sound>();
+        sound->samples.assign(frames, value);
+        return std::shared_ptr<Audio::Sound const>(std::move(sound));
+    };
+    auto const looping = constantSound(Mixer::blockFrames, 0.25f);
+    std::vector<float> output(Mixer::blockFrames * Mixer::outputChannels);
+
+    // Stealing the lowest priority and oldest voice, dropping voices of a lower priority
+    {
+        Mixer mixer(2);
+        auto const first = mixer.play(looping, {.loop = true});
+        auto const second = mixer.play(looping, {.loop = true});
+        auto const higher = mixer.play(looping, {.priority = 1, .loop = true});
+        auto const lower = mixer.play(looping, {.priority = -1, .loop = true});
+        auto const equal = mixer.play(looping, {.loop = true});
+        auto const isPlaying = [&mixer](std::optional<Audio::VoiceId> const& id) {
+            return id.has_value() && mixer.isPlaying(*id);
+        };
+        domain.capture.log.println("Playing: ", isPlaying(first), " ", isPlaying(second), " ", isPlaying(higher), " ", isPlaying(lower), " ", isPlaying(equal));
+        auto const stats = mixer.getStats();
+        domain.capture.log.println("Played: ", stats.played, ", stolen: ", stats.stolen, ", dropped: ", stats.dropped, ", active: ", stats.active);
+
+        // Stopped voices fade out over the next block, then free their slot
+        if (higher.has_value()) {
+            mixer.stop(*higher);
+        }
+        domain.capture.log.println("Stopped voice playing: ", isPlaying(higher), ", active: ", mixer.getStats().active);
+        mixer.mix(output);
+        domain.capture.log.println("Active after mixing: ", mixer.getStats().active);
+    }
+
+    // Sounds without looping end once drained
+    {
+        Mixer mixer(1);
+        auto const id = mixer.play(constantSound(Mixer::blockFrames / 2 + 1, 0.25f), {});
+        mixer.mix(output);
+        float const last = output[(Mixer::blockFrames / 2) * Mixer::outputChannels];
+        float const after = output[(Mixer::blockFrames / 2 + 1) * Mixer::outputChannels];
+        domain.capture.log.println("Ended sound playing: ", id.has_value() && mixer.isPlaying(*id), ", last frame audible: ", last != 0.0f, ", silent after: ", after == 0.0f);
+    }
+
+    // Panning a mono voice hard left with a gain pushing it beyond full scale
+    {
+        Mixer mixer(1);
+        std::ignore = mixer.play(looping, {.gain = 8.0f, .pan = -1.0f, .loop = true});
+        mixer.mix(output);
+        float left = 0.0f;
+        float right = 0.0f;
+        for (std::size_t i = 0; i < Mixer::blockFrames; i++) {
+            left = std::max(left, std::abs(output[i * Mixer::outputChannels]));
+            right = std::max(right, std::abs(output[i * Mixer::outputChannels + 1]));
+        }
+        domain.capture.log.println("Hard left, clamped: left ", left, ", right ", right);
+    }
+    return result;
+}
+
+Constants::Event FeatureTest::audioMixerBenchmark(std::span<std::string_view const> const& args) const {
+    if (args.size() < 3) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
+    if (args.size() > 3) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(domain.capture);
+    }
+    std::size_t voices = 0;
+    std::size_t seconds = 0;
+    try {
+        voices = std::stoull(std::string(args[1]));
+        seconds = std::stoull(std::string(args[2]));
+    } catch (std::exception const&) {
+        domain.capture.warning.println("Invalid voice count or duration: ", args[1], " ", args[2]);
+        return Constants::Event::warning;
+    }
+
+    std::size_t constexpr sampleRate = 44100;
+    std::size_t constexpr deviceFrames = 1024; // A typical device buffer
+    using Audio::Mixer;
+
+    // One second and one frame of a distinct sine per voice, looping.
+    // The odd length keeps voices at pitch 0.5 and 2 landing on the last frame
+    Mixer mixer(voices);
+    std::vector<std::shared_ptr<Audio::Sound const>> sounds;
+    for (std::size_t v = 0; v < voices; v++) {
+        auto sound = std::make_shared<Audio::Sound>();
+        sound->channels = 1 + v % 2;
+        sound->samples.resize((sampleRate + 1) * sound->channels);
+        double const omega = 2.0 * std::numbers::pi * static_cast<double>(110 + v * 7) / static_cast<double>(sampleRate);
+        for (std::size_t i = 0; i < sound->samples.size(); i++) {
+            sound->samples[i] = static_cast<float>(std::sin(omega * static_cast<double>(i / sound->channels)));
+        }
+        Audio::VoiceParams const params{
+            .gain = 1.0f / static_cast<float>(voices),
+            .pan = static_cast<float>(v % 9) / 4.0f - 1.0f,
+            .pitch = v % 3 == 0 ? 1.0f : 0.5f + static_cast<float>(v % 64) / 32.0f,
+            .loop = true
+        };
+        if (!mixer.play(sound, params).has_value()) {
+            domain.capture.error.println("Failed to start voice ", v);
+            return Constants::Event::error;
+        }
+        sounds.push_back(std::move(sound));
+    }
+
+    std::vector<float> output(deviceFrames * Mixer::outputChannels);
+    auto const blocks = seconds * sampleRate / deviceFrames;
+    std::size_t invalid = 0;
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t b = 0; b < blocks; b++) {
+        mixer.mix(output);
+        invalid += static_cast<std::size_t>(std::ranges::count_if(output, [](float const sample) { return !(std::abs(sample) <= 1.0f); }));
+    }
+    auto const end = std::chrono::steady_clock::now();
+    double const mixMs = std::chrono::duration<double, std::milli>(end - start).count();
+    if (invalid != 0) {
+        domain.capture.error.println("Mixed ", invalid, " samples outside of [-1, 1]");
+        return Constants::Event::error;
+    }
+
+    // All voices are busy: higher priorities steal, lower ones are dropped
+    for (std::size_t v = 0; v < voices; v++) {
+        std::ignore = mixer.play(sounds[v], {.priority = 1});
+        std::ignore = mixer.play(sounds[v], {.priority = -1});
+    }
+    auto const stats = mixer.getStats();
+    if (stats.stolen != voices || stats.dropped != voices || stats.active != voices) {
+        domain.capture.error.println("Unexpected voice stealing, stolen: ", stats.stolen, ", dropped: ", stats.dropped, ", active: ", stats.active);
+        return Constants::Event::error;
+    }
+
+    double const audioMs = static_cast<double>(blocks * deviceFrames) * 1000.0 / static_cast<double>(sampleRate);
+    domain.capture.log.println("Voices: ", voices, ", mixed: ", audioMs, " ms of audio in blocks of ", deviceFrames, " frames");
+    domain.capture.log.println("Mixing: ", mixMs, " ms, ", blocks > 0 ? mixMs * 1000.0 / static_cast<double>(blocks) : 0.0, " us per block");
+    domain.capture.log.println("Realtime factor: ", mixMs > 0.0 ? audioMs / mixMs : 0.0, "x");
+    return Constants::Event::success;
+}
+
 // Keys
 
 Constants::Event FeatureTest::keyCombination(std::span<std::string_view const> const& args) const {
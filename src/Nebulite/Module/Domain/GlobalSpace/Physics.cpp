@@ -5,12 +5,17 @@
 #include "Nebulite/Constants/Event.hpp"
 #include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/Physics.hpp"
+#include "Nebulite/Module/Ruleset/Physics.hpp"
 
 //------------------------------------------
 namespace Nebulite::Module::Domain::GlobalSpace {
 
 Constants::Event Physics::updateHook() {
-    // No dynamic updates needed for constants
+    // Objects enlisted in approximated gravity during the last frame.
+    // Runs before any rulesets of this frame are processed, so forces can be written without locking.
+    double const G = moduleScope.get<double>(Key::Global::G).value_or(0.0);
+    double const theta = moduleScope.get<double>(Key::Global::barnesHutTheta).value_or(0.5);
+    Module::Ruleset::Physics::solveGravityApproximation(G, theta);
     return Constants::Event::success;
 }
 
@@ -39,6 +44,9 @@ void Physics::setupConstants() const {
 
     // Earth-related (useful approximations)
     moduleScope.set(Key::Global::g, 9.80665);
+
+    // Simulation settings
+    moduleScope.set(Key::Global::barnesHutTheta, 0.5);
 }
 
 } // namespace Nebulite::Module::Domain::GlobalSpace
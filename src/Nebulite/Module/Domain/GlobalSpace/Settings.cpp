@@ -15,6 +15,7 @@
 #include "Nebulite/Module/Domain/GlobalSpace/InputMapping.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/Settings.hpp"
 #include "Nebulite/Nebulite.hpp"
+#include "Nebulite/Utility/Io/Capture.hpp"
 #include "Nebulite/Utility/Io/FileManagement.hpp"
 
 //------------------------------------------
@@ -122,6 +123,21 @@ Constants::Event Settings::loadSettings(std::string const& filename) const {
     moduleScope.set<uint16_t>(Key::fontSize2, settingsFile.get<uint16_t>(Key::fontSize2).value_or(60));
     moduleScope.set<uint16_t>(Key::fontSize3, settingsFile.get<uint16_t>(Key::fontSize3).value_or(80));
 
+    // Simulation level of detail
+    // nearMargin:      additional tiles around the visible ones that are updated every frame
+    // distantInterval: update all other tiles every n-th frame, 0 keeps them frozen
+    // distantRadius:   maximum distance of updated tiles to the camera tile, 0 for unlimited
+    moduleScope.set<uint16_t>(Key::simulationNearMargin, settingsFile.get<uint16_t>(Key::simulationNearMargin).value_or(0));
+    moduleScope.set<uint16_t>(Key::simulationDistantInterval, settingsFile.get<uint16_t>(Key::simulationDistantInterval).value_or(0));
+    moduleScope.set<uint16_t>(Key::simulationDistantRadius, settingsFile.get<uint16_t>(Key::simulationDistantRadius).value_or(0));
+
+    // Component pool: store position, size and physics values of new RenderObjects in contiguous arrays
+    moduleScope.set<bool>(Key::componentPool, settingsFile.get<bool>(Key::componentPool).value_or(false));
+
+    // Logging: write console output and history from a background thread, limit history per capture (0 for unlimited)
+    moduleScope.set<bool>(Key::logAsync, settingsFile.get<bool>(Key::logAsync).value_or(false));
+    moduleScope.set<uint32_t>(Key::logHistoryLimit, settingsFile.get<uint32_t>(Key::logHistoryLimit).value_or(static_cast<uint32_t>(Utility::Io::Capture::defaultHistoryLimit)));
+
     // Commands: On startup
     moduleScope.setSubDoc(Key::parseOnStartup, settingsFile.getSubDoc(Key::parseOnStartup));
     if (moduleScope.memberType(Key::parseOnStartup) != Data::KeyType::array) { // Load default if not present
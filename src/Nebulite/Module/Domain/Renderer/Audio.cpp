@@ -2,30 +2,41 @@
 // Includes
 
 // Standard Library
+#include <algorithm>
 #include <array>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
 #include <numbers>
+#include <optional>
 #include <ranges>
 #include <span>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 // External
 #include <SDL3/SDL_audio.h>
 #include <SDL3/SDL_error.h>
+#include <SDL3/SDL_hints.h>
 #include <SDL3/SDL_init.h>
 #include <SDL3/SDL_stdinc.h>
 #include <absl/container/flat_hash_map.h>
 
 // Nebulite
+#include "Nebulite/Audio/Mixer.hpp"
+#include "Nebulite/Audio/WavStream.hpp"
 #include "Nebulite/Constants/Event.hpp"
 #include "Nebulite/Constants/StandardCapture.hpp"
 #include "Nebulite/Core/Renderer.hpp"
 #include "Nebulite/Math/ExpressionPrimitives.hpp"
 #include "Nebulite/Module/Base/DomainModule.hpp"
 #include "Nebulite/Module/Domain/Renderer/Audio.hpp"
+#include "Nebulite/Utility/Convert/Cast.hpp"
 #include "Nebulite/Utility/Generate.hpp"
 #include "Nebulite/Utility/Io/Capture.hpp"
 #include "Nebulite/Utility/StringHandler.hpp"
@@ -34,71 +45,106 @@
 namespace Nebulite::Module::Domain::Renderer {
 
 Constants::Event Audio::updateHook() {
+    // Top up streamed music, and forget tracks whose voice ended
+    for (auto const& track : music) {
+        track.decoder->pump();
+    }
+    std::erase_if(music, [this](Music const& track) { return !mixer.isPlaying(track.voice); });
     return Constants::Event::success;
 }
 
 //------------------------------------------
 // Available Functions
 
-Constants::Event Audio::beep(std::span<std::string_view const> const& args) const {
+Constants::Event Audio::beep(std::span<std::string_view const> const& args) {
+    // Waveforms are concatenated into one sound, so they play one after another
+    auto sound = std::make_shared<Nebulite::Audio::Sound>();
+    auto const append = [&sound](auto const& buffer) {
+        sound->samples.insert(sound->samples.end(), buffer.begin(), buffer.end());
+    };
+
+    auto result = Constants::Event::success;
     if (args.size() < 2) {
         domain.capture.log.println("No waveform type specified. Defaulting to sine.");
-        SDL_PutAudioStreamData(
-            stream,
-            basicAudioWaveforms.sineBuffer.data(),
-            static_cast<int>(basicAudioWaveforms.sineBuffer.size() * sizeof(std::int16_t))
-        );
-        return Constants::Event::success;
+        append(basicAudioWaveforms.sineBuffer);
     }
-
     for (auto const& arg : args | std::views::drop(1)) {
         if (arg == "sine") {
-            SDL_PutAudioStreamData(
-                stream,
-                basicAudioWaveforms.sineBuffer.data(),
-                static_cast<int>(basicAudioWaveforms.sineBuffer.size() * sizeof(std::int16_t))
-            );
+            append(basicAudioWaveforms.sineBuffer);
         } else if (arg == "triangle") {
-            SDL_PutAudioStreamData(
-                stream,
-                basicAudioWaveforms.triangleBuffer.data(),
-                static_cast<int>(basicAudioWaveforms.triangleBuffer.size() * sizeof(std::int16_t))
-            );
+            append(basicAudioWaveforms.triangleBuffer);
         } else if (arg == "square") {
-            SDL_PutAudioStreamData(
-                stream,
-                basicAudioWaveforms.squareBuffer.data(),
-                static_cast<int>(basicAudioWaveforms.squareBuffer.size() * sizeof(std::int16_t))
-            );
+            append(basicAudioWaveforms.squareBuffer);
         } else {
             domain.capture.warning.println("Unknown waveform type: ", arg);
-            return Constants::Event::warning;
+            result = Constants::Event::warning;
+            break;
         }
     }
-    return Constants::Event::success;
+
+    if (!sound->samples.empty()) {
+        std::ignore = mixer.play(std::move(sound), {});
+    }
+    return result;
 }
 
 Constants::Event Audio::playSound(std::span<std::string_view const> const& args) {
-    if (args.size() < 2) {
+    auto const options = parseVoiceParams(args, {});
+    if (!options.has_value()) {
+        return Constants::Event::warning;
+    }
+    auto const& [params, pathIndex] = options.value();
+    if (pathIndex >= args.size()) {
         return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
     }
 
-    auto const path = Utility::StringHandler::recombineArgs(args | std::views::drop(1));
+    auto const path = Utility::StringHandler::recombineArgs(args.subspan(pathIndex));
     auto const sound = loadSound(path);
     if (!sound.has_value()) {
         domain.capture.error.println("Failed to load sound from path: ", path);
         return Constants::StandardCapture::Error::File::invalidFile(domain.capture);
     }
 
-    // TODO: using SDL_PutAudioStreamData does not allow for multiple streams. We should switch to SDL_Mixer later on?
-    //       for now we just play the latest sound
-    SDL_ClearAudioStream(stream);
-    SDL_PutAudioStreamData(
-        stream,
-        sound.value()->audioData.data(),
-        static_cast<int>(sound.value()->audioData.size() * sizeof(Settings::SampleType))
-    );
+    if (!mixer.play(sound.value(), params).has_value()) {
+        domain.capture.log.println("All voices are playing sounds of a higher priority, dropped: ", path);
+    }
+    return Constants::Event::success;
+}
+
+Constants::Event Audio::playMusic(std::span<std::string_view const> const& args) {
+    auto const options = parseVoiceParams(args, {.priority = Settings::musicPriority});
+    if (!options.has_value()) {
+        return Constants::Event::warning;
+    }
+    auto const& [params, pathIndex] = options.value();
+    if (pathIndex >= args.size()) {
+        return Constants::StandardCapture::Warning::Functional::tooFewArgs(domain.capture);
+    }
 
+    auto const path = Utility::StringHandler::recombineArgs(args.subspan(pathIndex));
+    auto decoder = Nebulite::Audio::WavStream::open(path, spec.freq, Settings::musicBufferFrames, params.loop);
+    if (decoder == nullptr) {
+        domain.capture.error.println("Failed to open music from path: ", path, ": ", SDL_GetError());
+        return Constants::StandardCapture::Error::File::invalidFile(domain.capture);
+    }
+
+    // Fill the buffer before playing, so the track does not start with an underrun
+    decoder->pump();
+    auto const voice = mixer.play(decoder->getStream(), params);
+    if (!voice.has_value()) {
+        domain.capture.log.println("All voices are playing sounds of a higher priority, dropped: ", path);
+        return Constants::Event::success;
+    }
+    music.push_back({std::move(decoder), voice.value()});
+    return Constants::Event::success;
+}
+
+Constants::Event Audio::stopSounds(std::span<std::string_view const> const& args) {
+    if (args.size() > 1) {
+        return Constants::StandardCapture::Warning::Functional::tooManyArgs(domain.capture);
+    }
+    mixer.stopAll();
+    music.clear();
     return Constants::Event::success;
 }
 
@@ -108,29 +154,103 @@ Constants::Event Audio::playSound(std::span<std::string_view const> const& args)
 Audio::Audio(ConstructorParams const& params) : DomainModule(params) {
     bindFunction(&Audio::beep, beepName, beepDesc);
     bindFunction(&Audio::playSound, playSoundName, playSoundDesc);
+    bindFunction(&Audio::playMusic, playMusicName, playMusicDesc);
+    bindFunction(&Audio::stopSounds, stopSoundsName, stopSoundsDesc);
 
-    initAudio();
     initWaveforms();
+    initAudio();
+}
+
+Audio::~Audio() {
+    // Stops the device callback before the mixer is destroyed
+    SDL_DestroyAudioStream(stream);
 }
 
 //------------------------------------------
 // Private functions
 
-void Audio::initAudio(){
-    if (!SDL_Init(SDL_INIT_AUDIO)) {
-        domain.capture.error.println("SDL_Init Audio Error: ", SDL_GetError());
-        std::abort();
+namespace {
+template <typename T>
+bool parseInto(T& target, std::string_view const value) {
+    auto const parsed = Utility::Convert::Cast::String::to<T>(value);
+    if (parsed.has_value()) {
+        target = parsed.value();
     }
-    spec.freq = 44100;
+    return parsed.has_value();
+}
+} // namespace
+
+std::optional<std::pair<Nebulite::Audio::VoiceParams, std::size_t>> Audio::parseVoiceParams(std::span<std::string_view const> const& args, Nebulite::Audio::VoiceParams params) const {
+    std::size_t i = 1;
+    for (; i < args.size() && args[i].starts_with("--"); i++) {
+        auto const option = args[i];
+        if (option == "--loop") {
+            params.loop = true;
+            continue;
+        }
+        if (option != "--gain" && option != "--pan" && option != "--pitch" && option != "--priority") {
+            domain.capture.warning.println("Unknown option: ", option);
+            return std::nullopt;
+        }
+        if (i + 1 >= args.size()) {
+            domain.capture.warning.println("Missing value for option: ", option);
+            return std::nullopt;
+        }
+        auto const value = args[++i];
+        bool const valid = option == "--gain" ? parseInto(params.gain, value)
+                         : option == "--pan" ? parseInto(params.pan, value)
+                         : option == "--pitch" ? parseInto(params.pitch, value) && params.pitch > 0.0f
+                         : parseInto(params.priority, value);
+        if (!valid) {
+            domain.capture.warning.println("Invalid value for option ", option, ": ", value);
+            return std::nullopt;
+        }
+    }
+    return std::make_pair(params, i);
+}
+
+void Audio::initAudio(){
+    spec.freq = static_cast<int>(Settings::sampleRate);
     spec.format = SDL_AUDIO_F32;
-    spec.channels = 1; // TODO: Set default to stereo, convert all mono sounds to stereo. How are multiple channels handled in the audio stream?
+    spec.channels = static_cast<int>(Nebulite::Audio::Mixer::outputChannels);
+    mixBuffer.resize(Nebulite::Audio::Mixer::blockFrames * Nebulite::Audio::Mixer::outputChannels * 16);
 
-    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, nullptr, nullptr);
-    if (!stream) {
-        domain.capture.error.println("Failed to open audio device: ", SDL_GetError());
+    if (openDevice()) {
+        return;
+    }
+    domain.capture.warning.println("Failed to open audio device: ", SDL_GetError(), ". Falling back to the dummy audio driver.");
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    if (!openDevice()) {
+        domain.capture.error.println("Failed to open dummy audio device: ", SDL_GetError());
         std::abort();
     }
+}
+
+bool Audio::openDevice() {
+    if (!SDL_Init(SDL_INIT_AUDIO)) {
+        return false;
+    }
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, fillDevice, this);
+    if (stream == nullptr) {
+        return false;
+    }
     SDL_ResumeAudioStreamDevice(stream);
+    return true;
+}
+
+void SDLCALL Audio::fillDevice(void* userdata, SDL_AudioStream* deviceStream, int const additionalAmount, int /*totalAmount*/) {
+    auto* self = static_cast<Audio*>(userdata);
+    auto const samples = static_cast<std::size_t>(std::max(additionalAmount, 0)) / sizeof(float);
+    if (samples == 0) {
+        return;
+    }
+    if (self->mixBuffer.size() < samples) {
+        self->mixBuffer.resize(samples);
+    }
+    auto const output = std::span(self->mixBuffer).first(samples);
+    self->mixer.mix(output);
+    SDL_PutAudioStreamData(deviceStream, output.data(), static_cast<int>(output.size_bytes()));
 }
 
 void Audio::initWaveforms() {
@@ -155,7 +275,7 @@ void Audio::initWaveforms() {
     );
 }
 
-std::optional<std::shared_ptr<Audio::Sound>> Audio::loadSound(std::string const& path){
+std::optional<std::shared_ptr<Nebulite::Audio::Sound const>> Audio::loadSound(std::string const& path){
     if (auto const it = soundCache.find(path); it != soundCache.end()) {
         return it->second;
     }
@@ -163,100 +283,31 @@ std::optional<std::shared_ptr<Audio::Sound>> Audio::loadSound(std::string const&
     Settings::SdlAudioByte* data = nullptr;
     std::uint32_t length = 0;
     SDL_AudioSpec wavSpec = {};
-    SDL_LoadWAV(path.c_str(), &wavSpec, &data, &length);
-    if (!data || length == 0) {
+    if (!SDL_LoadWAV(path.c_str(), &wavSpec, &data, &length) || data == nullptr || length == 0) {
         domain.capture.error.println("SDL_LoadWAV Error: ", SDL_GetError());
-        return std::nullopt;
-    }
-
-    // Check if sound is the correct format
-    if (wavSpec.channels != spec.channels || wavSpec.freq != spec.freq) {
-        domain.capture.error.println("Sound format does not match audio stream format. Sound: ", path);
-        // TODO: Implement channel and sample rate conversion
-        //       Probably best to do this after the conversion to float
-        return std::nullopt;
-    }
-
-    // Push sound data into cache
-    Sound sound;
-    auto converterAndSampleSize = loadConverterFunction(wavSpec.format);
-    if (!converterAndSampleSize) {
-        domain.capture.error.println("Unsupported audio format: ", sdlAudioFormatToString(wavSpec.format), " for sound: ", path, ". Feel free to submit a PR to add support for this format in function: ", __FUNCTION__);
         SDL_free(data);
-    }
-    auto& [convertFunc, lengthPerSample] = converterAndSampleSize.value();
-    auto const sampleCount = length / lengthPerSample;
-    sound.audioData.reserve(sampleCount);
-    for (std::size_t i = 0; i < sampleCount; ++i) {
-        sound.audioData.push_back(convertFunc(data + i * lengthPerSample));
+        return std::nullopt;
     }
 
-    auto const soundPtr = std::make_shared<Sound>(sound);
-    soundCache.emplace(path, soundPtr);
+    // Convert to float at the output rate once, so the mixer only resamples for pitch
+    SDL_AudioSpec const targetSpec{SDL_AUDIO_F32, std::min(wavSpec.channels, 2), spec.freq};
+    Settings::SdlAudioByte* converted = nullptr;
+    int convertedLength = 0;
+    bool const success = SDL_ConvertAudioSamples(&wavSpec, data, static_cast<int>(length), &targetSpec, &converted, &convertedLength);
     SDL_free(data);
-    auto const it = soundCache.find(path);
-    if (it == soundCache.end()) {
-        domain.capture.error.println("Failed to cache sound after loading: ", path);
+    if (!success) {
+        domain.capture.error.println("Failed to convert sound: ", path, ": ", SDL_GetError());
         return std::nullopt;
     }
-    return it->second;
-}
 
-std::string Audio::sdlAudioFormatToString(SDL_AudioFormat const format) {
-    switch (format) {
-    case SDL_AUDIO_U8: return "Unsigned 8-bit";
-    case SDL_AUDIO_S8: return "Signed 8-bit";
-    case SDL_AUDIO_F32: return "Floating point 32 bit";
-    case SDL_AUDIO_S16: return "Signed 16-bit";
-    case SDL_AUDIO_S16BE: return "Signed 16-bit big-endian";
-    case SDL_AUDIO_S32: return "Signed 32-bit";
-    case SDL_AUDIO_S32BE: return "Signed 32-bit big-endian";
-    case SDL_AUDIO_F32BE: return "Floating point 32-bit big-endian";
-    case SDL_AUDIO_UNKNOWN: return "Unknown";
-    default: std::unreachable();
-    }
-}
+    auto sound = std::make_shared<Nebulite::Audio::Sound>();
+    sound->channels = static_cast<std::size_t>(targetSpec.channels);
+    sound->samples.resize(static_cast<std::size_t>(convertedLength) / sizeof(float));
+    std::memcpy(sound->samples.data(), converted, sound->samples.size() * sizeof(float));
+    SDL_free(converted);
 
-std::optional<Audio::ConverterAndSampleSize> Audio::loadConverterFunction(SDL_AudioFormat const format) {
-    switch (format) {
-    case SDL_AUDIO_F32:
-        return std::make_pair(
-            [](Settings::SdlAudioByte const* byteData) {
-                std::array<float,4> buffer{};
-                std::memcpy(buffer.data(), byteData, sizeof(float));
-                return *buffer.data();
-            },
-            sizeof(float)
-        );
-    case SDL_AUDIO_S16:
-        return std::make_pair(
-            [](Settings::SdlAudioByte const* byteData) {
-                std::array<int16_t,4> buffer{};
-                std::memcpy(buffer.data(), byteData, sizeof(std::int16_t));
-                return static_cast<Settings::SampleType>(*buffer.data()) / static_cast<Settings::SampleType>(std::numeric_limits<int16_t>::max());
-            },
-            sizeof(std::int16_t)
-        );
-    case SDL_AUDIO_U8:
-        return std::make_pair(
-            [](Settings::SdlAudioByte const* byteData) {
-                std::array<uint8_t,4> buffer{};
-                std::memcpy(buffer.data(), byteData, sizeof(std::uint8_t));
-                Settings::SampleType const valueShifted = static_cast<Settings::SampleType>(*buffer.data()) - static_cast<Settings::SampleType>(128);
-                return valueShifted / (static_cast<Settings::SampleType>(std::numeric_limits<uint8_t>::max()) / static_cast<Settings::SampleType>(2));
-            },
-            sizeof(std::uint8_t)
-        );
-    case SDL_AUDIO_S8:
-    case SDL_AUDIO_S16BE:
-    case SDL_AUDIO_S32:
-    case SDL_AUDIO_S32BE:
-    case SDL_AUDIO_F32BE:
-    case SDL_AUDIO_UNKNOWN:
-        return std::nullopt;
-    default:
-        std::unreachable();
-    }
+    soundCache.emplace(path, sound);
+    return sound;
 }
 
 } // namespace Nebulite::Module::Domain::Renderer
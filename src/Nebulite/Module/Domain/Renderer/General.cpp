@@ -80,8 +80,7 @@ Constants::Event General::spawn(std::span<std::string_view const> const& args) c
         std::string const linkOrObject = Utility::StringHandler::recombineArgs(args.subspan(1));
 
         // Create object with link to globalspace
-        auto* ro = new Core::RenderObject(domain.capture);
-        ro->deserialize(linkOrObject);
+        auto* ro = new Core::RenderObject(domain.capture, linkOrObject);
 
         // Append to renderer.
         // Renderer manages the RenderObjects lifetime
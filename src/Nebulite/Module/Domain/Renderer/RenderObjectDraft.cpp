@@ -33,8 +33,7 @@ Constants::Event RenderObjectDraft::draftSpawn() {
     // Make a copy of the draft's serialized data
     // Create a new RenderObject on the heap and append it to the renderer
     std::string const serial = draft.get(domain.capture).serialize();
-    auto* newObj = new Core::RenderObject(domain.capture);
-    newObj->deserialize(serial);
+    auto* newObj = new Core::RenderObject(domain.capture, serial);
     domain.append(newObj);
     return Constants::Event::success;
 }
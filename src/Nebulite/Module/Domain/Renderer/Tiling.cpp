@@ -49,6 +49,11 @@ namespace Nebulite::Module::Domain::Renderer {
                     moduleScope.set<int>(keyX, tile.x);
                     moduleScope.set<int>(keyY, tile.y);
                 }
+
+                auto const& simulationInfo = domain.getSimulationInfo();
+                moduleScope.set<std::size_t>(Key::simulationNearTiles, simulationInfo.nearTiles);
+                moduleScope.set<std::size_t>(Key::simulationDistantTiles, simulationInfo.distantTiles);
+                moduleScope.set<std::size_t>(Key::simulationDistantTilesUpdated, simulationInfo.distantTilesUpdated);
             },
             2000,
             Utility::Coordination::TimedRoutine::ConstructionMode::startImmediately
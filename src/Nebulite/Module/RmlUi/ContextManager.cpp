@@ -20,36 +20,54 @@ namespace Nebulite::Module::RmlUi {
 ContextManager::ContextManager(Utility::Io::Capture& c, Graphics::RmlInterface& i) : RmlUiModule(c,i) {}
 
 void ContextManager::update() {
-    auto anySupportedAttribute = [] (Rml::Element* element, Rml::Element* parent) {
-        // Skip elements that are part of a reflection, as they will be handled by the Reflection module
-        // In fact, skip any elements that are a child/grandchild/... of a reflection
-        auto* escalatedParent = parent;
-        while (escalatedParent) {
-            if (Reflection::Attribute::hasSupportedAttribute(escalatedParent)) {
-                return false;
-            }
-            escalatedParent = escalatedParent->GetParentNode();
+    // Elements are only checked once after their creation, instead of walking every opened document
+    for (auto it = pending.begin(); it != pending.end();) {
+        if (assignContext(*it)) {
+            pending.erase(it++);
         }
+        else {
+            ++it;
+        }
+    }
+}
+
+void ContextManager::OnElementCreate(Rml::Element* element) {
+    if (element) {
+        pending.insert(element);
+    }
+}
+
+void ContextManager::OnElementDestroy(Rml::Element* element) {
+    pending.erase(element);
+}
+
+bool ContextManager::assignContext(Rml::Element* element) const {
+    // Skip elements that are part of a reflection, as they will be handled by the Reflection module
+    // In fact, skip any elements that are a child/grandchild/... of a reflection
+    for (auto* escalatedParent = element->GetParentNode(); escalatedParent; escalatedParent = escalatedParent->GetParentNode()) {
+        if (Reflection::Attribute::hasSupportedAttribute(escalatedParent)) {
+            return true;
+        }
+    }
 
-        // Check for supported attributes
-        return ExpressionManager::Attribute::hasSupportedAttribute(element) // Any expression requires context
-            || EventBridge::Attribute::hasSupportedAttribute(element)  // Any interactive event requires context
-            || Conditional::Attribute::hasSupportedAttribute(element)  // Conditionals use Expressions -> requires context
-            // ^ Add any new attributes here ^
-        ;
-    };
-
-    for (auto const& document : interface.getOpenedDocuments()) {
-        Graphics::RmlInterface::updateElement(document, [&](Rml::Element* element, Rml::Element* parent) {
-            if (anySupportedAttribute(element, parent)) {
-                if (Graphics::RmlInterface::RmlElementIdentifier const elementId(element); !interface.getRmlElementContextAndScope(elementId).has_value()) {
-                    if (auto const ctx = interface.getRmlDocumentContextAndScope(document); ctx.has_value()) {
-                        interface.setRmlElementContextAndScope(elementId, ctx.value());
-                    }
-                }
-            }
-        });
+    // Check for supported attributes
+    bool const anySupportedAttribute = ExpressionManager::Attribute::hasSupportedAttribute(element) // Any expression requires context
+        || EventBridge::Attribute::hasSupportedAttribute(element)  // Any interactive event requires context
+        || Conditional::Attribute::hasSupportedAttribute(element)  // Conditionals use Expressions -> requires context
+        // ^ Add any new attributes here ^
+    ;
+    if (!anySupportedAttribute) {
+        return true;
+    }
+
+    if (Graphics::RmlInterface::RmlElementIdentifier const elementId(element); !interface.getRmlElementContextAndScope(elementId).has_value()) {
+        auto const ctx = interface.getRmlDocumentContextAndScope(element->GetOwnerDocument());
+        if (!ctx.has_value()) {
+            return false;
+        }
+        interface.setRmlElementContextAndScope(elementId, ctx.value());
     }
+    return true;
 }
 
 } // namespace Nebulite::Module::RmlUi
@@ -7,6 +7,7 @@
 #include <ranges>
 #include <string>
 #include <utility>
+#include <vector>
 
 // External
 #include <RmlUi/Core/Context.h>
@@ -106,25 +107,24 @@ void DataReference::registerDataValue(Rml::Element* element) {
 }
 
 void DataReference::updateDataValues() {
-    for (auto const& document : interface.getOpenedDocuments()) {
-        Graphics::RmlInterface::updateElement(document, [&](Rml::Element* element, Rml::Element* /*parent*/) {
-            if (Graphics::RmlInterface::RmlElementIdentifier::hasElementIdentifier(element)) {
-                Graphics::RmlInterface::RmlElementIdentifier const id(element);
-                updateRegisteredValues(id, element);
-            }
-        });
+    // Only registered elements are visited, instead of walking every opened document.
+    // Synchronizing may create or destroy elements, which modifies the registered entries.
+    auto const ids = std::ranges::to<std::vector>(registeredEntries | std::views::keys);
+    for (auto const& id : ids) {
+        updateRegisteredValues(id);
     }
 }
 
-void DataReference::updateRegisteredValues(Graphics::RmlInterface::RmlElementIdentifier const& id, Rml::Element* element){
-    if (!element) return;
-
-    auto const idContext = interface.getRmlElementContextAndScope(id);
-    auto const docContext = interface.getRmlDocumentContextAndScope(element->GetOwnerDocument());
-    if (!idContext && !docContext) return;
-
+void DataReference::updateRegisteredValues(Graphics::RmlInterface::RmlElementIdentifier const& id){
     // Update all registered entries
     if (auto const it = registeredEntries.find(id); it != registeredEntries.end()){
+        auto* const element = it->second->element;
+        if (!element) return;
+
+        auto const idContext = interface.getRmlElementContextAndScope(id);
+        auto const docContext = interface.getRmlDocumentContextAndScope(element->GetOwnerDocument());
+        if (!idContext && !docContext) return;
+
         // Check if a dummy scope is registered
         auto const& ctxScope = idContext ? idContext.value().ctxScope : docContext.value().ctxScope;
         if (ctxScope.hasDummyScope()) {
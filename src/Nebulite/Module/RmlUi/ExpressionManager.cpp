@@ -2,74 +2,224 @@
 // Includes
 
 // Standard library
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <ranges>
 #include <string>
+#include <utility>
+#include <vector>
 
 // External
 #include <RmlUi/Config/Config.h>
 #include <RmlUi/Core/Element.h>
 
 // Nebulite
+#include "Nebulite/Data/Document/JsonScope.hpp"
 #include "Nebulite/Graphics/RmlInterface.hpp"
+#include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Interaction/Logic/Expression.hpp"
 #include "Nebulite/Module/Base/RmlUiModule.hpp"
 #include "Nebulite/Module/RmlUi/ExpressionManager.hpp"
-#include "Nebulite/Utility/Coordination/TimedRoutine.hpp"
 #include "Nebulite/Utility/Io/Capture.hpp"
 
 //------------------------------------------
 namespace Nebulite::Module::RmlUi {
 
+namespace {
+// Characters that could end an attribute, be read as markup, or be evaluated by a bound parent
+// when the source is serialized with its parent
+bool needsEncoding(char const c) {
+    return c == '%' || c == '"' || c == '\'' || c == '<' || c == '>' || c == '&' || c == '{' || c == '}' || c == '$';
+}
+
+int hexValue(char const c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+} // namespace
+
 ExpressionManager::ExpressionManager(Utility::Io::Capture& c, Graphics::RmlInterface& i) : RmlUiModule(c,i) {}
 
 void ExpressionManager::update() {
-    evaluationRoutine.update();
+    stats = {};
+    auto elements = std::ranges::to<std::vector>(bindings | std::views::keys);
+    for (std::size_t round = 0; round < maximumRounds; ++round) {
+        auto bound = bindPendingElements();
+        elements.insert(elements.end(), bound.begin(), bound.end());
+        if (elements.empty()) {
+            break;
+        }
+
+        // Refreshing replaces inner rml, which may destroy bound elements and create new ones
+        for (auto* const element : std::exchange(elements, {})) {
+            if (auto const it = bindings.find(element); it != bindings.end()) {
+                refresh(element, it->second);
+            }
+        }
+    }
+}
+
+void ExpressionManager::addUpdateStats(Graphics::RmlInterface::UpdateStats& updateStats) const {
+    updateStats.bindings += bindings.size();
+    updateStats.evaluated += stats.evaluated;
+    updateStats.changed += stats.changed;
 }
 
-void ExpressionManager::postRenderUpdate() {
-    if (expressionsWereEvaluated) {
-        resetExpressions();
-        expressionsWereEvaluated = false;
+void ExpressionManager::OnElementCreate(Rml::Element* element) {
+    // On element creation, the inner rml is not set. So we bind it on the next update.
+    if (element && Attribute::hasSupportedAttribute(element)) {
+        pending.insert(element);
     }
 }
 
+void ExpressionManager::OnElementDestroy(Rml::Element* element) {
+    pending.erase(element);
+    bindings.erase(element);
+}
+
 //----------------------------------------------
 
-void ExpressionManager::updateExpressions(){
-    for (auto const& document : interface.getOpenedDocuments()) {
-        Graphics::RmlInterface::updateElement(document, [&](Rml::Element* element, Rml::Element* /*parent*/) {
-            if (Attribute::hasSupportedAttribute(element)) {
-                // On element creation, the inner rml is not set. So we create an empty ElementEntry that is populated later on.
-                Rml::String innerRml = element->GetInnerRML();
-                rmlStrings[element] = innerRml;
-                if (auto const it = expressions.find(innerRml); it == expressions.end()) {
-                    expressions.emplace(innerRml, Interaction::Logic::Expression(innerRml));
-                }
-
-                Graphics::RmlInterface::RmlElementIdentifier const elementId(element);
-                if (auto const context = interface.getRmlElementContextAndScope(elementId); context.has_value()) {
-                    if (context.value().ctxScope.hasDummyScope()) {
-                        capture.warning.println("Failed to evaluate expression, a context member has a dummy scope!");
-                        return;
-                    }
-                    if (auto const it = expressions.find(innerRml); it != expressions.end()) {
-                        std::string const& evaluated = it->second.eval(context.value().ctxScope);
-                        element->SetInnerRML(evaluated);
-                    }
-                }
-            }
-        });
+std::vector<Rml::Element*> ExpressionManager::bindPendingElements() {
+    std::vector<Rml::Element*> bound;
+    for (auto* const element : pending) {
+        // Elements recreated by their parent keep the source rml of the original element
+        Rml::String source;
+        Rml::String current;
+        if (auto const* encoded = element->GetAttribute(Attribute::source); encoded) {
+            source = decodeSource(encoded->Get<Rml::String>());
+            current = element->GetInnerRML();
+        }
+        else {
+            source = element->GetInnerRML();
+            current = source;
+            element->SetAttribute(Attribute::source, encodeSource(source));
+        }
+
+        auto& compiled = expressions[source];
+        if (!compiled) {
+            compiled = std::make_unique<CompiledExpression>(source);
+        }
+
+        Binding binding{.compiled = compiled.get(), .output = std::move(current)};
+        if (compiled->dependencies.has_value()) {
+            auto const numeric = static_cast<std::size_t>(std::ranges::count_if(compiled->dependencies.value(), &Interaction::Logic::Expression::Dependency::numeric));
+            binding.numericValues.resize(numeric);
+            binding.variableValues.resize(compiled->dependencies->size() - numeric);
+        }
+        bindings.insert_or_assign(element, std::move(binding));
+        bound.push_back(element);
+    }
+    pending.clear();
+    return bound;
+}
+
+void ExpressionManager::refresh(Rml::Element* element, Binding& binding) {
+    Graphics::RmlInterface::RmlElementIdentifier const elementId(element);
+    auto const context = interface.getRmlElementContextAndScope(elementId);
+    if (!context.has_value()) {
+        return;
+    }
+    auto const& scope = context.value().ctxScope;
+    if (scope.hasDummyScope()) {
+        capture.warning.println("Failed to evaluate expression, a context member has a dummy scope!");
+        return;
+    }
+    if (!dependenciesChanged(binding, scope)) {
+        return;
+    }
+
+    binding.evaluated = true;
+    stats.evaluated++;
+    if (std::string evaluated = binding.compiled->expression.eval(scope); evaluated != binding.output) {
+        // Replacing the inner rml forces a new layout, so only do so on actual changes
+        binding.output = std::move(evaluated);
+        stats.changed++;
+        element->SetInnerRML(binding.output);
     }
 }
 
-void ExpressionManager::resetExpressions(){
-    for (auto const& document : interface.getOpenedDocuments()) {
-        Graphics::RmlInterface::updateElement(document, [&](Rml::Element* element, Rml::Element* /*parent*/) {
-            if (Attribute::hasSupportedAttribute(element)) {
-                // Reset
-                element->SetInnerRML(rmlStrings[element]);
+bool ExpressionManager::dependenciesChanged(Binding& binding, Interaction::ContextScope const& scope) {
+    auto const& dependencies = binding.compiled->dependencies;
+    if (!dependencies.has_value()) {
+        return true;
+    }
+
+    std::array<Data::JsonScope const*, 3> const scopes{&scope.self, &scope.other, &scope.global};
+    bool changed = !binding.evaluated || std::exchange(binding.scopes, scopes) != scopes;
+
+    // Numeric values are read through their stable double pointers, the same cache the evaluation reads from
+    if (changed) {
+        binding.numericPointers.clear();
+        for (auto const& dependency : dependencies.value() | std::views::filter(&Interaction::Logic::Expression::Dependency::numeric)) {
+            auto const target = scope.getTargetFromType(dependency.context);
+            binding.numericPointers.push_back(target.has_value() ? target.value().get().getStableDoublePointer(dependency.key) : nullptr);
+        }
+    }
+
+    std::size_t numeric = 0;
+    std::size_t variable = 0;
+    for (auto const& dependency : dependencies.value()) {
+        if (dependency.numeric) {
+            auto const* pointer = binding.numericPointers[numeric];
+            auto& last = binding.numericValues[numeric++];
+            if (pointer == nullptr) {
+                changed = true;
             }
-        });
+            else {
+                changed |= std::exchange(last, *pointer) != *pointer;
+            }
+            continue;
+        }
+
+        auto const target = scope.getTargetFromType(dependency.context);
+        if (!target.has_value()) {
+            changed = true;
+            variable++;
+            continue;
+        }
+        // Errors are kept by kind, as the evaluation renders each kind differently, e.g. null or [array]
+        auto value = target.value().get().get<std::string>(dependency.key);
+        changed |= value != binding.variableValues[variable];
+        binding.variableValues[variable++] = std::move(value);
+    }
+    return changed;
+}
+
+std::string ExpressionManager::encodeSource(std::string const& rml) {
+    static auto constexpr digits = "0123456789ABCDEF";
+    std::string encoded;
+    encoded.reserve(rml.size());
+    for (char const c : rml) {
+        if (needsEncoding(c)) {
+            auto const byte = static_cast<unsigned char>(c);
+            encoded += '%';
+            encoded += digits[byte >> 4];
+            encoded += digits[byte & 0xF];
+        }
+        else {
+            encoded += c;
+        }
+    }
+    return encoded;
+}
+
+std::string ExpressionManager::decodeSource(std::string const& encoded) {
+    std::string rml;
+    rml.reserve(encoded.size());
+    for (std::size_t i = 0; i < encoded.size(); ++i) {
+        if (encoded[i] == '%' && i + 2 < encoded.size() && hexValue(encoded[i + 1]) >= 0 && hexValue(encoded[i + 2]) >= 0) {
+            rml += static_cast<char>(hexValue(encoded[i + 1]) << 4 | hexValue(encoded[i + 2]));
+            i += 2;
+        }
+        else {
+            rml += encoded[i];
+        }
     }
+    return rml;
 }
 
 } // namespace Nebulite::Module::RmlUi
@@ -2,8 +2,10 @@
 // Includes
 
 // Standard Library
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <stdexcept>
 
 // Nebulite
@@ -11,12 +13,14 @@
 #include "Nebulite/Interaction/Context.hpp"
 #include "Nebulite/Interaction/Rules/Ruleset.hpp"
 #include "Nebulite/Interaction/Rules/StaticRulesetMap.hpp"
+#include "Nebulite/Math/BarnesHut.hpp"
 #include "Nebulite/Math/Equality.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/Physics.hpp"
 #include "Nebulite/Module/Domain/GlobalSpace/Time.hpp"
 #include "Nebulite/Module/Ruleset/Physics.hpp"
 #include "Nebulite/Nebulite.hpp"
 #include "Nebulite/ScopeAccessor.hpp"
+#include "Nebulite/Utility/Coordination/TaskScheduler.hpp"
 
 //------------------------------------------
 namespace Nebulite::Module::Ruleset {
@@ -25,7 +29,7 @@ Physics::Physics() : RulesetModule(moduleName, this) {
     auto const baseListFunc = generateBaseListFunction(baseKeys);
 
     // Global rulesets
-    bind<elasticCollisionName>(&Physics::elasticCollision, baseListFunc, Interaction::Rules::StaticRuleset::Type::global, elasticCollisionDesc);
+    bind<elasticCollisionName>(&Physics::elasticCollision, baseListFunc, Interaction::Rules::StaticRuleset::Type::global, elasticCollisionDesc, 0.0); // Only overlapping boxes collide
     bind<gravityName>(&Physics::gravity, baseListFunc, Interaction::Rules::StaticRuleset::Type::global, gravityDesc);
 
     // Local rulesets
@@ -33,6 +37,7 @@ Physics::Physics() : RulesetModule(moduleName, this) {
     bind<applyForceName>(&Physics::applyForce, baseListFunc, Interaction::Rules::StaticRuleset::Type::local, applyForceDesc);
     bind<applyCorrectionName>(&Physics::applyCorrection, baseListFunc, Interaction::Rules::StaticRuleset::Type::local, applyCorrectionDesc);
     bind<dragName>(&Physics::drag, baseListFunc, Interaction::Rules::StaticRuleset::Type::local, dragDesc);
+    bind<gravityApproximateName>(&Physics::gravityApproximate, baseListFunc, Interaction::Rules::StaticRuleset::Type::local, gravityApproximateDesc);
 
     // Global Variables
     auto const token = getRulesetModuleAccessToken(*this);
@@ -232,4 +237,71 @@ void Physics::drag(Interaction::Context const& context, double** slf, double** /
     baseVal(slf, Key::physics_FY) += dragForceY;
 }
 
+// NOLINTNEXTLINE
+void Physics::gravityApproximate(Interaction::Context const& /*context*/, double** slf, double** /*otr*/) const {
+    // Forces are applied in bulk by solveGravityApproximation
+    gravityEngine().enlist(slf);
+}
+
+//------------------------------------------
+// Frame-wise solvers
+
+void Physics::solveGravityApproximation(double const G, double const theta) {
+    gravityEngine().solve(G, theta);
+}
+
+Physics::GravityEngine& Physics::gravityEngine() {
+    static GravityEngine engine;
+    return engine;
+}
+
+void Physics::GravityEngine::enlist(double** slf) {
+    std::size_t const threadIndex = Data::JsonScope::assignCacheLookupIndex();
+    if (threadIndex >= enlisted.size()) {
+        throw std::runtime_error("Thread index exceeds gravity engine list size!");
+    }
+    enlisted[threadIndex].push_back(slf);
+}
+
+void Physics::GravityEngine::solve(double const G, double const theta) {
+    // Same softening as ::physics::gravity
+    static double constexpr softening = 1.0;
+
+    participants.clear();
+    for (auto& list : enlisted) {
+        participants.insert(participants.end(), list.begin(), list.end());
+        list.clear();
+    }
+    if (participants.empty()) {
+        return;
+    }
+
+    bodies.clear();
+    for (double** slf : participants) {
+        bodies.push_back(Math::BarnesHut::Body{
+            .x = baseVal(slf, Key::posX),
+            .y = baseVal(slf, Key::posY),
+            .mass = baseVal(slf, Key::physics_mass),
+        });
+    }
+    tree.build(bodies);
+
+    // Each object only writes its own forces, so the evaluation can be split freely
+    auto const apply = [this, G, theta](std::size_t const begin, std::size_t const end) {
+        for (std::size_t idx = begin; idx < end; idx++) {
+            auto const& body = bodies[idx];
+            auto const [fieldX, fieldY] = tree.field(body.x, body.y, theta, softening);
+            double const coeff = G * body.mass;
+            baseVal(participants[idx], Key::physics_FX) += fieldX * coeff;
+            baseVal(participants[idx], Key::physics_FY) += fieldY * coeff;
+        }
+    };
+
+    // Rulesets are not processed during the solve, so the shared scheduler is idle
+    std::size_t const chunkCount = (participants.size() + objectsPerJob - 1) / objectsPerJob;
+    Utility::Coordination::TaskScheduler::instance().parallelFor(chunkCount, [&](std::size_t const chunk) {
+        apply(chunk * objectsPerJob, std::min(participants.size(), (chunk + 1) * objectsPerJob));
+    });
+}
+
 } // namespace Nebulite::Module::Ruleset
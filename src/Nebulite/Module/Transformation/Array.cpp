@@ -8,6 +8,7 @@
 #include <ranges>
 #include <span>
 #include <string>
+#include <vector>
 
 // Nebulite
 #include "Nebulite/Data/Document/JsonScope.hpp"
@@ -135,15 +136,8 @@ bool Array::reverse(Data::JsonScope& jsonDoc) {
     if (!ensureArray(jsonDoc)) {
         return false;
     }
-    auto const arraySize = jsonDoc.memberSize(rootKey);
-    Data::Json const tmp = jsonDoc.getSubDoc(rootKey);
-    for (std::size_t i = 0; i < arraySize; ++i) {
-        auto const key = rootKey.addIndex(i);
-        auto const elementKey = rootKey.addIndex(arraySize - 1 - i).toString();
-        Data::Json const element = tmp.getSubDoc(elementKey);
-        jsonDoc.setSubDoc(key, element);
-    }
-    return true;
+    auto const order = std::views::iota(std::size_t{0}, jsonDoc.memberSize(rootKey)) | std::views::reverse | std::ranges::to<std::vector>();
+    return jsonDoc.permuteArray(rootKey, order);
 }
 
 // Clang marks this function as having an unreachable branch,
@@ -218,14 +212,9 @@ bool Array::iota(std::span<std::string_view const> const& args, Data::JsonScope&
         jsonDoc.setEmptyArray(rootKey);
         return true;
     }
-    std::ranges::for_each(
-        std::views::iota(start, end),
-        [&](auto const& i) {
-            auto index = i - start;
-            auto const key = rootKey.addIndex(static_cast<size_t>(index));
-            jsonDoc.set(key, i);
-        }
-    );
+    // Written in a single pass, large ranges would otherwise create a cache entry per element
+    auto const values = std::views::iota(static_cast<std::int64_t>(start), static_cast<std::int64_t>(end)) | std::ranges::to<std::vector>();
+    jsonDoc.setNumericArray(rootKey, std::span<std::int64_t const>(values));
     return true;
 }
 
@@ -24,22 +24,16 @@
 namespace Nebulite::Module::Transformation {
 
 void Fft::bindTransformations() {
-    bindTransformation(&Fft::applyFft, applyFftName, applyFftDesc);
-    bindTransformation(&Fft::applyIfft, applyIfftName, applyIfftDesc);
+    bindPureTransformation(&Fft::applyFft, applyFftName, applyFftDesc);
+    bindPureTransformation(&Fft::applyIfft, applyIfftName, applyIfftDesc);
+    bindPureTransformation(&Fft::applyRfft, applyRfftName, applyRfftDesc);
+    bindPureTransformation(&Fft::applyDft, applyDftName, applyDftDesc);
+    bindPureTransformation(&Fft::applyIdft, applyIdftName, applyIdftDesc);
     bindTransformation(&Fft::applyTransferFunctionFrequencyDomain, applyTransferFunctionName, applyTransferFunctionDesc);
 }
 
 bool Fft::applyFft(Data::JsonScope& jsonDoc) {
-    auto const samples = jsonDoc.arrayKeys(rootKey)
-        | std::views::transform([&jsonDoc](auto const& key) -> std::optional<double> {
-            auto value = jsonDoc.get<double>(key);
-            if (!value) {
-                return std::nullopt;
-            }
-            return value.value();
-        })
-        | Utility::Ranges::collectOptional;
-
+    auto const samples = jsonDoc.getNumericArray(rootKey);
     if (!samples) {
         return false;
     }
@@ -52,16 +46,7 @@ bool Fft::applyFft(Data::JsonScope& jsonDoc) {
 }
 
 bool Fft::applyIfft(Data::JsonScope& jsonDoc) {
-    auto const samples = jsonDoc.arrayKeys(rootKey)
-        | std::views::transform([&jsonDoc](auto const& key) -> std::optional<std::complex<double>> {
-            // Try to retrieve value as real value first (simplest to handle), if not, try to retrieve as complex value
-            if (auto value = jsonDoc.get<double>(key); value) {
-                return std::complex<double>(value.value(), 0.0);
-            }
-            return jsonDoc.getComplex(key); // Potentially nullopt
-        })
-        | Utility::Ranges::collectOptional;
-
+    auto const samples = complexSamples(jsonDoc);
     if (!samples) {
         return false;
     }
@@ -70,16 +55,38 @@ bool Fft::applyIfft(Data::JsonScope& jsonDoc) {
     return true;
 }
 
+bool Fft::applyRfft(Data::JsonScope& jsonDoc) {
+    auto const samples = jsonDoc.getNumericArray(rootKey);
+    if (!samples) {
+        return false;
+    }
+    auto const result = Math::Fft::transformReal(samples.value());
+    jsonDoc.setArray(rootKey, result);
+    return true;
+}
+
+bool Fft::applyDft(Data::JsonScope& jsonDoc) {
+    auto samples = complexSamples(jsonDoc);
+    if (!samples) {
+        return false;
+    }
+    Math::Fft::transform(samples.value());
+    jsonDoc.setArray(rootKey, samples.value());
+    return true;
+}
+
+bool Fft::applyIdft(Data::JsonScope& jsonDoc) {
+    auto samples = complexSamples(jsonDoc);
+    if (!samples) {
+        return false;
+    }
+    Math::Fft::transformInverse(samples.value());
+    jsonDoc.setArray(rootKey, samples.value());
+    return true;
+}
+
 bool Fft::applyTransferFunctionFrequencyDomain(std::span<std::string_view const> const& args, Data::JsonScope& jsonDoc) {
-    auto const samples = jsonDoc.arrayKeys(rootKey)
-        | std::views::transform([&jsonDoc](auto const& key) -> std::optional<double> {
-            // Try to retrieve value as real value first (simplest to handle), if not, try to retrieve as complex value
-            if (auto value = jsonDoc.get<double>(key); value) {
-                return value.value();
-            }
-            return std::nullopt;
-        })
-        | Utility::Ranges::collectOptional;
+    auto const samples = jsonDoc.getNumericArray(rootKey);
 
     if (!samples) {
         return false;
@@ -122,4 +129,20 @@ bool Fft::applyTransferFunctionFrequencyDomain(std::span<std::string_view const>
     return true;
 }
 
+std::optional<std::vector<std::complex<double>>> Fft::complexSamples(Data::JsonScope& jsonDoc) {
+    // Real samples are read in a single pass
+    if (auto const real = jsonDoc.getNumericArray(rootKey); real) {
+        return std::vector<std::complex<double>>(real.value().begin(), real.value().end());
+    }
+    return jsonDoc.arrayKeys(rootKey)
+        | std::views::transform([&jsonDoc](auto const& key) -> std::optional<std::complex<double>> {
+            // Try to retrieve value as real value first (simplest to handle), if not, try to retrieve as complex value
+            if (auto value = jsonDoc.get<double>(key); value) {
+                return std::complex<double>(value.value(), 0.0);
+            }
+            return jsonDoc.getComplex(key); // Potentially nullopt
+        })
+        | Utility::Ranges::collectOptional;
+}
+
 } // namespace Nebulite::Module::Transformation
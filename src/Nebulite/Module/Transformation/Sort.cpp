@@ -2,8 +2,13 @@
 // Includes
 
 // Standard library
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
 #include <span>
 #include <string>
+#include <vector>
 
 // Nebulite
 #include "Nebulite/Data/Document/JsonScope.hpp"
@@ -20,9 +25,9 @@ namespace Nebulite::Module::Transformation {
 
 void Sort::bindTransformations(){
     bindCategory(sortName, sortDesc);
-    bindTransformation(&Sort::sortCaseSensitive,sortCaseSensitiveName, sortCaseSensitiveDesc);
-    bindTransformation(&Sort::sortCaseInsensitive, sortCaseInsensitiveName, sortCaseInsensitiveDesc);
-    bindTransformation(&Sort::sortNumerically, sortNumericallyName, sortNumericallyDesc);
+    bindPureTransformation(&Sort::sortCaseSensitive,sortCaseSensitiveName, sortCaseSensitiveDesc);
+    bindPureTransformation(&Sort::sortCaseInsensitive, sortCaseInsensitiveName, sortCaseInsensitiveDesc);
+    bindPureTransformation(&Sort::sortNumerically, sortNumericallyName, sortNumericallyDesc);
     bindTransformation(&Sort::sortCustom, sortCustomName, sortCustomDesc);
 }
 
@@ -44,6 +49,16 @@ bool Sort::sortCaseInsensitive(Data::JsonScope& jsonDoc){
 
 bool Sort::sortNumerically(Data::JsonScope& jsonDoc){
     if (jsonDoc.memberType(rootKey) != Data::KeyType::array) return false; // Not an array, cannot sort
+
+    // All elements numeric: sort indices by a single bulk read, then move the elements into place
+    if (auto const values = jsonDoc.getNumericArray(rootKey); values) {
+        std::vector<std::size_t> order(values->size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::ranges::stable_sort(order, std::less{}, [&values](std::size_t const i) { return (*values)[i]; });
+        return jsonDoc.permuteArray(rootKey, order);
+    }
+
+    // Non-numeric elements are sorted as 0
     arraySort<double>(jsonDoc,0, [](auto const& a, auto const& b) {
         return a.first < b.first;
     });
@@ -5,13 +5,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <functional>
-#include <limits>
+#include <optional>
 #include <vector>
 
 // Nebulite
 #include "Nebulite/Data/Document/JsonScope.hpp"
-#include "Nebulite/Data/Document/KeyType.hpp"
+#include "Nebulite/Math/Reduction.hpp"
 #include "Nebulite/Module/Transformation/Statistics.hpp"
 
 //------------------------------------------
@@ -27,133 +26,87 @@ void Statistics::bindTransformations() {
     bindTransformation(&stddev, stddevName, stddevDesc);
 }
 
-double Statistics::accumulate(Data::JsonScope const& jsonDoc, std::function<double(double, double)> const& func, double const initialValue) {
-    if (jsonDoc.memberType(rootKey) != Data::KeyType::array) {
-        return std::numeric_limits<double>::quiet_NaN();
+std::optional<std::vector<double>> Statistics::numericValues(Data::JsonScope const& jsonDoc) {
+    auto values = jsonDoc.getNumericArray(rootKey);
+    if (!values || Math::Reduction::containsNan(values.value())) {
+        return std::nullopt;
     }
-
-    double result = initialValue;
-    std::size_t const size = jsonDoc.memberSize(rootKey);
-
-    if (size == 0) {
-        return result;
-    }
-
-    for (auto itemKey : rootKey.getArrayKeys(size)) {
-        double const value = jsonDoc.get<double>(itemKey).value_or(std::numeric_limits<double>::quiet_NaN());
-        if (std::isnan(value)) {
-            return std::numeric_limits<double>::quiet_NaN();
-        }
-        result = func(result, value);
-    }
-    return result;
+    return values;
 }
 
-
 bool Statistics::sum(Data::JsonScope& jsonDoc) {
-    double const result = accumulate(jsonDoc, [](double const a, double const b) { return a + b; });
-    if (std::isnan(result)) {
-            return false;
+    auto const values = numericValues(jsonDoc);
+    if (!values) {
+        return false;
     }
-    jsonDoc.set(rootKey, result);
+    jsonDoc.set(rootKey, Math::Reduction::sum(values.value()));
     return true;
 }
 
 bool Statistics::average(Data::JsonScope& jsonDoc){
-    double const result = accumulate(jsonDoc, [](double const a, double const b) { return a + b; });
-    if (std::isnan(result)) {
-            return false;
+    auto const values = numericValues(jsonDoc);
+    if (!values) {
+        return false;
     }
-    jsonDoc.set(rootKey, result / static_cast<double>(jsonDoc.memberSize(rootKey)));
+    jsonDoc.set(rootKey, Math::Reduction::sum(values.value()) / static_cast<double>(values->size()));
     return true;
 }
 
 bool Statistics::product(Data::JsonScope& jsonDoc) {
-    double const result = accumulate(jsonDoc, [](double const a, double const b) { return a * b; }, 1.0);
-    if (std::isnan(result)) {
+    auto const values = numericValues(jsonDoc);
+    if (!values) {
         return false;
     }
-    jsonDoc.set(rootKey, result);
+    jsonDoc.set(rootKey, Math::Reduction::product(values.value()));
     return true;
 }
 
 bool Statistics::min(Data::JsonScope& jsonDoc) {
-    double const result = accumulate(jsonDoc, [](double const a, double const b) { return std::min(a, b); }, std::numeric_limits<double>::infinity());
-    if (std::isnan(result)) {
+    auto const values = numericValues(jsonDoc);
+    if (!values) {
         return false;
     }
-    jsonDoc.set(rootKey, result);
+    jsonDoc.set(rootKey, Math::Reduction::min(values.value()));
     return true;
 }
 
 bool Statistics::max(Data::JsonScope& jsonDoc) {
-    double const result = accumulate(jsonDoc, [](double const a, double const b) { return std::max(a, b); }, -std::numeric_limits<double>::infinity());
-    if (std::isnan(result)) {
+    auto const values = numericValues(jsonDoc);
+    if (!values) {
         return false;
     }
-    jsonDoc.set(rootKey, result);
+    jsonDoc.set(rootKey, Math::Reduction::max(values.value()));
     return true;
 }
 
 bool Statistics::median(Data::JsonScope& jsonDoc) {
-    if (jsonDoc.memberType(rootKey) != Data::KeyType::array) {
+    auto values = numericValues(jsonDoc);
+    if (!values || values->empty()) {
         return false;
     }
 
-    std::size_t const size = jsonDoc.memberSize(rootKey);
-    if (size == 0) {
-        return false;
-    }
-
-    std::vector<double> values;
-    values.reserve(size);
-    for (auto const key : rootKey.getArrayKeys(size)) {
-        double const value = jsonDoc.get<double>(key).value_or(std::numeric_limits<double>::quiet_NaN());
-        if (std::isnan(value)) {
-            return false;
-        }
-        values.push_back(value);
-    }
-
-    std::ranges::sort(values.begin(), values.end());
-    double medianValue = 0.0;
+    // Partial selection instead of a full sort
+    std::size_t const size = values->size();
+    auto const upper = values->begin() + static_cast<std::ptrdiff_t>(size / 2);
+    std::ranges::nth_element(values.value(), upper);
+    double medianValue = *upper;
     if (size % 2 == 0) {
-        medianValue = (values[size / 2 - 1] + values[size / 2]) / 2.0;
-    } else {
-        medianValue = values[size / 2];
+        // The lower middle is the largest value before the upper one
+        medianValue = (*std::ranges::max_element(values->begin(), upper) + medianValue) / 2.0;
     }
     jsonDoc.set(rootKey, medianValue);
     return true;
 }
 
 bool Statistics::stddev(Data::JsonScope& jsonDoc) {
-    if (jsonDoc.memberType(rootKey) != Data::KeyType::array) {
+    auto const values = numericValues(jsonDoc);
+    if (!values || values->empty()) {
         return false;
     }
 
-    std::size_t const size = jsonDoc.memberSize(rootKey);
-    if (size == 0) {
-        return false;
-    }
-
-    std::vector<double> values;
-    values.reserve(size);
-    double sum = 0.0;
-    for (auto const key : rootKey.getArrayKeys(size)) {
-        double const value = jsonDoc.get<double>(key).value_or(std::numeric_limits<double>::quiet_NaN());
-        if (std::isnan(value)) {
-            return false;
-        }
-        values.push_back(value);
-        sum += value;
-    }
-
-    double const mean = sum / static_cast<double>(size);
-    double varianceSum = 0.0;
-    for (double const& value : values) {
-        varianceSum += (value - mean) * (value - mean);
-    }
-    double const stddevValue = std::sqrt(varianceSum / static_cast<double>(size));
+    auto const size = static_cast<double>(values->size());
+    double const mean = Math::Reduction::sum(values.value()) / size;
+    double const stddevValue = std::sqrt(Math::Reduction::squaredDeviations(values.value(), mean) / size);
     jsonDoc.set(rootKey, stddevValue);
     return true;
 }
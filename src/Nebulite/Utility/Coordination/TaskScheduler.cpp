@@ -0,0 +1,162 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Nebulite
+#include "Nebulite/Constants/ThreadSettings.hpp"
+#include "Nebulite/Utility/Coordination/TaskScheduler.hpp"
+
+//------------------------------------------
+namespace Nebulite::Utility::Coordination {
+
+namespace {
+// Queue owned by the current thread, unset for threads that are not workers
+thread_local std::size_t workerQueueIndex = std::numeric_limits<std::size_t>::max();
+} // namespace
+
+TaskScheduler& TaskScheduler::instance() {
+    static TaskScheduler instance;
+    return instance;
+}
+
+TaskScheduler::TaskScheduler() {
+    // Global rulesets and object updates never run at the same time, so both share the larger thread budget
+    std::size_t const workerCount = std::max(
+        Constants::ThreadSettings::getInvokeWorkerCount(),
+        Constants::ThreadSettings::getRendererWorkerCount()
+    );
+
+    // One queue per worker, plus one for all other threads
+    for (std::size_t i = 0; i <= workerCount; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; i++) {
+        workers.emplace_back([this, i] {
+            workerLoop(i);
+        });
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    stopFlag = true;
+    submissions.fetch_add(1);
+    submissions.notify_all();
+    workers.clear(); // jthread joins
+}
+
+void TaskScheduler::run(std::size_t const count, JobFunction const function, void const* context) {
+    if (count == 0) {
+        return;
+    }
+
+    // Not worth waking anyone up
+    if (count == 1 || workers.empty()) {
+        for (std::size_t idx = 0; idx < count; idx++) {
+            function(context, idx);
+        }
+        return;
+    }
+
+    Batch batch{.remaining = count};
+
+    // Deal jobs round-robin, starting with the own queue, so that every worker starts with local work.
+    // Lower indices end up at the back, so owners process jobs in order while thieves take the last ones.
+    std::size_t const own = ownQueueIndex();
+    for (std::size_t offset = 0; offset < queues.size() && offset < count; offset++) {
+        std::size_t const queueIndex = (own + offset) % queues.size();
+        std::size_t const jobCount = (count - offset + queues.size() - 1) / queues.size();
+        std::scoped_lock const lock(queues[queueIndex]->mutex);
+        for (std::size_t n = jobCount; n > 0; n--) {
+            std::size_t const idx = offset + (n - 1) * queues.size();
+            queues[queueIndex]->jobs.push_back(Job{.function = function, .context = context, .index = idx, .batch = &batch});
+        }
+    }
+    submissions.fetch_add(1);
+    submissions.notify_all();
+
+    // Help out until all jobs of this batch are done
+    while (true) {
+        if (Job job; pop(own, job) || steal(own, job)) {
+            execute(job);
+            continue;
+        }
+        // Remaining jobs are in progress on other threads
+        std::uint64_t const seen = completions.load();
+        if (batch.remaining.load() == 0) {
+            break;
+        }
+        completions.wait(seen);
+    }
+
+    if (batch.failed.load()) {
+        std::rethrow_exception(batch.exception);
+    }
+}
+
+bool TaskScheduler::pop(std::size_t const queueIndex, Job& job) {
+    auto& queue = *queues[queueIndex];
+    std::scoped_lock const lock(queue.mutex);
+    if (queue.jobs.empty()) {
+        return false;
+    }
+    job = queue.jobs.back();
+    queue.jobs.pop_back();
+    return true;
+}
+
+bool TaskScheduler::steal(std::size_t const queueIndex, Job& job) {
+    for (std::size_t offset = 1; offset < queues.size(); offset++) {
+        auto& queue = *queues[(queueIndex + offset) % queues.size()];
+        std::scoped_lock const lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = queue.jobs.front();
+            queue.jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::execute(Job const& job) {
+    try {
+        job.function(job.context, job.index);
+    } catch (...) {
+        if (!job.batch->failed.exchange(true)) {
+            job.batch->exception = std::current_exception();
+        }
+    }
+    // The batch may be destroyed by its submitter right after the last decrement,
+    // so completion is signaled through the scheduler instead
+    job.batch->remaining.fetch_sub(1);
+    completions.fetch_add(1);
+    completions.notify_all();
+}
+
+void TaskScheduler::workerLoop(std::size_t const queueIndex) {
+    workerQueueIndex = queueIndex;
+    while (!stopFlag.load()) {
+        std::uint64_t const seen = submissions.load();
+        if (Job job; pop(queueIndex, job) || steal(queueIndex, job)) {
+            execute(job);
+            continue;
+        }
+        submissions.wait(seen);
+    }
+}
+
+std::size_t TaskScheduler::ownQueueIndex() const {
+    return workerQueueIndex < workers.size() ? workerQueueIndex : workers.size();
+}
+
+} // namespace Nebulite::Utility::Coordination
@@ -0,0 +1,244 @@
+//------------------------------------------
+// Includes
+
+// Standard library
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Nebulite
+#include "Nebulite/Utility/Io/AsyncLog.hpp"
+#include "Nebulite/Utility/Io/Capture.hpp"
+
+//------------------------------------------
+namespace Nebulite::Utility::Io {
+
+namespace {
+/**
+ * @class Ring
+ * @brief Single-producer single-consumer ring of entries.
+ * @details The producer is the thread owning the ring, consumers are serialized by the drain mutex.
+ */
+class Ring {
+public:
+    bool tryPush(AsyncLog::Entry& entry) {
+        auto const h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == AsyncLog::ringCapacity) {
+            return false;
+        }
+        slots[h % AsyncLog::ringCapacity] = std::move(entry);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumes entries in order until the ring is empty or f returns false.
+     * @details An entry f rejects stays in the ring, together with all entries after it.
+     */
+    template<typename F>
+    void drain(F const& f) {
+        auto t = tail.load(std::memory_order_relaxed);
+        auto const h = head.load(std::memory_order_acquire);
+        for (; t != h; t++) {
+            auto& entry = slots[t % AsyncLog::ringCapacity];
+            if (!f(entry)) {
+                return;
+            }
+            entry.content.clear(); // Keep the buffer for the next entry in this slot
+            tail.store(t + 1, std::memory_order_release);
+        }
+    }
+
+    std::atomic<bool> inUse = false; // Whether a thread currently owns this ring
+
+private:
+    std::array<AsyncLog::Entry, AsyncLog::ringCapacity> slots;
+    alignas(64) std::atomic<std::size_t> head = 0; // Written by the producer
+    alignas(64) std::atomic<std::size_t> tail = 0; // Written by the consumer
+};
+
+/**
+ * @struct State
+ * @brief All rings and the drain thread.
+ */
+struct State {
+    std::vector<std::unique_ptr<Ring>> rings;
+    std::mutex ringsMutex; // Only taken to register a thread, or to list the rings
+
+    std::mutex drainMutex; // Serializes consumers
+
+    std::atomic<bool> enabled = false;
+    std::mutex controlMutex; // Serializes enable and disable
+    std::thread drainThread;
+    bool exitHandlerRegistered = false;
+
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool wakeRequested = false;
+    bool stopRequested = false;
+};
+
+State& state() {
+    // Never destroyed, captures may flush during static destruction
+    static auto* const instance = new State();
+    return *instance;
+}
+
+/**
+ * @struct ThreadRing
+ * @brief The ring of the current thread, released for reuse once the thread exits.
+ */
+struct ThreadRing {
+    Ring* ring = nullptr;
+
+    ~ThreadRing() {
+        if (ring != nullptr) {
+            ring->inUse.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadRing threadRing;
+
+Ring& localRing() {
+    if (threadRing.ring == nullptr) [[unlikely]] {
+        auto& s = state();
+        std::scoped_lock const lock(s.ringsMutex);
+        for (auto const& ring : s.rings) {
+            if (bool expected = false; ring->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                threadRing.ring = ring.get();
+                break;
+            }
+        }
+        if (threadRing.ring == nullptr) {
+            auto& ring = s.rings.emplace_back(std::make_unique<Ring>());
+            ring->inUse.store(true, std::memory_order_relaxed);
+            threadRing.ring = ring.get();
+        }
+    }
+    return *threadRing.ring;
+}
+
+void requestWake(State& s) {
+    {
+        std::scoped_lock const lock(s.wakeMutex);
+        s.wakeRequested = true;
+    }
+    s.wake.notify_one();
+}
+} // namespace
+
+//------------------------------------------
+// Public methods
+
+void AsyncLog::enable() {
+    auto& s = state();
+    std::scoped_lock const lock(s.controlMutex);
+    if (s.enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (!s.exitHandlerRegistered) {
+        // Pending output must be written before the process ends
+        std::atexit([] { disable(); });
+        s.exitHandlerRegistered = true;
+    }
+    s.stopRequested = false;
+    s.drainThread = std::thread([&s] {
+        while (true) {
+            {
+                std::unique_lock lock(s.wakeMutex);
+                s.wake.wait_for(lock, drainInterval, [&s] { return s.wakeRequested || s.stopRequested; });
+                s.wakeRequested = false;
+                if (s.stopRequested) {
+                    break;
+                }
+            }
+            flush();
+        }
+    });
+    s.enabled.store(true, std::memory_order_release);
+}
+
+void AsyncLog::disable() {
+    auto& s = state();
+    std::scoped_lock const lock(s.controlMutex);
+    if (!s.enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    s.enabled.store(false, std::memory_order_release);
+    {
+        std::scoped_lock const wakeLock(s.wakeMutex);
+        s.stopRequested = true;
+    }
+    s.wake.notify_one();
+    s.drainThread.join();
+    flush();
+}
+
+bool AsyncLog::isEnabled() noexcept {
+    return state().enabled.load(std::memory_order_acquire);
+}
+
+void AsyncLog::push(Entry&& entry) {
+    auto& ring = localRing();
+    if (ring.tryPush(entry)) [[likely]] {
+        return;
+    }
+
+    // Ring is full: drain ourselves if no one else is, otherwise wake the drain thread
+    if (auto& s = state(); s.drainMutex.try_lock()) {
+        s.drainMutex.unlock();
+        flush();
+        if (ring.tryPush(entry)) {
+            return;
+        }
+    } else {
+        requestWake(s);
+    }
+
+    // Still full, e.g. while its oldest entry waits for a redirected capture: write right away instead of waiting
+    entry.capture->write(entry.content, entry.type, entry.console);
+    entry.capture->pendingEntries.fetch_sub(1, std::memory_order_release);
+}
+
+void AsyncLog::flush() {
+    auto& s = state();
+    std::scoped_lock const drainLock(s.drainMutex);
+
+    // Rings are never destroyed, so the pointers stay valid after unlocking
+    std::vector<Ring*> rings;
+    {
+        std::scoped_lock const lock(s.ringsMutex);
+        rings.reserve(s.rings.size());
+        for (auto const& ring : s.rings) {
+            rings.push_back(ring.get());
+        }
+    }
+    for (auto* ring : rings) {
+        ring->drain(tryWrite);
+    }
+}
+
+//------------------------------------------
+// Private methods
+
+bool AsyncLog::tryWrite(Entry const& entry) {
+    // Never wait for a capture while draining: a redirect holds the history lock for its whole call,
+    // and its thread may itself wait for this drain once its ring is full
+    std::unique_lock const lock(entry.capture->historyMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false;
+    }
+    entry.capture->write(entry.content, entry.type, entry.console);
+    entry.capture->pendingEntries.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+} // namespace Nebulite::Utility::Io
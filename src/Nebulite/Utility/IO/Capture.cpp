@@ -3,11 +3,17 @@
 
 // Standard library
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <deque>
 #include <mutex>
+#include <ostream>
 #include <string>
+#include <thread>
+#include <utility>
 
 // Nebulite
+#include "Nebulite/Utility/Io/AsyncLog.hpp"
 #include "Nebulite/Utility/Io/Capture.hpp"
 
 //------------------------------------------
@@ -17,12 +23,35 @@ std::deque<HistoryLine> const& Capture::getHistory() const {
     return localHistory.getLines();
 }
 
+std::unique_lock<std::recursive_mutex> Capture::lockHistory() {
+    return std::unique_lock(historyMutex);
+}
+
+void Capture::setHistoryLimit(std::size_t const lines) noexcept {
+    historyLimit.store(lines, std::memory_order_relaxed);
+}
+
+std::size_t Capture::getHistoryLimit() noexcept {
+    return historyLimit.load(std::memory_order_relaxed);
+}
+
 Capture::Capture(Capture* parent)
     : log(this, parent ? &parent->log : noParent)
     , warning(this, parent ? &parent->warning : noParent)
     , error(this, parent ? &parent->error : noParent) {}
 
+Capture::~Capture() {
+    // Entries may be queued behind those of a capture that is being redirected on another thread
+    while (pendingEntries.load(std::memory_order_acquire) != 0) {
+        AsyncLog::flush();
+        if (pendingEntries.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
 void Capture::clear(){
+    std::scoped_lock const lock(historyMutex);
     localHistory.clear();
 }
 
@@ -32,9 +61,27 @@ bool Capture::hasParent() const {
 }
 
 void Capture::appendToHistory(std::string const& str, HistoryLine::Type const lineType) {
+    submit(str, lineType, nullptr);
+}
+
+void Capture::submit(std::string str, HistoryLine::Type const lineType, std::ostream* console) {
+    // Redirects capture synchronously, output of the redirected call must be available once it returns
+    if (AsyncLog::isEnabled() && redirectDepth.load(std::memory_order_relaxed) == 0) {
+        pendingEntries.fetch_add(1, std::memory_order_relaxed);
+        AsyncLog::push({.capture = this, .content = std::move(str), .type = lineType, .console = console});
+        return;
+    }
+    write(str, lineType, console);
+}
+
+void Capture::write(std::string const& str, HistoryLine::Type const lineType, std::ostream* console) {
+    if (console != nullptr) {
+        *console << str;
+    }
     std::scoped_lock const lock(historyMutex);
     if (redirectorStack.empty()) {
         localHistory.addHistoryLine(str, lineType);
+        localHistory.trim(historyLimit.load(std::memory_order_relaxed));
     }
     else {
         redirectorStack.back().addHistoryLine(str, lineType);
@@ -63,6 +110,15 @@ std::string Capture::History::toString() {
     });
 }
 
+void Capture::History::trim(std::size_t const maxLines) {
+    if (maxLines == 0) {
+        return; // Unlimited
+    }
+    while (lines.size() > maxLines) {
+        lines.pop_front();
+    }
+}
+
 void Capture::History::addHistoryLine(std::string const& str, HistoryLine::Type const lineType){
     if (appendableToLastLine(lineType)) {
         lines.back().content.append(str);